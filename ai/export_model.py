@@ -0,0 +1,77 @@
+# Şüpheli hedef modelini (appYpyZeka.ipynb) fusion servisinin okuduğu
+# taşınabilir metin biçimine çevirir. Model, scaler ve label encoder'lar
+# joblib ile yüklenir; sklearn sadece bu script için gerekir, servis
+# çalışırken Python'a ihtiyaç yoktur.
+#
+#   python export_model.py --model uçak_davranış_modeli.pkl \
+#       --scaler scaler.pkl --encoders label_encoders.pkl --out suspicious_model.txt
+#
+# Biçim (boşlukla ayrılmış, '#' satırları yorum):
+#   aewc-suspicious-model 1
+#   features <n> <ad>...                 eğitimdeki sütun sırası
+#   classes <sütun> <k> <sınıf>...       LabelEncoder.classes_ (sıralı)
+#   mean <n> <değer>...                  StandardScaler.mean_
+#   scale <n> <değer>...                 StandardScaler.scale_
+#   trees <t>
+#   tree <düğüm sayısı>                  her ağaç için, ardından düğüm başına:
+#   <sol> <sağ> <özellik> <eşik> <p1>    yaprakta sol = sağ = -1, p1 = P(suspicious)
+
+import argparse
+
+import joblib
+import numpy as np
+
+
+def write_floats(out, name, values):
+    out.write(f"{name} {len(values)} " + " ".join(repr(float(v)) for v in values) + "\n")
+
+
+def export(model, scaler, encoders, out):
+    features = list(scaler.feature_names_in_)
+    if model.n_features_in_ != len(features):
+        raise SystemExit("model ve scaler özellik sayısı uyuşmuyor")
+    positive = list(model.classes_).index(1)
+
+    out.write("aewc-suspicious-model 1\n")
+    out.write(f"features {len(features)} " + " ".join(features) + "\n")
+    for col, le in encoders.items():
+        classes = [str(c) for c in le.classes_]
+        if any(" " in c for c in classes):
+            raise SystemExit(f"{col}: boşluk içeren sınıf adı desteklenmiyor")
+        out.write(f"classes {col} {len(classes)} " + " ".join(classes) + "\n")
+    write_floats(out, "mean", scaler.mean_)
+    write_floats(out, "scale", scaler.scale_)
+
+    out.write(f"trees {len(model.estimators_)}\n")
+    for est in model.estimators_:
+        t = est.tree_
+        # value: düğümdeki (ağırlıklı) sınıf dağılımı; predict_proba bunun
+        # normalize edilmiş halinin ağaçlar üzerindeki ortalamasıdır.
+        value = t.value[:, 0, :]
+        p1 = value[:, positive] / np.maximum(value.sum(axis=1), 1e-300)
+        out.write(f"tree {t.node_count}\n")
+        for i in range(t.node_count):
+            left, right = int(t.children_left[i]), int(t.children_right[i])
+            feature = int(t.feature[i]) if left != -1 else -1
+            out.write(f"{left} {right} {feature} {float(t.threshold[i])!r} {float(p1[i])!r}\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Şüpheli hedef modelini metin biçimine çevirir")
+    ap.add_argument("--model", default="uçak_davranış_modeli.pkl")
+    ap.add_argument("--scaler", default="scaler.pkl")
+    ap.add_argument("--encoders", default="label_encoders.pkl")
+    ap.add_argument("--out", default="suspicious_model.txt")
+    args = ap.parse_args()
+
+    model = joblib.load(args.model)
+    scaler = joblib.load(args.scaler)
+    encoders = joblib.load(args.encoders)
+    with open(args.out, "w", encoding="utf-8") as out:
+        export(model, scaler, encoders, out)
+    print(f"{args.out}: {len(model.estimators_)} ağaç, "
+          f"{sum(e.tree_.node_count for e in model.estimators_)} düğüm")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+# =========================
+# .proto -> C++ / gRPC kaynak üretimi
+# =========================
+# aewc_grpc_proto(<out_var> <proto_file>)
+#   <proto_file> için .pb.cc/.pb.h/.grpc.pb.cc/.grpc.pb.h dosyalarını derleme
+#   dizinindeki generated/ altına üretir ve .cc dosyalarını <out_var>
+#   listesine ekler. Üretilen başlıklar için ${AEWC_PROTO_GEN_DIR} include
+#   edilmelidir. Kaynaklar her derlemede proto'dan üretildiği için kurulu
+#   protobuf sürümüyle her zaman uyumludur.
+
+set(AEWC_PROTO_GEN_DIR ${CMAKE_CURRENT_BINARY_DIR}/generated)
+
+if(TARGET gRPC::grpc_cpp_plugin)
+    set(AEWC_GRPC_CPP_PLUGIN $<TARGET_FILE:gRPC::grpc_cpp_plugin>)
+else()
+    find_program(AEWC_GRPC_CPP_PLUGIN grpc_cpp_plugin)
+    if(NOT AEWC_GRPC_CPP_PLUGIN)
+        message(FATAL_ERROR "grpc_cpp_plugin bulunamadı")
+    endif()
+endif()
+
+if(Protobuf_PROTOC_EXECUTABLE)
+    set(AEWC_PROTOC ${Protobuf_PROTOC_EXECUTABLE})
+else()
+    set(AEWC_PROTOC $<TARGET_FILE:protobuf::protoc>)
+endif()
+
+function(aewc_grpc_proto out_var proto_file)
+    get_filename_component(proto_abs ${proto_file} ABSOLUTE)
+    get_filename_component(proto_dir ${proto_abs} DIRECTORY)
+    get_filename_component(proto_name ${proto_abs} NAME_WE)
+
+    set(gen ${AEWC_PROTO_GEN_DIR}/${proto_name})
+    add_custom_command(
+        OUTPUT ${gen}.pb.cc ${gen}.pb.h ${gen}.grpc.pb.cc ${gen}.grpc.pb.h
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${AEWC_PROTO_GEN_DIR}
+        COMMAND ${AEWC_PROTOC}
+            --proto_path=${proto_dir}
+            --cpp_out=${AEWC_PROTO_GEN_DIR}
+            --grpc_out=${AEWC_PROTO_GEN_DIR}
+            --plugin=protoc-gen-grpc=${AEWC_GRPC_CPP_PLUGIN}
+            ${proto_abs}
+        DEPENDS ${proto_abs}
+        COMMENT "protoc: ${proto_name}.proto"
+        VERBATIM
+    )
+
+    set(${out_var} ${${out_var}} ${gen}.pb.cc ${gen}.grpc.pb.cc PARENT_SCOPE)
+endfunction()
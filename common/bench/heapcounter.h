@@ -0,0 +1,10 @@
+#ifndef HEAPCOUNTER_H
+#define HEAPCOUNTER_H
+
+#include <cstdint>
+
+// Süreç genelinde heap ayırma sayısı. heapcounter.cpp global operator
+// new/delete'i değiştirir; yalnız bench hedeflerine linklenir.
+uint64_t heap_allocs();
+
+#endif
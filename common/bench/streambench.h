@@ -0,0 +1,89 @@
+#ifndef STREAMBENCH_H
+#define STREAMBENCH_H
+
+// iff_bench ve datalink_bench'in ortak gövdesi: servisin sendRecords'u
+// gRPC'siz sahte writer ile, sayan operator new (heapcounter.cpp) altında
+// çalıştırılır.
+
+#include "heapcounter.h"
+#include "logger.h"
+#include "tracksource.h"
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/grpcpp.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Mesajı yeniden kullanılan tampona serileştirir.
+template <typename Response>
+class NullStreamWriter final : public grpc::ServerWriterInterface<Response>
+{
+public:
+    void SendInitialMetadata() override {}
+    bool Write(const Response &msg, grpc::WriteOptions) override
+    {
+        msg.SerializeToString(&wire_);
+        bytes_ += wire_.size();
+        ++messages_;
+        return true;
+    }
+    using grpc::ServerWriterInterface<Response>::Write;
+
+    uint64_t bytes() const { return bytes_; }
+    uint64_t messages() const { return messages_; }
+
+private:
+    std::string wire_;
+    uint64_t bytes_ = 0;
+    uint64_t messages_ = 0;
+};
+
+// Stream başına sabit heap ayırma bütçesi: kaynaktan kopyalanan kayıt
+// vektörü ve FrameArena bloğu. Mesaj başına ayırma bütçesi 0'dır.
+constexpr uint64_t kStreamAllocBudget = 2;
+
+// Tek unpaced stream (fusion beslemesi): kaynak okuma, alan filtresi,
+// sıralama ve her kaydın arenada kurulup yazılması. send, bench'in Access
+// yapısı üzerinden servisin özel sendRecords'unu çağırır. Isınmadan sonra
+// stream başına ayırma kStreamAllocBudget'ı aşarsa ölçüm hatayla biter.
+template <typename Service, typename Request, typename Response>
+void run_stream_bench(benchmark::State &state,
+                      grpc::Status (*send)(Service &, grpc::ServerContext *, const Request *,
+                                           grpc::ServerWriterInterface<Response> *))
+{
+    Logger::instance().setLevel(LogLevel::Warn); // örneklenmiş kayıt satırları ölçüme girmesin
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    Service svc(std::make_unique<MemoryTrackSource>(make_synthetic_tracks(n)));
+    grpc::ServerContext context;
+    Request req;
+    req.set_unpaced(true);
+    NullStreamWriter<Response> writer;
+
+    send(svc, &context, &req, &writer);
+
+    const uint64_t messages_before = writer.messages();
+    const uint64_t bytes_before = writer.bytes();
+    const uint64_t allocs_before = heap_allocs();
+    for (auto _ : state)
+    {
+        if (!send(svc, &context, &req, &writer).ok())
+        {
+            state.SkipWithError("sendRecords failed");
+            return;
+        }
+    }
+    const uint64_t allocs = heap_allocs() - allocs_before;
+    const uint64_t messages = writer.messages() - messages_before;
+
+    state.counters["allocs_per_msg"] = messages ? static_cast<double>(allocs) / static_cast<double>(messages) : 0.0;
+    state.counters["allocs_per_stream"] =
+        benchmark::Counter(static_cast<double>(allocs), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<int64_t>(messages));
+    state.SetBytesProcessed(static_cast<int64_t>(writer.bytes() - bytes_before));
+    if (allocs > kStreamAllocBudget * static_cast<uint64_t>(state.iterations()))
+        state.SkipWithError("stream başına heap ayırma bütçeyi (kStreamAllocBudget) aşıyor");
+}
+
+#endif
@@ -0,0 +1,248 @@
+#ifndef CLUSTERGRID_H
+#define CLUSTERGRID_H
+
+#include "tracksource.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Düşük zoom seviyeleri için artımlı ızgara kümelemesi. Hücreler Web
+// Mercator karolarına hizalıdır: zoom z'de her 256 px karo
+// kCellsPerTile x kCellsPerTile hücreye bölünür (64 px), böylece küme
+// boyutu ekranda zoom'dan bağımsız kalır.
+//
+// Her nokta son katkısını (hücre, konum, durum) hatırlar; update() sadece
+// farkı uygular: hücre değişmediyse toplamlara konum farkı eklenir,
+// değiştiyse nokta eski kümeden çıkarılıp yenisine eklenir. collect()
+// client'a son gönderilen hali de kümede tuttuğundan sadece anlamlı
+// değişiklikleri (sayı, baskın durum, merkezde hücrenin 1/16'sından büyük
+// kayma) ve görünümden çıkan/boşalan kümeleri bildirir.
+class ClusterGrid
+{
+public:
+    static constexpr int kCellsPerTile = 4;
+    static constexpr int kMaxZoom = 24; // x/y anahtarda 29 bit
+
+    struct Point
+    {
+        double lat;
+        double lon;
+        TrackStatus status;
+    };
+
+    struct Cluster
+    {
+        uint32_t count = 0;
+        double sum_lat = 0.0;
+        double sum_lon = 0.0;
+        uint32_t status_count[kTrackStatusCount] = {};
+
+        // Client'taki hal.
+        bool sent = false;
+        uint32_t sent_count = 0;
+        double sent_lat = 0.0;
+        double sent_lon = 0.0;
+        TrackStatus sent_status = TrackStatus::Unknown;
+
+        double lat() const { return sum_lat / count; }
+        double lon() const { return sum_lon / count; }
+
+        // Eşitlikte öncelik FOE > FRIEND > UNKNOWN.
+        TrackStatus dominant() const
+        {
+            TrackStatus best = TrackStatus::Foe;
+            for (TrackStatus s : {TrackStatus::Friend, TrackStatus::Unknown})
+            {
+                if (status_count[static_cast<int>(s)] > status_count[static_cast<int>(best)])
+                    best = s;
+            }
+            return best;
+        }
+    };
+
+    int zoom() const { return zoom_; }
+    std::size_t points() const { return members_.size(); }
+
+    // Tüm noktaları zoom seviyesinde baştan yerleştirir. Eski kümelerin
+    // "gönderildi" bilgisi korunur; boşalanlar collect()'te silinir.
+    // point(i) -> Point, i < n.
+    template <typename PointFn>
+    void rebuild(int zoom, std::size_t n, PointFn &&point)
+    {
+        zoom_ = zoom;
+        scale_ = std::ldexp(static_cast<double>(kCellsPerTile), zoom);
+        for (auto &kv : clusters_)
+        {
+            Cluster &c = kv.second;
+            c.count = 0;
+            c.sum_lat = c.sum_lon = 0.0;
+            for (uint32_t &sc : c.status_count)
+                sc = 0;
+        }
+
+        members_.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Member &m = members_[i];
+            m.p = point(i);
+            m.key = keyOf(m.p.lat, m.p.lon);
+            m.cluster = &clusters_[m.key];
+            add(*m.cluster, m.p);
+        }
+    }
+
+    // Nokta sayısı rebuild'dekiyle aynı olmalıdır (değilse rebuild gerekir).
+    template <typename PointFn>
+    void update(PointFn &&point)
+    {
+        for (std::size_t i = 0; i < members_.size(); ++i)
+        {
+            Member &m = members_[i];
+            const Point p = point(i);
+            const uint64_t key = keyOf(p.lat, p.lon);
+            if (key == m.key)
+            {
+                Cluster &c = *m.cluster;
+                c.sum_lat += p.lat - m.p.lat;
+                c.sum_lon += p.lon - m.p.lon;
+                if (p.status != m.p.status)
+                {
+                    --c.status_count[static_cast<int>(m.p.status)];
+                    ++c.status_count[static_cast<int>(p.status)];
+                }
+            }
+            else
+            {
+                remove(*m.cluster, m.p);
+                m.key = key;
+                m.cluster = &clusters_[key];
+                add(*m.cluster, p);
+            }
+            m.p = p;
+        }
+    }
+
+    // Görünüm içindeki kümeler için on_update(key, cluster), client'ta olup
+    // artık görünmeyen ya da boşalan kümeler için on_remove(key) çağırır ve
+    // client'taki hali günceller.
+    template <typename UpdateFn, typename RemoveFn>
+    void collect(double min_lat, double min_lon, double max_lat, double max_lon, UpdateFn &&on_update,
+                 RemoveFn &&on_remove)
+    {
+        const double min_move = 360.0 / scale_ / 16.0;
+        for (auto it = clusters_.begin(); it != clusters_.end();)
+        {
+            Cluster &c = it->second;
+            bool visible = false;
+            if (c.count > 0)
+            {
+                const double lat = c.lat();
+                const double lon = c.lon();
+                visible = lat >= min_lat && lat <= max_lat && lon >= min_lon && lon <= max_lon;
+            }
+
+            if (visible)
+            {
+                const TrackStatus dom = c.dominant();
+                const bool changed = !c.sent || c.count != c.sent_count || dom != c.sent_status ||
+                                     std::fabs(c.lat() - c.sent_lat) > min_move ||
+                                     std::fabs(c.lon() - c.sent_lon) > min_move;
+                if (changed)
+                {
+                    on_update(it->first, static_cast<const Cluster &>(c));
+                    c.sent = true;
+                    c.sent_count = c.count;
+                    c.sent_lat = c.lat();
+                    c.sent_lon = c.lon();
+                    c.sent_status = dom;
+                }
+            }
+            else if (c.sent)
+            {
+                on_remove(it->first);
+                c.sent = false;
+            }
+
+            if (c.count == 0 && !c.sent)
+                it = clusters_.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Tüm kümeleri client'tan siler (kümeleme modundan çıkarken).
+    template <typename RemoveFn>
+    void clear(RemoveFn &&on_remove)
+    {
+        for (const auto &kv : clusters_)
+        {
+            if (kv.second.sent)
+                on_remove(kv.first);
+        }
+        clusters_.clear();
+        members_.clear();
+    }
+
+    // "C<zoom>_<x>_<y>"; tampon en az 32 bayt olmalı.
+    static std::size_t formatId(char *buf, uint64_t key)
+    {
+        char *p = buf;
+        *p++ = 'C';
+        p = std::to_chars(p, buf + 32, key >> 58).ptr;
+        *p++ = '_';
+        p = std::to_chars(p, buf + 32, (key >> 29) & kCoordMask).ptr;
+        *p++ = '_';
+        p = std::to_chars(p, buf + 32, key & kCoordMask).ptr;
+        return static_cast<std::size_t>(p - buf);
+    }
+
+private:
+    static constexpr uint64_t kCoordMask = (uint64_t(1) << 29) - 1;
+    static constexpr double kPi = 3.14159265358979323846;
+
+    struct Member
+    {
+        Point p{};
+        uint64_t key = 0;
+        Cluster *cluster = nullptr; // unordered_map düğümleri rehash'te yer değiştirmez
+    };
+
+    // zoom (6 bit) | x (29 bit) | y (29 bit)
+    uint64_t keyOf(double lat, double lon) const
+    {
+        const double max_cell = scale_ - 1.0;
+        double x = std::floor((lon + 180.0) / 360.0 * scale_);
+        const double s = std::sin(lat * kPi / 180.0);
+        double y = std::floor((0.5 - std::log((1.0 + s) / (1.0 - s)) / (4.0 * kPi)) * scale_);
+        x = x < 0.0 ? 0.0 : (x > max_cell ? max_cell : x);
+        y = y < 0.0 ? 0.0 : (y > max_cell ? max_cell : y);
+        return (static_cast<uint64_t>(zoom_) << 58) | (static_cast<uint64_t>(x) << 29) | static_cast<uint64_t>(y);
+    }
+
+    static void add(Cluster &c, const Point &p)
+    {
+        ++c.count;
+        c.sum_lat += p.lat;
+        c.sum_lon += p.lon;
+        ++c.status_count[static_cast<int>(p.status)];
+    }
+
+    static void remove(Cluster &c, const Point &p)
+    {
+        --c.count;
+        c.sum_lat -= p.lat;
+        c.sum_lon -= p.lon;
+        --c.status_count[static_cast<int>(p.status)];
+    }
+
+    int zoom_ = -1;
+    double scale_ = 1.0;
+    std::vector<Member> members_;
+    std::unordered_map<uint64_t, Cluster> clusters_;
+};
+
+#endif
@@ -0,0 +1,299 @@
+#include "config.h"
+
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+volatile std::sig_atomic_t s_reload_requested = 0;
+
+extern "C" void on_reload_signal(int)
+{
+    s_reload_requested = 1;
+}
+
+std::string trim(const std::string &s)
+{
+    const std::size_t b = s.find_first_not_of(" \t\r");
+    if (b == std::string::npos)
+        return std::string();
+    const std::size_t e = s.find_last_not_of(" \t\r");
+    return s.substr(b, e - b + 1);
+}
+} // namespace
+
+bool Config::parseFile(const std::string &path, std::map<std::string, std::string> &out, std::string *error)
+{
+    std::ifstream f(path);
+    if (!f)
+    {
+        if (error)
+            *error = "yapılandırma dosyası açılamadı: " + path;
+        return false;
+    }
+
+    std::string section;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(f, line))
+    {
+        ++line_no;
+        // Satır sonu yorumu: değer içinde '#' olabileceği için önünde boşluk aranır.
+        const std::size_t comment = line.find(" #");
+        if (comment != std::string::npos)
+            line.erase(comment);
+        line = trim(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';')
+            continue;
+
+        if (line.front() == '[' && line.back() == ']')
+        {
+            section = trim(line.substr(1, line.size() - 2));
+            continue;
+        }
+
+        const std::size_t eq = line.find('=');
+        if (eq == std::string::npos)
+        {
+            if (error)
+                *error = path + ":" + std::to_string(line_no) + ": '=' bekleniyor";
+            return false;
+        }
+        const std::string key = trim(line.substr(0, eq));
+        const std::string value = trim(line.substr(eq + 1));
+        out[section.empty() ? key : section + "." + key] = value;
+    }
+    return true;
+}
+
+bool Config::load(int argc, char **argv, std::string *error)
+{
+    std::string path;
+    if (const char *v = std::getenv("AEWC_CONFIG"))
+        path = v;
+
+    std::map<std::string, std::string> overrides;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string a = argv[i];
+        if (a.compare(0, 2, "--") != 0)
+        {
+            if (error)
+                *error = "beklenmeyen argüman: " + a;
+            return false;
+        }
+        a.erase(0, 2);
+
+        std::string key;
+        std::string value;
+        const std::size_t eq = a.find('=');
+        if (eq != std::string::npos)
+        {
+            key = a.substr(0, eq);
+            value = a.substr(eq + 1);
+        }
+        else if (i + 1 < argc)
+        {
+            key = a;
+            value = argv[++i];
+        }
+        else
+        {
+            if (error)
+                *error = "--" + a + " bir değer bekliyor";
+            return false;
+        }
+
+        if (key == "config")
+            path = value;
+        else
+            overrides[key] = value;
+    }
+
+    std::map<std::string, std::string> values;
+    if (!path.empty() && !parseFile(path, values, error))
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_ = path;
+    file_values_.swap(values);
+    overrides_.swap(overrides);
+    return true;
+}
+
+bool Config::reload(std::string *error)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        path = path_;
+    }
+    if (path.empty())
+        return true;
+
+    std::map<std::string, std::string> values;
+    if (!parseFile(path, values, error))
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_values_.swap(values);
+    return true;
+}
+
+void Config::set(const std::string &key, const std::string &value)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    overrides_[key] = value;
+}
+
+bool Config::lookup(const std::string &key, std::string &out) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = overrides_.find(key);
+    if (it != overrides_.end())
+    {
+        out = it->second;
+        return true;
+    }
+    it = file_values_.find(key);
+    if (it != file_values_.end())
+    {
+        out = it->second;
+        return true;
+    }
+    return false;
+}
+
+bool Config::has(const std::string &key) const
+{
+    std::string v;
+    return lookup(key, v);
+}
+
+std::string Config::getString(const std::string &key, const std::string &def) const
+{
+    std::string v;
+    return lookup(key, v) ? v : def;
+}
+
+int64_t Config::getInt(const std::string &key, int64_t def) const
+{
+    std::string v;
+    if (!lookup(key, v))
+        return def;
+    char *end = nullptr;
+    const long long n = std::strtoll(v.c_str(), &end, 10);
+    if (end == v.c_str() || *end != '\0')
+    {
+        std::cerr << "[CONFIG] " << key << " tamsayı değil: " << v << std::endl;
+        return def;
+    }
+    return n;
+}
+
+double Config::getDouble(const std::string &key, double def) const
+{
+    std::string v;
+    if (!lookup(key, v))
+        return def;
+    char *end = nullptr;
+    const double d = std::strtod(v.c_str(), &end);
+    if (end == v.c_str() || *end != '\0')
+    {
+        std::cerr << "[CONFIG] " << key << " sayı değil: " << v << std::endl;
+        return def;
+    }
+    return d;
+}
+
+bool Config::getBool(const std::string &key, bool def) const
+{
+    std::string v;
+    if (!lookup(key, v))
+        return def;
+    if (v == "1" || v == "true" || v == "yes" || v == "on")
+        return true;
+    if (v == "0" || v == "false" || v == "no" || v == "off")
+        return false;
+    std::cerr << "[CONFIG] " << key << " bool değil: " << v << std::endl;
+    return def;
+}
+
+std::string Config::dump() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, std::string> merged = file_values_;
+    for (const auto &kv : overrides_)
+        merged[kv.first] = kv.second;
+
+    std::ostringstream oss;
+    for (const auto &kv : merged)
+        oss << kv.first << "=" << kv.second << "\n";
+    return oss.str();
+}
+
+LoggerOptions logger_options(const Config &cfg)
+{
+    LoggerOptions opts = LoggerOptions::fromEnv();
+    const std::string level = cfg.getString("log.level", "");
+    if (!level.empty() && !Logger::parseLevel(level.c_str(), opts.level))
+        std::cerr << "[CONFIG] Geçersiz log.level: " << level << std::endl;
+    const std::string format = cfg.getString("log.format", "");
+    if (!format.empty() && !Logger::parseFormat(format.c_str(), opts.format))
+        std::cerr << "[CONFIG] Geçersiz log.format: " << format << std::endl;
+    opts.path = cfg.getString("log.file", opts.path);
+    opts.capacity = static_cast<std::size_t>(cfg.getInt("log.capacity", static_cast<int64_t>(opts.capacity)));
+    return opts;
+}
+
+ConfigWatcher::~ConfigWatcher()
+{
+    stop();
+}
+
+void ConfigWatcher::start(Config &cfg, std::function<void(const Config &)> on_reload)
+{
+    if (running_.exchange(true))
+        return;
+    cfg_ = &cfg;
+    on_reload_ = std::move(on_reload);
+
+#if defined(SIGHUP)
+    std::signal(SIGHUP, on_reload_signal);
+#elif defined(SIGBREAK)
+    std::signal(SIGBREAK, on_reload_signal);
+#endif
+    thread_ = std::thread(&ConfigWatcher::run, this);
+}
+
+void ConfigWatcher::stop()
+{
+    if (!running_.exchange(false))
+        return;
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void ConfigWatcher::run()
+{
+    while (running_.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        if (!s_reload_requested)
+            continue;
+        s_reload_requested = 0;
+
+        std::string error;
+        if (!cfg_->reload(&error))
+        {
+            Logger::instance().log(LogLevel::Error, "CONFIG", {{"msg", "yeniden yükleme başarısız"}, {"what", error}});
+            continue;
+        }
+        on_reload_(*cfg_);
+        Logger::instance().log(LogLevel::Info, "CONFIG", {{"msg", "yeniden yüklendi"}, {"path", cfg_->path()}});
+    }
+}
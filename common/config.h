@@ -0,0 +1,80 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include "logger.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// "anahtar = değer" satırlarından oluşan yapılandırma dosyası. [bölüm]
+// başlıkları sonraki anahtarlara "bölüm." öneki ekler; '#' ve ';' ile
+// başlayan satırlar ve satır sonu " #" yorumları atlanır.
+//
+// Öncelik: komut satırı > dosya > ortam değişkeni (get* çağrısındaki
+// varsayılan) > derlenmiş varsayılan. Örnek dosya: config/aewc.conf
+class Config
+{
+public:
+    // --config <yol> (yoksa AEWC_CONFIG) dosyasını okur, ardından
+    // --anahtar=değer / --anahtar değer override'larını uygular.
+    // Hata durumunda error doldurulur ve false döner.
+    bool load(int argc, char **argv, std::string *error);
+
+    // Dosyayı yeniden okur; komut satırı override'ları korunur. Dosya
+    // okunamazsa mevcut değerler değişmez.
+    bool reload(std::string *error);
+
+    void set(const std::string &key, const std::string &value);
+    bool has(const std::string &key) const;
+
+    std::string getString(const std::string &key, const std::string &def) const;
+    int64_t getInt(const std::string &key, int64_t def) const;
+    double getDouble(const std::string &key, double def) const;
+    bool getBool(const std::string &key, bool def) const;
+
+    const std::string &path() const { return path_; }
+
+    // Dosya + override birleşimi, "anahtar=değer" satırları (başlangıç logu için).
+    std::string dump() const;
+
+private:
+    bool lookup(const std::string &key, std::string &out) const;
+    static bool parseFile(const std::string &path, std::map<std::string, std::string> &out, std::string *error);
+
+    mutable std::mutex mutex_;
+    std::string path_;
+    std::map<std::string, std::string> file_values_;
+    std::map<std::string, std::string> overrides_;
+};
+
+// log.level / log.format / log.file anahtarları; yoksa AEWC_LOG_* ortam değişkenleri.
+LoggerOptions logger_options(const Config &cfg);
+
+// SIGHUP ile (Windows'ta SIGBREAK, Ctrl+Break) yapılandırmayı yeniden
+// okur ve callback'i çağırır. Sinyal işleyicisi sadece bayrak kurar; dosya
+// okuma ve callback izleyici thread'inde çalışır. Callback'ler sadece
+// "sıcak" anahtarları (tick hızı, pacing, jitter, log seviyesi...) uygular;
+// port, thread sayısı gibi başlangıç ayarları yeniden başlatma gerektirir.
+class ConfigWatcher
+{
+public:
+    ~ConfigWatcher();
+
+    void start(Config &cfg, std::function<void(const Config &)> on_reload);
+    void stop();
+
+private:
+    void run();
+
+    Config *cfg_ = nullptr;
+    std::function<void(const Config &)> on_reload_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+#endif
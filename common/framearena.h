@@ -0,0 +1,72 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <google/protobuf/arena.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Stream başına yeniden kullanılan protobuf arenası. Bir frame'in (radar
+// tick'i, IFF/DataLink kaydı) mesajları create<T>() ile arenada kurulur,
+// frame sonunda reset() hepsini tek seferde bırakır.
+//
+// Arena, sahibi olduğumuz başlangıç bloğuyla açılır; Reset bu bloğu heap'e
+// iade etmez. Bir frame bloğu aşarsa reset() bloğu kullanılan boyuta
+// büyütür, böylece ısınmadan sonra frame başına heap ayırması kalmaz.
+class FrameArena
+{
+public:
+    explicit FrameArena(std::size_t initial_bytes = 64 * 1024)
+        : block_(std::max<std::size_t>(initial_bytes, kMinBlock))
+    {
+        rebuild();
+    }
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    google::protobuf::Arena *get() { return &*arena_; }
+
+    // Arena::Create mesajı arenaya bağlamaz (string alanları heap'e düşer);
+    // mesajlar için CreateMessage gerekir.
+    template <typename T>
+    T *create()
+    {
+        return google::protobuf::Arena::CreateMessage<T>(get());
+    }
+
+    // Frame'deki tüm mesajları bırakır; dönüşten sonra create() ile alınmış
+    // işaretçiler geçersizdir.
+    void reset()
+    {
+        const std::size_t used = static_cast<std::size_t>(arena_->SpaceAllocated());
+        if (used <= block_.size())
+        {
+            arena_->Reset();
+            return;
+        }
+        arena_.reset();
+        block_.assign(std::max(used, block_.size() * 2), 0);
+        rebuild();
+    }
+
+    std::size_t blockSize() const { return block_.size(); }
+
+private:
+    static constexpr std::size_t kMinBlock = 4 * 1024;
+
+    void rebuild()
+    {
+        google::protobuf::ArenaOptions opts;
+        opts.initial_block = block_.data();
+        opts.initial_block_size = block_.size();
+        arena_.emplace(opts);
+    }
+
+    std::vector<char> block_;
+    std::optional<google::protobuf::Arena> arena_;
+};
+
+#endif
@@ -0,0 +1,770 @@
+#include "geofence.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+// GeoJSON için yeterli, küçük bir JSON ağacı. Nesne üyeleri dosyadaki
+// sırayla tutulur; anahtar araması doğrusal (feature başına birkaç anahtar).
+struct Json
+{
+    enum Type : uint8_t
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    Type type = Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string text;
+    std::vector<Json> items;
+    std::vector<std::pair<std::string, Json>> members;
+
+    const Json *get(const char *key) const
+    {
+        for (const auto &m : members)
+            if (m.first == key)
+                return &m.second;
+        return nullptr;
+    }
+};
+
+class JsonParser
+{
+public:
+    explicit JsonParser(const std::string &text) : s_(text) {}
+
+    bool parse(Json &out, std::string *error)
+    {
+        if (!value(out, 0) || (skipSpace(), pos_ != s_.size()))
+        {
+            if (error)
+                *error = "JSON hatası, konum " + std::to_string(pos_) + (error_.empty() ? "" : ": " + error_);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr int kMaxDepth = 128;
+
+    void skipSpace()
+    {
+        while (pos_ < s_.size() && (s_[pos_] == ' ' || s_[pos_] == '\t' || s_[pos_] == '\n' || s_[pos_] == '\r'))
+            ++pos_;
+    }
+
+    bool fail(const char *msg)
+    {
+        error_ = msg;
+        return false;
+    }
+
+    bool literal(const char *word)
+    {
+        const std::size_t n = std::char_traits<char>::length(word);
+        if (s_.compare(pos_, n, word) != 0)
+            return fail("beklenmeyen karakter");
+        pos_ += n;
+        return true;
+    }
+
+    bool value(Json &out, int depth)
+    {
+        if (depth > kMaxDepth)
+            return fail("iç içe derinlik sınırı");
+        skipSpace();
+        if (pos_ >= s_.size())
+            return fail("beklenmeyen dosya sonu");
+        const char c = s_[pos_];
+        if (c == '{')
+            return object(out, depth);
+        if (c == '[')
+            return array(out, depth);
+        if (c == '"')
+        {
+            out.type = Json::String;
+            return string(out.text);
+        }
+        if (c == 't' || c == 'f')
+        {
+            out.type = Json::Bool;
+            out.boolean = c == 't';
+            return literal(c == 't' ? "true" : "false");
+        }
+        if (c == 'n')
+        {
+            out.type = Json::Null;
+            return literal("null");
+        }
+        return number(out);
+    }
+
+    bool number(Json &out)
+    {
+        const char *begin = s_.c_str() + pos_;
+        char *end = nullptr;
+        out.number = std::strtod(begin, &end);
+        if (end == begin)
+            return fail("sayı bekleniyordu");
+        out.type = Json::Number;
+        pos_ += static_cast<std::size_t>(end - begin);
+        return true;
+    }
+
+    bool hex4(uint32_t &cp)
+    {
+        if (pos_ + 4 > s_.size())
+            return fail("eksik \\u kaçışı");
+        cp = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const char h = s_[pos_++];
+            cp <<= 4;
+            if (h >= '0' && h <= '9')
+                cp |= static_cast<uint32_t>(h - '0');
+            else if (h >= 'a' && h <= 'f')
+                cp |= static_cast<uint32_t>(h - 'a' + 10);
+            else if (h >= 'A' && h <= 'F')
+                cp |= static_cast<uint32_t>(h - 'A' + 10);
+            else
+                return fail("geçersiz \\u kaçışı");
+        }
+        return true;
+    }
+
+    static void appendUtf8(std::string &out, uint32_t cp)
+    {
+        if (cp < 0x80)
+            out += static_cast<char>(cp);
+        else if (cp < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool string(std::string &out)
+    {
+        ++pos_; // '"'
+        out.clear();
+        while (pos_ < s_.size())
+        {
+            const char c = s_[pos_++];
+            if (c == '"')
+                return true;
+            if (c != '\\')
+            {
+                out += c;
+                continue;
+            }
+            if (pos_ >= s_.size())
+                break;
+            const char e = s_[pos_++];
+            switch (e)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                out += e;
+                break;
+            case 'b':
+                out += '\b';
+                break;
+            case 'f':
+                out += '\f';
+                break;
+            case 'n':
+                out += '\n';
+                break;
+            case 'r':
+                out += '\r';
+                break;
+            case 't':
+                out += '\t';
+                break;
+            case 'u':
+            {
+                uint32_t cp;
+                if (!hex4(cp))
+                    return false;
+                // UTF-16 vekil çifti.
+                if (cp >= 0xD800 && cp < 0xDC00 && s_.compare(pos_, 2, "\\u") == 0)
+                {
+                    pos_ += 2;
+                    uint32_t low;
+                    if (!hex4(low))
+                        return false;
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                }
+                appendUtf8(out, cp);
+                break;
+            }
+            default:
+                return fail("geçersiz kaçış");
+            }
+        }
+        return fail("kapanmamış string");
+    }
+
+    bool array(Json &out, int depth)
+    {
+        ++pos_; // '['
+        out.type = Json::Array;
+        skipSpace();
+        if (pos_ < s_.size() && s_[pos_] == ']')
+        {
+            ++pos_;
+            return true;
+        }
+        for (;;)
+        {
+            out.items.emplace_back();
+            if (!value(out.items.back(), depth + 1))
+                return false;
+            skipSpace();
+            if (pos_ < s_.size() && s_[pos_] == ',')
+            {
+                ++pos_;
+                continue;
+            }
+            if (pos_ < s_.size() && s_[pos_] == ']')
+            {
+                ++pos_;
+                return true;
+            }
+            return fail("',' ya da ']' bekleniyordu");
+        }
+    }
+
+    bool object(Json &out, int depth)
+    {
+        ++pos_; // '{'
+        out.type = Json::Object;
+        skipSpace();
+        if (pos_ < s_.size() && s_[pos_] == '}')
+        {
+            ++pos_;
+            return true;
+        }
+        for (;;)
+        {
+            skipSpace();
+            if (pos_ >= s_.size() || s_[pos_] != '"')
+                return fail("anahtar bekleniyordu");
+            out.members.emplace_back();
+            if (!string(out.members.back().first))
+                return false;
+            skipSpace();
+            if (pos_ >= s_.size() || s_[pos_] != ':')
+                return fail("':' bekleniyordu");
+            ++pos_;
+            if (!value(out.members.back().second, depth + 1))
+                return false;
+            skipSpace();
+            if (pos_ < s_.size() && s_[pos_] == ',')
+            {
+                ++pos_;
+                continue;
+            }
+            if (pos_ < s_.size() && s_[pos_] == '}')
+            {
+                ++pos_;
+                return true;
+            }
+            return fail("',' ya da '}' bekleniyordu");
+        }
+    }
+
+    const std::string &s_;
+    std::size_t pos_ = 0;
+    std::string error_;
+};
+
+bool isType(const Json *j, const char *type)
+{
+    if (!j || j->type != Json::Object)
+        return false;
+    const Json *t = j->get("type");
+    return t && t->type == Json::String && t->text == type;
+}
+
+std::string scalarText(const Json *j)
+{
+    if (!j)
+        return {};
+    if (j->type == Json::String)
+        return j->text;
+    if (j->type == Json::Number)
+    {
+        std::ostringstream os;
+        os << j->number;
+        return os.str();
+    }
+    return {};
+}
+
+// [[lon, lat], ...] halkası; en az 3 nokta gerekir.
+bool readRing(const Json &ring, std::vector<std::pair<double, double>> &out, std::string *error)
+{
+    if (ring.type != Json::Array)
+    {
+        *error = "halka dizi değil";
+        return false;
+    }
+    out.clear();
+    for (const Json &pos : ring.items)
+    {
+        if (pos.type != Json::Array || pos.items.size() < 2 || pos.items[0].type != Json::Number ||
+            pos.items[1].type != Json::Number)
+        {
+            *error = "geçersiz koordinat";
+            return false;
+        }
+        out.emplace_back(pos.items[0].number, pos.items[1].number);
+    }
+    // Kapanış noktası (ilk noktanın tekrarı) kenar listesinde gereksizdir.
+    if (out.size() > 1 && out.front() == out.back())
+        out.pop_back();
+    if (out.size() < 3)
+    {
+        *error = "halkada 3'ten az nokta";
+        return false;
+    }
+    return true;
+}
+
+bool readPolygonRings(const Json &coords, GeoPolygon &poly, std::string *error)
+{
+    if (coords.type != Json::Array)
+    {
+        *error = "Polygon koordinatları dizi değil";
+        return false;
+    }
+    for (const Json &ring : coords.items)
+    {
+        poly.rings.emplace_back();
+        if (!readRing(ring, poly.rings.back(), error))
+            return false;
+    }
+    return true;
+}
+
+// Geometriyi poly'ye ekler; poligon içermiyorsa false döner (hata değil).
+bool readGeometry(const Json *geom, GeoPolygon &poly, std::string *error)
+{
+    if (!geom || geom->type != Json::Object)
+        return true;
+    const Json *coords = geom->get("coordinates");
+    if (isType(geom, "Polygon"))
+        return coords && readPolygonRings(*coords, poly, error);
+    if (isType(geom, "MultiPolygon"))
+    {
+        if (!coords || coords->type != Json::Array)
+        {
+            *error = "MultiPolygon koordinatları dizi değil";
+            return false;
+        }
+        for (const Json &part : coords->items)
+            if (!readPolygonRings(part, poly, error))
+                return false;
+        return true;
+    }
+    if (isType(geom, "GeometryCollection"))
+    {
+        const Json *geoms = geom->get("geometries");
+        if (geoms && geoms->type == Json::Array)
+            for (const Json &g : geoms->items)
+                if (!readGeometry(&g, poly, error))
+                    return false;
+    }
+    return true;
+}
+
+bool readFeature(const Json &feature, std::size_t ordinal, std::vector<GeoPolygon> &out, std::string *error,
+                 std::size_t &skipped)
+{
+    GeoPolygon poly;
+    std::string geom_error;
+    const Json *geom = isType(&feature, "Feature") ? feature.get("geometry") : &feature;
+    if (!readGeometry(geom, poly, &geom_error))
+    {
+        *error = "feature " + std::to_string(ordinal) + ": " + geom_error;
+        return false;
+    }
+    if (poly.rings.empty())
+    {
+        ++skipped;
+        return true;
+    }
+
+    const Json *props = feature.get("properties");
+    if (props && props->type != Json::Object)
+        props = nullptr;
+    poly.id = scalarText(feature.get("id"));
+    if (poly.id.empty() && props)
+        poly.id = scalarText(props->get("id"));
+    if (poly.id.empty())
+        poly.id = "F" + std::to_string(ordinal);
+    if (props)
+        poly.name = scalarText(props->get("name"));
+    out.push_back(std::move(poly));
+    return true;
+}
+} // namespace
+
+bool parse_geojson_polygons(const std::string &text, std::vector<GeoPolygon> &out, std::string *error,
+                            std::size_t *skipped)
+{
+    Json root;
+    std::string parse_error;
+    if (!JsonParser(text).parse(root, &parse_error))
+    {
+        if (error)
+            *error = parse_error;
+        return false;
+    }
+
+    std::vector<GeoPolygon> polygons;
+    std::size_t skipped_count = 0;
+    std::string feature_error;
+    bool ok = true;
+    if (isType(&root, "FeatureCollection"))
+    {
+        const Json *features = root.get("features");
+        if (features && features->type == Json::Array)
+            for (std::size_t i = 0; ok && i < features->items.size(); ++i)
+                ok = readFeature(features->items[i], i, polygons, &feature_error, skipped_count);
+    }
+    else if (root.type == Json::Object)
+    {
+        ok = readFeature(root, 0, polygons, &feature_error, skipped_count);
+    }
+    else
+    {
+        feature_error = "kök nesne değil";
+        ok = false;
+    }
+
+    if (!ok)
+    {
+        if (error)
+            *error = feature_error;
+        return false;
+    }
+    out = std::move(polygons);
+    if (skipped)
+        *skipped = skipped_count;
+    return true;
+}
+
+bool load_geojson_polygons(const std::string &path, std::vector<GeoPolygon> &out, std::string *error,
+                           std::size_t *skipped)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        if (error)
+            *error = path + " açılamadı";
+        return false;
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    std::string parse_error;
+    if (!parse_geojson_polygons(text.str(), out, &parse_error, skipped))
+    {
+        if (error)
+            *error = path + ": " + parse_error;
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+
+void GeofenceIndex::build(std::vector<GeoPolygon> polygons)
+{
+    polys_.clear();
+    edges_.clear();
+    band_start_.clear();
+    band_edges_.clear();
+    levels_.clear();
+    leaf_poly_.clear();
+    polys_.reserve(polygons.size());
+
+    std::vector<uint32_t> band_count;
+    for (GeoPolygon &src : polygons)
+    {
+        Poly p;
+        p.id = std::move(src.id);
+        p.name = std::move(src.name);
+        p.edge_begin = static_cast<uint32_t>(edges_.size());
+        p.box = Box{INFINITY, INFINITY, -INFINITY, -INFINITY};
+        for (const auto &ring : src.rings)
+        {
+            for (std::size_t i = 0; i < ring.size(); ++i)
+            {
+                const auto &a = ring[i];
+                const auto &b = ring[(i + 1) % ring.size()];
+                p.box.min_x = std::min(p.box.min_x, a.first);
+                p.box.max_x = std::max(p.box.max_x, a.first);
+                p.box.min_y = std::min(p.box.min_y, a.second);
+                p.box.max_y = std::max(p.box.max_y, a.second);
+                // Yatay kenar yarı açık ışın testinde hiç kesişmez.
+                if (a.second == b.second)
+                    continue;
+                edges_.push_back(Edge{a.first, a.second, b.second, (b.first - a.first) / (b.second - a.second)});
+            }
+        }
+        const uint32_t edge_end = static_cast<uint32_t>(edges_.size());
+        if (edge_end == p.edge_begin)
+            p.box = Box{1.0, 1.0, 0.0, 0.0}; // boş kutu: hiçbir nokta içermez
+
+        // Bant sayısı kenar sayısı kadar (1..1024): tipik bantta birkaç kenar.
+        const uint32_t edge_count = edge_end - p.edge_begin;
+        p.bands = std::clamp<uint32_t>(edge_count, 1, 1024);
+        const double height = p.box.max_y - p.box.min_y;
+        p.inv_band_h = height > 0.0 ? p.bands / height : 0.0;
+        p.band_begin = static_cast<uint32_t>(band_start_.size());
+
+        auto band_of = [&p](double y)
+        {
+            const double b = (y - p.box.min_y) * p.inv_band_h;
+            return std::min<uint32_t>(p.bands - 1, b > 0.0 ? static_cast<uint32_t>(b) : 0u);
+        };
+        band_count.assign(p.bands + 1, 0);
+        for (uint32_t e = p.edge_begin; e < edge_end; ++e)
+        {
+            const Edge &edge = edges_[e];
+            const uint32_t lo = band_of(std::min(edge.y0, edge.y1));
+            const uint32_t hi = band_of(std::max(edge.y0, edge.y1));
+            for (uint32_t b = lo; b <= hi; ++b)
+                ++band_count[b + 1];
+        }
+        for (uint32_t b = 0; b < p.bands; ++b)
+            band_count[b + 1] += band_count[b];
+        const uint32_t base = static_cast<uint32_t>(band_edges_.size());
+        for (uint32_t b = 0; b <= p.bands; ++b)
+            band_start_.push_back(base + band_count[b]);
+        band_edges_.resize(base + band_count[p.bands]);
+        for (uint32_t e = p.edge_begin; e < edge_end; ++e)
+        {
+            const Edge &edge = edges_[e];
+            const uint32_t lo = band_of(std::min(edge.y0, edge.y1));
+            const uint32_t hi = band_of(std::max(edge.y0, edge.y1));
+            for (uint32_t b = lo; b <= hi; ++b)
+                band_edges_[base + band_count[b]++] = e;
+        }
+        polys_.push_back(std::move(p));
+    }
+    if (polys_.empty())
+        return;
+
+    // STR: kutu merkezleri önce x'e göre dilimlere, her dilim y'ye göre
+    // sıralanıp kFanout'luk yapraklara bölünür.
+    const std::size_t n = polys_.size();
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0u);
+    auto cx = [this](uint32_t i) { return polys_[i].box.min_x + polys_[i].box.max_x; };
+    auto cy = [this](uint32_t i) { return polys_[i].box.min_y + polys_[i].box.max_y; };
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return cx(a) < cx(b); });
+    const std::size_t leaves = (n + kFanout - 1) / kFanout;
+    const std::size_t slices = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(leaves))));
+    const std::size_t per_slice = slices * kFanout;
+    for (std::size_t begin = 0; begin < n; begin += per_slice)
+    {
+        const std::size_t end = std::min(n, begin + per_slice);
+        std::sort(order.begin() + begin, order.begin() + end, [&](uint32_t a, uint32_t b) { return cy(a) < cy(b); });
+    }
+
+    leaf_poly_ = order;
+    levels_.emplace_back();
+    for (uint32_t poly : order)
+        levels_.back().boxes.push_back(polys_[poly].box);
+    while (levels_.back().boxes.size() > kFanout && levels_.size() < kMaxLevels)
+    {
+        Level up;
+        const std::vector<Box> &below = levels_.back().boxes;
+        for (std::size_t begin = 0; begin < below.size(); begin += kFanout)
+        {
+            Box box = below[begin];
+            for (std::size_t c = begin + 1; c < std::min(below.size(), begin + kFanout); ++c)
+            {
+                box.min_x = std::min(box.min_x, below[c].min_x);
+                box.min_y = std::min(box.min_y, below[c].min_y);
+                box.max_x = std::max(box.max_x, below[c].max_x);
+                box.max_y = std::max(box.max_y, below[c].max_y);
+            }
+            up.boxes.push_back(box);
+        }
+        levels_.push_back(std::move(up));
+    }
+}
+
+bool GeofenceIndex::contains(uint32_t poly, double lon, double lat) const
+{
+    const Poly &p = polys_[poly];
+    if (!p.box.contains(lon, lat))
+        return false;
+    const double b = (lat - p.box.min_y) * p.inv_band_h;
+    const uint32_t band = std::min<uint32_t>(p.bands - 1, b > 0.0 ? static_cast<uint32_t>(b) : 0u);
+
+    // Yarı açık kural (y0 > lat) != (y1 > lat): köşeden geçen ışın bir kez sayılır.
+    bool inside = false;
+    const uint32_t *it = band_edges_.data() + band_start_[p.band_begin + band];
+    const uint32_t *end = band_edges_.data() + band_start_[p.band_begin + band + 1];
+    for (; it != end; ++it)
+    {
+        const Edge &e = edges_[*it];
+        if ((e.y0 > lat) != (e.y1 > lat) && lon < e.x0 + (lat - e.y0) * e.dxdy)
+            inside = !inside;
+    }
+    return inside;
+}
+
+// ---------------------------------------------------------------------------
+
+void GeofenceTracker::reserve(std::size_t n)
+{
+    lat_.reserve(n);
+    lon_.reserve(n);
+    tag_.reserve(n);
+    alive_.reserve(n);
+    fresh_.reserve(n);
+    gone_.reserve(n);
+    gone_tag_.reserve(n);
+    gone_lat_.reserve(n);
+    gone_lon_.reserve(n);
+    prev_start_.reserve(n + 1);
+    cur_start_.reserve(n + 1);
+}
+
+uint32_t GeofenceTracker::add()
+{
+    if (prev_start_.empty())
+        prev_start_.push_back(0);
+    uint32_t slot;
+    if (!free_.empty())
+    {
+        slot = free_.back();
+        free_.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(alive_.size());
+        lat_.push_back(0.0);
+        lon_.push_back(0.0);
+        tag_.push_back(0);
+        alive_.push_back(0);
+        fresh_.push_back(0);
+        gone_.push_back(0);
+        gone_tag_.push_back(0);
+        gone_lat_.push_back(0.0);
+        gone_lon_.push_back(0.0);
+        prev_start_.push_back(prev_start_.back()); // yeni slotun önceki üyeliği boş
+    }
+    alive_[slot] = 1;
+    fresh_[slot] = 1;
+    return slot;
+}
+
+void GeofenceTracker::remove(uint32_t slot)
+{
+    if (slot == kNoSlot || slot >= alive_.size())
+        return;
+    alive_[slot] = 0;
+    fresh_[slot] = 1;
+    if (!gone_[slot])
+    {
+        gone_[slot] = 1;
+        gone_tag_[slot] = tag_[slot];
+        gone_lat_[slot] = lat_[slot];
+        gone_lon_[slot] = lon_[slot];
+    }
+    free_.push_back(slot);
+}
+
+void GeofenceTracker::reset()
+{
+    prev_start_.assign(alive_.size() + 1, 0);
+    prev_ids_.clear();
+    std::fill(gone_.begin(), gone_.end(), 0);
+}
+
+std::size_t GeofenceTracker::evaluate(const GeofenceIndex &index, std::vector<Event> &out)
+{
+    const std::size_t n = alive_.size();
+    cur_start_.resize(n + 1);
+    cur_ids_.clear();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const uint32_t begin = static_cast<uint32_t>(cur_ids_.size());
+        cur_start_[i] = begin;
+        if (!alive_[i])
+            continue;
+        index.query(lat_[i], lon_[i], [this](uint32_t poly) { cur_ids_.push_back(poly); });
+        if (cur_ids_.size() - begin > 1)
+            std::sort(cur_ids_.begin() + begin, cur_ids_.end());
+    }
+    cur_start_[n] = static_cast<uint32_t>(cur_ids_.size());
+
+    // İki sıralı listenin farkı: sadece öncekinde olan çıkış, sadece
+    // şimdikinde olan giriştir.
+    const std::size_t before = out.size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const uint32_t slot = static_cast<uint32_t>(i);
+        // Kaldırılan hedefin önceki üyelikleri çıkış olarak bildirilir; slot
+        // yeniden verildiyse aşağıda fresh_ bu aralığı atlar.
+        if (gone_[i])
+        {
+            for (std::size_t a = prev_start_[i]; a < prev_start_[i + 1]; ++a)
+                out.push_back(Event{slot, gone_tag_[i], prev_ids_[a], false, gone_lat_[i], gone_lon_[i]});
+            gone_[i] = 0;
+        }
+        if (!alive_[i])
+            continue;
+        std::size_t a = fresh_[i] ? prev_start_[i + 1] : prev_start_[i];
+        const std::size_t a_end = prev_start_[i + 1];
+        std::size_t b = cur_start_[i];
+        const std::size_t b_end = cur_start_[i + 1];
+        fresh_[i] = 0;
+        while (a < a_end || b < b_end)
+        {
+            if (b == b_end || (a < a_end && prev_ids_[a] < cur_ids_[b]))
+                out.push_back(Event{slot, tag_[i], prev_ids_[a++], false, lat_[i], lon_[i]});
+            else if (a == a_end || cur_ids_[b] < prev_ids_[a])
+                out.push_back(Event{slot, tag_[i], cur_ids_[b++], true, lat_[i], lon_[i]});
+            else
+            {
+                ++a;
+                ++b;
+            }
+        }
+    }
+    prev_start_.swap(cur_start_);
+    prev_ids_.swap(cur_ids_);
+    return out.size() - before;
+}
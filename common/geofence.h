@@ -0,0 +1,187 @@
+#ifndef GEOFENCE_H
+#define GEOFENCE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// GeoJSON poligonu (WGS84 derece). Polygon ve MultiPolygon halkaları tek
+// listede tutulur; içerik çift-tek (even-odd) kuralıyla belirlendiğinden
+// delikler ve çok parçalı poligonlar ayrıca işaretlenmez.
+struct GeoPolygon
+{
+    std::string id;   // feature.id, yoksa properties.id, yoksa "F<sıra>"
+    std::string name; // properties.name (boş olabilir)
+    std::vector<std::vector<std::pair<double, double>>> rings; // {lon, lat}
+};
+
+// FeatureCollection / Feature / çıplak geometri okur; Polygon ve
+// MultiPolygon dışındaki geometriler atlanır (skipped'a sayılır). Hata
+// durumunda error doldurulur ve false döner.
+bool load_geojson_polygons(const std::string &path, std::vector<GeoPolygon> &out, std::string *error,
+                           std::size_t *skipped = nullptr);
+bool parse_geojson_polygons(const std::string &text, std::vector<GeoPolygon> &out, std::string *error,
+                            std::size_t *skipped = nullptr);
+
+// Statik poligon kümesi için nokta sorgusu.
+//
+// Poligon kutuları STR (Sort-Tile-Recursive) ile paketlenmiş bir R-tree'de
+// tutulur; ağaç seviye seviye düz dizilerde durur, düğüm başına kFanout
+// çocuk. Kutusu noktayı içeren her poligon için nokta-poligon testi,
+// poligonun kenar ızgarasında yapılır: poligon kutusu enlem yönünde
+// bantlara bölünür, her bant kendi y aralığına dokunan kenarları tutar
+// (CSR). Işın atma testi sadece noktanın bandındaki kenarları yürür; tipik
+// poligonda bu birkaç kenardır.
+class GeofenceIndex
+{
+public:
+    void build(std::vector<GeoPolygon> polygons);
+
+    // Noktayı içeren her poligon için fn(poligon indeksi); sıra R-tree
+    // sırasıdır, sıralı değildir.
+    template <typename Fn>
+    void query(double lat, double lon, Fn &&fn) const
+    {
+        if (levels_.empty())
+            return;
+        // Kök seviyesinden yapraklara; yığın derinliği kFanout * seviye ile sınırlı.
+        uint32_t stack[kFanout * kMaxLevels];
+        std::size_t top = 0;
+        const Level &root = levels_.back();
+        for (uint32_t i = 0; i < root.boxes.size(); ++i)
+            if (root.boxes[i].contains(lon, lat))
+                stack[top++] = static_cast<uint32_t>((levels_.size() - 1) << 24) | i;
+        while (top > 0)
+        {
+            const uint32_t item = stack[--top];
+            const std::size_t level = item >> 24;
+            const uint32_t node = item & 0xFFFFFFu;
+            if (level == 0)
+            {
+                const uint32_t poly = leaf_poly_[node];
+                if (contains(poly, lon, lat))
+                    fn(poly);
+                continue;
+            }
+            const Level &below = levels_[level - 1];
+            const uint32_t end = std::min<uint32_t>(static_cast<uint32_t>(below.boxes.size()), (node + 1) * kFanout);
+            for (uint32_t c = node * kFanout; c < end; ++c)
+                if (below.boxes[c].contains(lon, lat))
+                    stack[top++] = static_cast<uint32_t>((level - 1) << 24) | c;
+        }
+    }
+
+    // Tek poligon için test (kutu dahil).
+    bool contains(uint32_t poly, double lon, double lat) const;
+
+    std::size_t size() const { return polys_.size(); }
+    std::size_t edges() const { return edges_.size(); }
+    const std::string &id(uint32_t poly) const { return polys_[poly].id; }
+    const std::string &name(uint32_t poly) const { return polys_[poly].name; }
+
+private:
+    static constexpr uint32_t kFanout = 16;
+    static constexpr std::size_t kMaxLevels = 8; // 16^7 yaprak; 24 bit düğüm indeksi
+
+    struct Box
+    {
+        double min_x = 0.0, min_y = 0.0, max_x = 0.0, max_y = 0.0;
+        bool contains(double x, double y) const { return x >= min_x && x <= max_x && y >= min_y && y <= max_y; }
+    };
+
+    // Kenar: (x0, y0) -> (x1, y1); ışın testinin eğimi önceden hesaplanır.
+    struct Edge
+    {
+        double x0, y0, y1;
+        double dxdy; // (x1 - x0) / (y1 - y0)
+    };
+
+    struct Poly
+    {
+        std::string id;
+        std::string name;
+        Box box;
+        uint32_t edge_begin = 0; // edges_ aralığı
+        uint32_t band_begin = 0; // band_start_ aralığı (bands + 1 eleman)
+        uint32_t bands = 0;
+        double inv_band_h = 0.0;
+    };
+
+    struct Level
+    {
+        std::vector<Box> boxes;
+    };
+
+    std::vector<Poly> polys_;
+    std::vector<Edge> edges_;
+    std::vector<uint32_t> band_start_; // poligon başına bands + 1, band_edges_ içine
+    std::vector<uint32_t> band_edges_; // edges_ indeksleri
+    std::vector<Level> levels_;        // 0: yapraklar (STR sırasıyla poligon kutuları)
+    std::vector<uint32_t> leaf_poly_;  // yaprak -> poligon
+};
+
+// Hedef başına içinde bulunulan poligonlar ve tick'ler arası giriş/çıkış
+// farkı (SoA). Üyelikler slot sırasıyla CSR dizide tutulur; her tick yeni
+// CSR kurulur ve öncekiyle slot slot birleştirilerek olaylar çıkarılır.
+class GeofenceTracker
+{
+public:
+    static constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+
+    struct Event
+    {
+        uint32_t slot;
+        uint32_t tag;  // measure()'da verilen değer
+        uint32_t poly; // GeofenceIndex poligon indeksi
+        bool enter;
+        double lat, lon; // kaldırılan hedefte son bilinen konum
+    };
+
+    void reserve(std::size_t n);
+    uint32_t add();
+    // Slot boşalır; önceki üyelikleri için sonraki evaluate()'te hedefin son
+    // bilinen tag ve konumuyla çıkış olayı üretilir.
+    void remove(uint32_t slot);
+
+    void measure(uint32_t slot, uint32_t tag, double lat, double lon)
+    {
+        if (slot == kNoSlot)
+            return;
+        lat_[slot] = lat;
+        lon_[slot] = lon;
+        tag_[slot] = tag;
+    }
+
+    // Tüm canlı slotları index'e göre sınar ve giriş/çıkış olaylarını out'a
+    // ekler (out temizlenmez). Dönüş: eklenen olay sayısı.
+    std::size_t evaluate(const GeofenceIndex &index, std::vector<Event> &out);
+
+    // Index değiştiğinde çağrılır: önceki üyelikler olaysız unutulur, yeni
+    // index'teki üyelikler sonraki evaluate()'te giriş olarak bildirilir.
+    void reset();
+
+    std::size_t memberships() const { return prev_ids_.size(); } // son evaluate()'ten sonra
+
+private:
+    std::vector<double> lat_, lon_;
+    std::vector<uint32_t> tag_;
+    std::vector<uint8_t> alive_;
+    std::vector<uint8_t> fresh_; // yeni / yeniden kullanılan slot: önceki üyelik yok sayılır
+    // Son evaluate()'ten beri kaldırılan slotlar ve kaldırılmadan önceki
+    // değerleri; slot aynı reload'da yeni hedefe verilebilir.
+    std::vector<uint8_t> gone_;
+    std::vector<uint32_t> gone_tag_;
+    std::vector<double> gone_lat_, gone_lon_;
+
+    // Önceki ve bu tick'in üyelikleri: slot i'nin poligonları
+    // ids[start[i] .. start[i + 1]), sıralı.
+    std::vector<uint32_t> prev_start_, prev_ids_;
+    std::vector<uint32_t> cur_start_, cur_ids_;
+
+    std::vector<uint32_t> free_;
+};
+
+#endif
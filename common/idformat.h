@@ -0,0 +1,43 @@
+#ifndef IDFORMAT_H
+#define IDFORMAT_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+// Stream mesajlarındaki sıra ID'leri ("ID007", "DL1234"): önek + en az 3
+// haneli, sıfır dolgulu sıra numarası. ostringstream + setw/setfill yerine
+// çağıranın yığın tamponuna yazar; locale ve heap kullanmaz.
+constexpr std::size_t kRankIdBufSize = 24;
+
+// Yazılan karakter sayısını döner; tampon null ile sonlandırılmaz.
+inline std::size_t format_rank_id(char (&buf)[kRankIdBufSize], const char *prefix, int rank)
+{
+    const std::size_t plen = std::strlen(prefix);
+    std::memcpy(buf, prefix, plen);
+
+    char digits[12];
+    const auto res = std::to_chars(digits, digits + sizeof(digits), rank);
+    const std::size_t ndigits = static_cast<std::size_t>(res.ptr - digits);
+
+    std::size_t pos = plen;
+    for (std::size_t i = ndigits; i < 3; ++i)
+        buf[pos++] = '0';
+    std::memcpy(buf + pos, digits, ndigits);
+    return pos + ndigits;
+}
+
+// format_rank_id'nin tersi: önekten sonra sadece rakam ("ID007" -> 7).
+inline bool parse_rank_id(std::string_view id, const char *prefix, int &rank)
+{
+    const std::size_t plen = std::strlen(prefix);
+    if (id.size() <= plen || id.compare(0, plen, prefix) != 0)
+        return false;
+    const char *first = id.data() + plen;
+    const char *last = id.data() + id.size();
+    const auto res = std::from_chars(first, last, rank);
+    return res.ec == std::errc() && res.ptr == last && rank > 0;
+}
+
+#endif
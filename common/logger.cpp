@@ -0,0 +1,469 @@
+#include "logger.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+namespace
+{
+const char *level_name(LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::Debug:
+        return "DEBUG";
+    case LogLevel::Info:
+        return "INFO";
+    case LogLevel::Warn:
+        return "WARN";
+    case LogLevel::Error:
+        return "ERROR";
+    default:
+        return "OFF";
+    }
+}
+
+int64_t now_unix_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+int64_t now_steady_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void append_json_string(std::string &buf, const char *s, std::size_t n)
+{
+    buf.push_back('"');
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const char c = s[i];
+        if (c == '"' || c == '\\')
+        {
+            buf.push_back('\\');
+            buf.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char esc[8];
+            std::snprintf(esc, sizeof(esc), "\\u%04x", c);
+            buf.append(esc);
+        }
+        else
+        {
+            buf.push_back(c);
+        }
+    }
+    buf.push_back('"');
+}
+
+template <typename T>
+void append_raw(std::string &buf, const T &v)
+{
+    buf.append(reinterpret_cast<const char *>(&v), sizeof(T));
+}
+
+void append_short_str(std::string &buf, const char *s, std::size_t n)
+{
+    const uint8_t len = static_cast<uint8_t>(n > 255 ? 255 : n);
+    append_raw(buf, len);
+    buf.append(s, len);
+}
+
+// String değerler kayıt taşma tamponundan uzun olamaz (uint16 yeter).
+void append_str16(std::string &buf, std::string_view s)
+{
+    append_raw(buf, static_cast<uint16_t>(s.size()));
+    buf.append(s.data(), s.size());
+}
+
+// n'yi en fazla max bayta indirir; UTF-8 devam baytlarında (10xxxxxx)
+// kesmemek için karakter başına kadar geri gider.
+std::size_t utf8_cut(const char *s, std::size_t n, std::size_t max)
+{
+    if (n <= max)
+        return n;
+    while (max > 0 && (static_cast<unsigned char>(s[max]) & 0xC0) == 0x80)
+        --max;
+    return max;
+}
+} // namespace
+
+LoggerOptions LoggerOptions::fromEnv()
+{
+    LoggerOptions opts;
+    if (const char *v = std::getenv("AEWC_LOG_LEVEL"))
+    {
+        if (!Logger::parseLevel(v, opts.level))
+            std::cerr << "[LOG] Geçersiz AEWC_LOG_LEVEL: " << v << std::endl;
+    }
+    if (const char *v = std::getenv("AEWC_LOG_FORMAT"))
+    {
+        if (!Logger::parseFormat(v, opts.format))
+            std::cerr << "[LOG] Geçersiz AEWC_LOG_FORMAT: " << v << std::endl;
+    }
+    if (const char *v = std::getenv("AEWC_LOG_FILE"))
+        opts.path = v;
+    return opts;
+}
+
+Logger &Logger::instance()
+{
+    static Logger s_logger;
+    return s_logger;
+}
+
+Logger::Logger()
+{
+    coarse_ms_.store(now_steady_ms(), std::memory_order_relaxed);
+}
+
+Logger::~Logger()
+{
+    stop();
+}
+
+bool Logger::parseLevel(std::string_view s, LogLevel &out)
+{
+    if (s == "debug" || s == "DEBUG")
+        out = LogLevel::Debug;
+    else if (s == "info" || s == "INFO")
+        out = LogLevel::Info;
+    else if (s == "warn" || s == "WARN")
+        out = LogLevel::Warn;
+    else if (s == "error" || s == "ERROR")
+        out = LogLevel::Error;
+    else if (s == "off" || s == "OFF")
+        out = LogLevel::Off;
+    else
+        return false;
+    return true;
+}
+
+bool Logger::parseFormat(std::string_view s, LogFormat &out)
+{
+    if (s == "text")
+        out = LogFormat::Text;
+    else if (s == "json")
+        out = LogFormat::Json;
+    else if (s == "binary")
+        out = LogFormat::Binary;
+    else
+        return false;
+    return true;
+}
+
+void Logger::start(const LoggerOptions &opts)
+{
+    stop();
+
+    std::size_t cap = 64;
+    while (cap < opts.capacity)
+        cap <<= 1;
+    cells_.reset(new Cell[cap]);
+    for (std::size_t i = 0; i < cap; ++i)
+        cells_[i].seq.store(i, std::memory_order_relaxed);
+    mask_ = cap - 1;
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_ = 0;
+
+    format_ = opts.format;
+    out_ = stdout;
+    owns_out_ = false;
+    if (!opts.path.empty())
+    {
+        std::FILE *f = std::fopen(opts.path.c_str(), opts.format == LogFormat::Binary ? "ab" : "a");
+        if (f)
+        {
+            out_ = f;
+            owns_out_ = true;
+        }
+        else
+        {
+            std::cerr << "[LOG] Log dosyası açılamadı, stdout kullanılıyor: " << opts.path << std::endl;
+        }
+    }
+    if (format_ == LogFormat::Binary)
+        std::fwrite("AEWCLOG2", 1, 8, out_);
+
+    setLevel(opts.level);
+    running_.store(true, std::memory_order_release);
+    writer_ = std::thread(&Logger::writerLoop, this);
+}
+
+void Logger::stop()
+{
+    if (!running_.exchange(false))
+        return;
+    if (writer_.joinable())
+        writer_.join();
+    if (owns_out_)
+        std::fclose(out_);
+    else
+        std::fflush(out_);
+    out_ = stdout;
+    owns_out_ = false;
+}
+
+void Logger::log(LogLevel level, const char *event, std::initializer_list<LogField> fields)
+{
+    if (!enabled(level) || !running_.load(std::memory_order_relaxed))
+        return;
+
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;)
+    {
+        cell = &cells_[pos & mask_];
+        const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+        const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (dif == 0)
+        {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record &r = cell->rec;
+    r.ts_us = now_unix_us();
+    r.event = event;
+    r.level = level;
+    uint8_t n = 0;
+    std::size_t used = 0;
+    for (const LogField &f : fields)
+    {
+        if (n == kMaxFields)
+            break;
+        LogField &out = r.fields[n++];
+        out = f;
+        if (f.kind != LogField::Kind::Str || f.inlined())
+            continue;
+
+        // Uzun değer taşma tamponuna kopyalanır. Sığmazsa kesilip "…" ile
+        // işaretlenir; kesilmiş değer de inline sınırından uzun kalmalı ki
+        // str() onu tampondan okusun.
+        static constexpr char kEllipsis[] = "\xE2\x80\xA6";
+        constexpr std::size_t kEllipsisLen = sizeof(kEllipsis) - 1;
+        const std::size_t room = kOverflowBytes - used;
+        std::size_t len = f.len;
+        bool cut = false;
+        if (len > room)
+        {
+            if (room < LogField::kInlineStr + 1 + kEllipsisLen)
+            {
+                len = utf8_cut(f.p, f.len, LogField::kInlineStr - kEllipsisLen);
+                std::memcpy(out.s, f.p, len);
+                std::memcpy(out.s + len, kEllipsis, kEllipsisLen);
+                out.len = static_cast<uint32_t>(len + kEllipsisLen);
+                continue;
+            }
+            len = utf8_cut(f.p, f.len, room - kEllipsisLen);
+            cut = true;
+        }
+        std::memcpy(r.overflow + used, f.p, len);
+        if (cut)
+        {
+            std::memcpy(r.overflow + used + len, kEllipsis, kEllipsisLen);
+            len += kEllipsisLen;
+        }
+        out.i = static_cast<int64_t>(used);
+        out.len = static_cast<uint32_t>(len);
+        used += len;
+    }
+    r.nfields = n;
+    r.overflow_used = static_cast<uint16_t>(used);
+
+    cell->seq.store(pos + 1, std::memory_order_release);
+}
+
+bool Logger::tryPop(Record &out)
+{
+    Cell &cell = cells_[dequeue_pos_ & mask_];
+    const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+    if (seq != dequeue_pos_ + 1)
+        return false;
+
+    out.ts_us = cell.rec.ts_us;
+    out.event = cell.rec.event;
+    out.level = cell.rec.level;
+    out.nfields = cell.rec.nfields;
+    for (uint8_t i = 0; i < out.nfields; ++i)
+        out.fields[i] = cell.rec.fields[i];
+    out.overflow_used = cell.rec.overflow_used;
+    std::memcpy(out.overflow, cell.rec.overflow, out.overflow_used);
+
+    cell.seq.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    return true;
+}
+
+void Logger::drain(std::string &buf)
+{
+    Record rec;
+    while (tryPop(rec))
+    {
+        format(rec, buf);
+        if (buf.size() >= (64u << 10))
+        {
+            std::fwrite(buf.data(), 1, buf.size(), out_);
+            buf.clear();
+        }
+    }
+    if (!buf.empty())
+    {
+        std::fwrite(buf.data(), 1, buf.size(), out_);
+        buf.clear();
+    }
+}
+
+void Logger::writerLoop()
+{
+    std::string buf;
+    buf.reserve(128u << 10);
+    uint64_t reported_drops = 0;
+
+    while (running_.load(std::memory_order_acquire))
+    {
+        coarse_ms_.store(now_steady_ms(), std::memory_order_relaxed);
+        drain(buf);
+
+        const uint64_t drops = dropped_.load(std::memory_order_relaxed);
+        if (drops != reported_drops && format_ == LogFormat::Text)
+        {
+            std::fprintf(out_, "[LOG] %" PRIu64 " kayıt düşürüldü (kuyruk dolu)\n", drops - reported_drops);
+            reported_drops = drops;
+        }
+
+        std::fflush(out_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    drain(buf);
+    std::fflush(out_);
+}
+
+void Logger::format(const Record &r, std::string &buf) const
+{
+    char num[64];
+
+    if (format_ == LogFormat::Binary)
+    {
+        append_raw(buf, r.ts_us);
+        append_raw(buf, static_cast<uint8_t>(r.level));
+        append_short_str(buf, r.event, std::strlen(r.event));
+        append_raw(buf, r.nfields);
+        for (uint8_t i = 0; i < r.nfields; ++i)
+        {
+            const LogField &f = r.fields[i];
+            append_short_str(buf, f.key, std::strlen(f.key));
+            append_raw(buf, static_cast<uint8_t>(f.kind));
+            switch (f.kind)
+            {
+            case LogField::Kind::Int:
+                append_raw(buf, f.i);
+                break;
+            case LogField::Kind::Double:
+                append_raw(buf, f.d);
+                break;
+            case LogField::Kind::Bool:
+                append_raw(buf, static_cast<uint8_t>(f.b));
+                break;
+            case LogField::Kind::Str:
+                append_str16(buf, r.str(f));
+                break;
+            }
+        }
+        return;
+    }
+
+    if (format_ == LogFormat::Json)
+    {
+        std::snprintf(num, sizeof(num), "{\"ts_us\":%" PRId64 ",\"level\":\"%s\",\"event\":", r.ts_us, level_name(r.level));
+        buf.append(num);
+        append_json_string(buf, r.event, std::strlen(r.event));
+        for (uint8_t i = 0; i < r.nfields; ++i)
+        {
+            const LogField &f = r.fields[i];
+            buf.push_back(',');
+            append_json_string(buf, f.key, std::strlen(f.key));
+            buf.push_back(':');
+            switch (f.kind)
+            {
+            case LogField::Kind::Int:
+                std::snprintf(num, sizeof(num), "%" PRId64, f.i);
+                buf.append(num);
+                break;
+            case LogField::Kind::Double:
+                std::snprintf(num, sizeof(num), "%.6f", f.d);
+                buf.append(num);
+                break;
+            case LogField::Kind::Bool:
+                buf.append(f.b ? "true" : "false");
+                break;
+            case LogField::Kind::Str:
+            {
+                const std::string_view v = r.str(f);
+                append_json_string(buf, v.data(), v.size());
+                break;
+            }
+            }
+        }
+        buf.append("}\n");
+        return;
+    }
+
+    // Text: "2026-01-01 12:00:00.123 INFO [SEND] id=ID001 lat=..."
+    const std::time_t secs = static_cast<std::time_t>(r.ts_us / 1000000);
+    std::tm tm_buf{};
+#if defined(_WIN32)
+    localtime_s(&tm_buf, &secs);
+#else
+    localtime_r(&secs, &tm_buf);
+#endif
+    const std::size_t n = std::strftime(num, sizeof(num), "%Y-%m-%d %H:%M:%S", &tm_buf);
+    buf.append(num, n);
+    std::snprintf(num, sizeof(num), ".%03d %s [", static_cast<int>((r.ts_us / 1000) % 1000), level_name(r.level));
+    buf.append(num);
+    buf.append(r.event);
+    buf.push_back(']');
+    for (uint8_t i = 0; i < r.nfields; ++i)
+    {
+        const LogField &f = r.fields[i];
+        buf.push_back(' ');
+        buf.append(f.key);
+        buf.push_back('=');
+        switch (f.kind)
+        {
+        case LogField::Kind::Int:
+            std::snprintf(num, sizeof(num), "%" PRId64, f.i);
+            buf.append(num);
+            break;
+        case LogField::Kind::Double:
+            std::snprintf(num, sizeof(num), "%.6f", f.d);
+            buf.append(num);
+            break;
+        case LogField::Kind::Bool:
+            buf.append(f.b ? "YES" : "NO");
+            break;
+        case LogField::Kind::Str:
+            buf.append(r.str(f));
+            break;
+        }
+    }
+    buf.push_back('\n');
+}
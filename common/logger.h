@@ -0,0 +1,205 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+enum class LogLevel : uint8_t
+{
+    Debug = 0,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+enum class LogFormat : uint8_t
+{
+    Text,
+    Json,
+    Binary
+};
+
+struct LoggerOptions
+{
+    LogLevel level = LogLevel::Info;
+    LogFormat format = LogFormat::Text;
+    std::string path;            // boşsa stdout
+    std::size_t capacity = 8192; // ring buffer kayıt sayısı (2'nin kuvvetine yuvarlanır)
+
+    // AEWC_LOG_LEVEL, AEWC_LOG_FORMAT, AEWC_LOG_FILE ortam değişkenlerini okur.
+    static LoggerOptions fromEnv();
+};
+
+// Tek bir log alanı. Anahtar statik bir string olmalıdır (kopyalanmaz).
+// kInlineStr'e kadar string değerler alana gömülür; daha uzunları sadece
+// log() çağrısı boyunca geçerli bir işaretçi olarak taşınır ve log() onları
+// kaydın taşma tamponuna kopyalar (bkz. Logger::kOverflowBytes).
+struct LogField
+{
+    enum class Kind : uint8_t
+    {
+        Int,
+        Double,
+        Bool,
+        Str
+    };
+
+    static constexpr std::size_t kInlineStr = 31;
+
+    const char *key = nullptr;
+    Kind kind = Kind::Int;
+    uint32_t len = 0;
+    union
+    {
+        int64_t i;    // Str ve len > kInlineStr ise kayıtta: taşma tamponundaki konum
+        double d;
+        bool b;
+        const char *p; // Str ve len > kInlineStr ise log()'a kadar: çağıranın verisi
+    };
+    char s[kInlineStr];
+
+    bool inlined() const { return len <= kInlineStr; }
+
+    LogField(const char *k, int v) : key(k), kind(Kind::Int), i(v) {}
+    LogField(const char *k, long v) : key(k), kind(Kind::Int), i(v) {}
+    LogField(const char *k, long long v) : key(k), kind(Kind::Int), i(v) {}
+    LogField(const char *k, unsigned v) : key(k), kind(Kind::Int), i(v) {}
+    LogField(const char *k, unsigned long v) : key(k), kind(Kind::Int), i(static_cast<int64_t>(v)) {}
+    LogField(const char *k, unsigned long long v) : key(k), kind(Kind::Int), i(static_cast<int64_t>(v)) {}
+    LogField(const char *k, double v) : key(k), kind(Kind::Double), d(v) {}
+    LogField(const char *k, bool v) : key(k), kind(Kind::Bool), b(v) {}
+    LogField(const char *k, const char *v) : LogField(k, std::string_view(v ? v : "")) {}
+    LogField(const char *k, const std::string &v) : LogField(k, std::string_view(v)) {}
+    LogField(const char *k, std::string_view v) : key(k), kind(Kind::Str), i(0)
+    {
+        len = static_cast<uint32_t>(v.size() < UINT32_MAX ? v.size() : UINT32_MAX);
+        if (inlined())
+            std::memcpy(s, v.data(), len);
+        else
+            p = v.data();
+    }
+    LogField() : i(0) {}
+};
+
+// Asenkron, kilitsiz log kuyruğu.
+// Hot path sadece alanları sabit boyutlu bir kayda kopyalayıp ring buffer'a
+// koyar (Vyukov bounded MPMC kuyruğu); biçimlendirme ve yazma arka plandaki
+// yazıcı thread'inde yapılır. Kuyruk doluysa kayıt düşürülür, çağıran asla
+// beklemez.
+class Logger
+{
+public:
+    static constexpr std::size_t kMaxFields = 10;
+    // Kayıt başına uzun string değerlerin toplam alanı; sığmayan değer UTF-8
+    // karakter sınırında kesilir ve sonuna "…" eklenir.
+    static constexpr std::size_t kOverflowBytes = 512;
+
+    static Logger &instance();
+
+    void start(const LoggerOptions &opts);
+    void stop();
+
+    bool enabled(LogLevel level) const
+    {
+        return static_cast<uint8_t>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    void setLevel(LogLevel level) { level_.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+
+    // event statik bir string olmalıdır ("SEND", "IFF" gibi).
+    void log(LogLevel level, const char *event, std::initializer_list<LogField> fields);
+
+    // Yazıcı thread'inin ~1 ms çözünürlükle güncellediği monoton saat.
+    int64_t coarseMillis() const { return coarse_ms_.load(std::memory_order_relaxed); }
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    static bool parseLevel(std::string_view s, LogLevel &out);
+    static bool parseFormat(std::string_view s, LogFormat &out);
+
+    ~Logger();
+
+private:
+    Logger();
+
+    struct Record
+    {
+        int64_t ts_us = 0; // Unix epoch, mikrosaniye
+        const char *event = nullptr;
+        LogLevel level = LogLevel::Info;
+        uint8_t nfields = 0;
+        uint16_t overflow_used = 0;
+        LogField fields[kMaxFields];
+        char overflow[kOverflowBytes];
+
+        std::string_view str(const LogField &f) const
+        {
+            return f.inlined() ? std::string_view(f.s, f.len) : std::string_view(overflow + f.i, f.len);
+        }
+    };
+
+    struct Cell
+    {
+        std::atomic<std::size_t> seq{0};
+        Record rec;
+    };
+
+    bool tryPop(Record &out);
+    void writerLoop();
+    void drain(std::string &buf);
+    void format(const Record &r, std::string &buf) const;
+
+    std::atomic<uint8_t> level_{static_cast<uint8_t>(LogLevel::Info)};
+    LogFormat format_ = LogFormat::Text;
+    std::FILE *out_ = stdout;
+    bool owns_out_ = false;
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_ = 0;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(64) std::size_t dequeue_pos_ = 0;
+
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<int64_t> coarse_ms_{0};
+    std::atomic<bool> running_{false};
+    std::thread writer_;
+};
+
+// Hedef başına satırlar için saniyede en fazla max_per_sec kayda izin verir.
+// Karar yazıcı thread'inin kaba saatiyle verilir; hot path'te sistem saati
+// okunmaz, sadece birkaç relaxed atomik işlem yapılır.
+class LogRateLimiter
+{
+public:
+    explicit LogRateLimiter(uint32_t max_per_sec) : max_per_sec_(max_per_sec) {}
+
+    bool allow(LogLevel level)
+    {
+        Logger &log = Logger::instance();
+        if (!log.enabled(level))
+            return false;
+
+        const int64_t window = log.coarseMillis() / 1000;
+        if (window != window_.load(std::memory_order_relaxed))
+        {
+            window_.store(window, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+        }
+        return count_.fetch_add(1, std::memory_order_relaxed) < max_per_sec_;
+    }
+
+private:
+    const uint32_t max_per_sec_;
+    std::atomic<int64_t> window_{-1};
+    std::atomic<uint32_t> count_{0};
+};
+
+#endif
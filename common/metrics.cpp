@@ -0,0 +1,369 @@
+#include "metrics.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using socket_len_t = int;
+static void close_socket(std::intptr_t fd) { closesocket(static_cast<SOCKET>(fd)); }
+static constexpr int kSendFlags = 0;
+
+static void set_io_timeout(std::intptr_t fd, int ms)
+{
+    const DWORD t = static_cast<DWORD>(ms);
+    setsockopt(static_cast<SOCKET>(fd), SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char *>(&t), sizeof(t));
+    setsockopt(static_cast<SOCKET>(fd), SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char *>(&t), sizeof(t));
+}
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+using socket_len_t = socklen_t;
+static void close_socket(std::intptr_t fd) { ::close(static_cast<int>(fd)); }
+
+// Erken kapanan scraper'a yazmak SIGPIPE ile tüm servisi düşürmesin.
+#if defined(MSG_NOSIGNAL)
+static constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+static constexpr int kSendFlags = 0;
+#endif
+
+static void set_io_timeout(std::intptr_t fd, int ms)
+{
+    const timeval tv{ms / 1000, (ms % 1000) * 1000};
+    setsockopt(static_cast<int>(fd), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(static_cast<int>(fd), SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+#if defined(SO_NOSIGPIPE)
+    int yes = 1;
+    setsockopt(static_cast<int>(fd), SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+}
+#endif
+
+std::size_t metrics_detail::shard_index()
+{
+    static std::atomic<std::size_t> s_next{0};
+    thread_local const std::size_t idx = s_next.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return idx;
+}
+
+uint64_t Counter::value() const
+{
+    uint64_t total = 0;
+    for (const Shard &s : shards_)
+        total += s.v.load(std::memory_order_relaxed);
+    return total;
+}
+
+std::size_t Histogram::bucket_of(uint64_t ns)
+{
+    if (ns < 16)
+        return static_cast<std::size_t>(ns);
+#if defined(__GNUC__) || defined(__clang__)
+    const int e = 63 - __builtin_clzll(ns);
+#else
+    int e = 63;
+    while (!(ns >> e))
+        --e;
+#endif
+    if (e > kMaxExp)
+        return kBuckets - 1;
+    const std::size_t sub = static_cast<std::size_t>((ns >> (e - 3)) & 7);
+    return 16 + static_cast<std::size_t>(e - 4) * 8 + sub;
+}
+
+uint64_t Histogram::bucket_upper(std::size_t idx)
+{
+    if (idx < 16)
+        return idx + 1;
+    const int e = static_cast<int>((idx - 16) / 8) + 4;
+    const uint64_t sub = (idx - 16) % 8;
+    return (9 + sub) << (e - 3);
+}
+
+Histogram::Snapshot Histogram::snapshot() const
+{
+    Snapshot snap;
+    snap.buckets.assign(kBuckets, 0);
+    for (const Shard &s : shards_)
+    {
+        for (std::size_t i = 0; i < kBuckets; ++i)
+            snap.buckets[i] += s.buckets[i].load(std::memory_order_relaxed);
+        snap.sum_ns += s.sum.load(std::memory_order_relaxed);
+    }
+    for (uint64_t c : snap.buckets)
+        snap.count += c;
+    return snap;
+}
+
+uint64_t Histogram::Snapshot::percentile(double q) const
+{
+    if (count == 0)
+        return 0;
+    const uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(count - 1)) + 1;
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+            return bucket_upper(i);
+    }
+    return bucket_upper(buckets.size() - 1);
+}
+
+MetricsRegistry &MetricsRegistry::instance()
+{
+    static MetricsRegistry s_registry;
+    return s_registry;
+}
+
+MetricsRegistry::Entry *MetricsRegistry::find(const std::string &name, Kind kind)
+{
+    for (auto &e : entries_)
+    {
+        if (e->name == name)
+            return e->kind == kind ? e.get() : nullptr;
+    }
+    return nullptr;
+}
+
+Counter &MetricsRegistry::counter(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (Entry *e = find(name, Kind::Counter))
+        return *e->counter;
+    auto e = std::make_unique<Entry>();
+    e->name = name;
+    e->help = help;
+    e->kind = Kind::Counter;
+    e->counter = std::make_unique<Counter>();
+    entries_.push_back(std::move(e));
+    return *entries_.back()->counter;
+}
+
+Gauge &MetricsRegistry::gauge(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (Entry *e = find(name, Kind::Gauge))
+        return *e->gauge;
+    auto e = std::make_unique<Entry>();
+    e->name = name;
+    e->help = help;
+    e->kind = Kind::Gauge;
+    e->gauge = std::make_unique<Gauge>();
+    entries_.push_back(std::move(e));
+    return *entries_.back()->gauge;
+}
+
+Histogram &MetricsRegistry::histogram(const std::string &name, const std::string &help)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (Entry *e = find(name, Kind::Histogram))
+        return *e->histogram;
+    auto e = std::make_unique<Entry>();
+    e->name = name;
+    e->help = help;
+    e->kind = Kind::Histogram;
+    e->histogram = std::make_unique<Histogram>();
+    entries_.push_back(std::move(e));
+    return *entries_.back()->histogram;
+}
+
+void MetricsRegistry::callbackGauge(const std::string &name, const std::string &help, std::function<double()> fn)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (Entry *e = find(name, Kind::Callback))
+    {
+        e->callback = std::move(fn);
+        return;
+    }
+    auto e = std::make_unique<Entry>();
+    e->name = name;
+    e->help = help;
+    e->kind = Kind::Callback;
+    e->callback = std::move(fn);
+    entries_.push_back(std::move(e));
+}
+
+std::string MetricsRegistry::renderPrometheus() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string out;
+    out.reserve(entries_.size() * 512);
+    char line[256];
+
+    for (const auto &e : entries_)
+    {
+        out += "# HELP " + e->name + " " + e->help + "\n";
+        switch (e->kind)
+        {
+        case Kind::Counter:
+            out += "# TYPE " + e->name + " counter\n";
+            std::snprintf(line, sizeof(line), "%s %llu\n", e->name.c_str(),
+                          static_cast<unsigned long long>(e->counter->value()));
+            out += line;
+            break;
+        case Kind::Gauge:
+            out += "# TYPE " + e->name + " gauge\n";
+            std::snprintf(line, sizeof(line), "%s %lld\n", e->name.c_str(),
+                          static_cast<long long>(e->gauge->value()));
+            out += line;
+            break;
+        case Kind::Callback:
+            out += "# TYPE " + e->name + " gauge\n";
+            std::snprintf(line, sizeof(line), "%s %.17g\n", e->name.c_str(), e->callback());
+            out += line;
+            break;
+        case Kind::Histogram:
+        {
+            // Dışarıya ikinin kuvveti sınırlarında (1 µs .. ~34 s) kümülatif
+            // kovalar verilir; iç kovalar bu sınırlarla birebir hizalıdır.
+            out += "# TYPE " + e->name + " histogram\n";
+            const Histogram::Snapshot snap = e->histogram->snapshot();
+            std::size_t idx = 0;
+            uint64_t cumulative = 0;
+            for (int p = 10; p <= 35; ++p)
+            {
+                const uint64_t bound = uint64_t{1} << p;
+                while (idx < snap.buckets.size() && Histogram::bucket_upper(idx) <= bound)
+                    cumulative += snap.buckets[idx++];
+                std::snprintf(line, sizeof(line), "%s_bucket{le=\"%.9g\"} %llu\n", e->name.c_str(),
+                              static_cast<double>(bound) / 1e9, static_cast<unsigned long long>(cumulative));
+                out += line;
+            }
+            std::snprintf(line, sizeof(line), "%s_bucket{le=\"+Inf\"} %llu\n%s_sum %.9f\n%s_count %llu\n",
+                          e->name.c_str(), static_cast<unsigned long long>(snap.count),
+                          e->name.c_str(), static_cast<double>(snap.sum_ns) / 1e9,
+                          e->name.c_str(), static_cast<unsigned long long>(snap.count));
+            out += line;
+            break;
+        }
+        }
+    }
+    return out;
+}
+
+uint16_t MetricsServer::portFromEnv(uint16_t def)
+{
+    if (const char *v = std::getenv("AEWC_METRICS_PORT"))
+        return static_cast<uint16_t>(std::atoi(v));
+    return def;
+}
+
+MetricsServer::~MetricsServer()
+{
+    stop();
+}
+
+bool MetricsServer::start(uint16_t port)
+{
+    if (port == 0 || running_.load())
+        return false;
+
+#if defined(_WIN32)
+    WSADATA wsa;
+    WSAStartup(MAKEWORD(2, 2), &wsa);
+#endif
+
+    std::intptr_t fd = static_cast<std::intptr_t>(::socket(AF_INET, SOCK_STREAM, 0));
+    if (fd < 0)
+        return false;
+
+    int yes = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&yes), sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (::bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || ::listen(fd, 8) != 0)
+    {
+        std::cerr << "[METRICS] 127.0.0.1:" << port << " dinlenemedi." << std::endl;
+        close_socket(fd);
+        return false;
+    }
+
+    listen_fd_ = fd;
+    running_.store(true);
+    thread_ = std::thread(&MetricsServer::serveLoop, this);
+    std::cout << "[INFO] Metrics: http://127.0.0.1:" << port << "/metrics" << std::endl;
+    return true;
+}
+
+void MetricsServer::stop()
+{
+    if (!running_.exchange(false))
+        return;
+    if (thread_.joinable())
+        thread_.join();
+    close_socket(listen_fd_);
+    listen_fd_ = -1;
+}
+
+void MetricsServer::serveLoop()
+{
+    while (running_.load())
+    {
+        // stop() çağrısını fark edebilmek için kısa zaman aşımıyla bekle.
+#if defined(_WIN32)
+        fd_set rfds;
+        FD_ZERO(&rfds);
+        FD_SET(static_cast<SOCKET>(listen_fd_), &rfds);
+        timeval tv{0, 200000};
+        if (select(0, &rfds, nullptr, nullptr, &tv) <= 0)
+            continue;
+#else
+        pollfd pfd{static_cast<int>(listen_fd_), POLLIN, 0};
+        if (::poll(&pfd, 1, 200) <= 0)
+            continue;
+#endif
+
+        sockaddr_in peer{};
+        socket_len_t len = sizeof(peer);
+        std::intptr_t client = static_cast<std::intptr_t>(
+            ::accept(listen_fd_, reinterpret_cast<sockaddr *>(&peer), &len));
+        if (client < 0)
+            continue;
+
+        // Bağlanıp istek göndermeyen (ya da okumayan) client döngüyü tek
+        // başına kilitlemesin; sonraki scraper en fazla bu kadar bekler.
+        set_io_timeout(client, 2000);
+
+        char req[1024];
+        const int n = static_cast<int>(::recv(client, req, sizeof(req) - 1, 0));
+        req[n > 0 ? n : 0] = '\0';
+
+        std::string response;
+        if (std::strncmp(req, "GET /metrics", 12) == 0)
+        {
+            const std::string body = MetricsRegistry::instance().renderPrometheus();
+            response = "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/plain; version=0.0.4\r\n"
+                       "Connection: close\r\n"
+                       "Content-Length: " +
+                       std::to_string(body.size()) + "\r\n\r\n" + body;
+        }
+        else
+        {
+            response = "HTTP/1.1 404 Not Found\r\nConnection: close\r\nContent-Length: 0\r\n\r\n";
+        }
+
+        std::size_t sent = 0;
+        while (sent < response.size())
+        {
+            const int w = static_cast<int>(::send(client, response.data() + sent,
+                                                  static_cast<int>(response.size() - sent), kSendFlags));
+            if (w <= 0)
+                break;
+            sent += static_cast<std::size_t>(w);
+        }
+        close_socket(client);
+    }
+}
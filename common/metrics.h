@@ -0,0 +1,196 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Hot path'te kilit kullanmayan metrikler. Sayaçlar ve histogramlar thread
+// başına shard'lara bölünür (her thread kendi cache line'ına relaxed
+// fetch_add yapar), toplama sadece scrape anında yapılır.
+namespace metrics_detail
+{
+constexpr std::size_t kShards = 8;
+
+// Her thread'e ilk kullanımda sabit bir shard atanır.
+std::size_t shard_index();
+} // namespace metrics_detail
+
+class Counter
+{
+public:
+    void inc(uint64_t n = 1)
+    {
+        shards_[metrics_detail::shard_index()].v.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const;
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> v{0};
+    };
+    Shard shards_[metrics_detail::kShards];
+};
+
+class Gauge
+{
+public:
+    void set(int64_t v) { v_.store(v, std::memory_order_relaxed); }
+    void add(int64_t d) { v_.fetch_add(d, std::memory_order_relaxed); }
+    int64_t value() const { return v_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> v_{0};
+};
+
+// HDR tarzı log-lineer histogram (nanosaniye). 16'ya kadar her değer kendi
+// kovasında, sonrasında her ikinin kuvveti 8 alt kovaya bölünür (~%12.5
+// göreli hata). ~1100 s üzeri son kovaya yığılır.
+class Histogram
+{
+public:
+    static constexpr int kMaxExp = 40;
+    static constexpr std::size_t kBuckets = 16 + (kMaxExp - 3) * 8;
+
+    void record(uint64_t ns)
+    {
+        Shard &s = shards_[metrics_detail::shard_index()];
+        s.buckets[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+        s.sum.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    template <typename Duration>
+    void record(Duration d)
+    {
+        record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+    }
+
+    struct Snapshot
+    {
+        std::vector<uint64_t> buckets;
+        uint64_t count = 0;
+        uint64_t sum_ns = 0;
+
+        // q in [0, 1]; kova üst sınırını döner (ns).
+        uint64_t percentile(double q) const;
+    };
+
+    Snapshot snapshot() const;
+
+    static std::size_t bucket_of(uint64_t ns);
+    static uint64_t bucket_upper(std::size_t idx);
+
+private:
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> buckets[kBuckets] = {};
+        std::atomic<uint64_t> sum{0};
+    };
+    Shard shards_[metrics_detail::kShards];
+};
+
+// Süreyi ölçüp kapsam sonunda histograma yazar.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram &h) : h_(h), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() { h_.record(std::chrono::steady_clock::now() - start_); }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+    Histogram &h_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Gauge'u kapsam boyunca bir artırır (aktif stream sayısı gibi).
+class GaugeGuard
+{
+public:
+    explicit GaugeGuard(Gauge &g) : g_(g) { g_.add(1); }
+    ~GaugeGuard() { g_.add(-1); }
+
+    GaugeGuard(const GaugeGuard &) = delete;
+    GaugeGuard &operator=(const GaugeGuard &) = delete;
+
+private:
+    Gauge &g_;
+};
+
+// Metrik kaydı. Kayıt (registration) sırasında mutex alınır, dönen
+// referanslar program boyunca geçerlidir; aynı isim ikinci kez istenirse
+// mevcut metrik döner.
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry &instance();
+
+    Counter &counter(const std::string &name, const std::string &help);
+    Gauge &gauge(const std::string &name, const std::string &help);
+    Histogram &histogram(const std::string &name, const std::string &help);
+
+    // Scrape anında çağrılan değer okuyucu (logger düşürme sayısı gibi).
+    void callbackGauge(const std::string &name, const std::string &help, std::function<double()> fn);
+
+    std::string renderPrometheus() const;
+
+private:
+    MetricsRegistry() = default;
+
+    enum class Kind
+    {
+        Counter,
+        Gauge,
+        Histogram,
+        Callback
+    };
+
+    struct Entry
+    {
+        std::string name;
+        std::string help;
+        Kind kind;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+        std::function<double()> callback;
+    };
+
+    Entry *find(const std::string &name, Kind kind);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+};
+
+// 127.0.0.1:<port> üzerinde "GET /metrics" isteğine Prometheus text
+// formatında cevap veren küçük, tek thread'li HTTP sunucusu.
+class MetricsServer
+{
+public:
+    ~MetricsServer();
+
+    // port == 0 ise sunucu başlatılmaz.
+    bool start(uint16_t port);
+    void stop();
+
+    // AEWC_METRICS_PORT ortam değişkeni varsa onu, yoksa def'i döner.
+    static uint16_t portFromEnv(uint16_t def);
+
+private:
+    void serveLoop();
+
+    std::atomic<bool> running_{false};
+    std::intptr_t listen_fd_ = -1;
+    std::thread thread_;
+};
+
+#endif
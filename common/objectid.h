@@ -0,0 +1,75 @@
+#ifndef OBJECTID_H
+#define OBJECTID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// MongoDB ObjectId'nin 12 baytlık ham hali. Hex string yerine anahtar olarak
+// kullanılır; heap'e hiç dokunmaz.
+struct ObjectId
+{
+    uint8_t bytes[12] = {};
+
+    bool operator==(const ObjectId &o) const { return std::memcmp(bytes, o.bytes, sizeof(bytes)) == 0; }
+    bool operator!=(const ObjectId &o) const { return !(*this == o); }
+
+    // 24 karakterlik hex'i çözer; geçersizse false döner.
+    static bool from_hex(const char *s, std::size_t n, ObjectId &out)
+    {
+        if (n != 24)
+            return false;
+        for (std::size_t i = 0; i < 12; ++i)
+        {
+            int hi = hex_value(s[2 * i]);
+            int lo = hex_value(s[2 * i + 1]);
+            if (hi < 0 || lo < 0)
+                return false;
+            out.bytes[i] = static_cast<uint8_t>((hi << 4) | lo);
+        }
+        return true;
+    }
+
+    std::string to_string() const
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string s(24, '0');
+        for (std::size_t i = 0; i < 12; ++i)
+        {
+            s[2 * i] = digits[bytes[i] >> 4];
+            s[2 * i + 1] = digits[bytes[i] & 0x0F];
+        }
+        return s;
+    }
+
+    uint64_t hash() const
+    {
+        uint64_t a;
+        uint32_t b;
+        std::memcpy(&a, bytes, 8);
+        std::memcpy(&b, bytes + 8, 4);
+        // ObjectId'nin sayaç kısmı son baytlarda; splitmix64 ile karıştır.
+        uint64_t h = a ^ (static_cast<uint64_t>(b) * 0x9E3779B97F4A7C15ULL);
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBULL;
+        h ^= h >> 31;
+        return h;
+    }
+
+private:
+    static int hex_value(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+};
+
+#endif
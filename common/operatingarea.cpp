@@ -0,0 +1,161 @@
+#include "operatingarea.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+OperatingArea::OperatingArea()
+    : min_x_(26.0), min_y_(36.0), max_x_(45.0), max_y_(42.0)
+{
+}
+
+bool OperatingArea::build(std::vector<GeoPolygon> polygons)
+{
+    double min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+    std::size_t edges = 0;
+    for (const GeoPolygon &p : polygons)
+        for (const auto &ring : p.rings)
+            for (const auto &v : ring)
+            {
+                min_x = std::min(min_x, v.first);
+                max_x = std::max(max_x, v.first);
+                min_y = std::min(min_y, v.second);
+                max_y = std::max(max_y, v.second);
+                ++edges;
+            }
+    if (edges == 0 || !(max_x > min_x) || !(max_y > min_y))
+        return false;
+
+    // Hücreler yaklaşık kare (derece cinsinden); toplam kMaxCells'i aşmaz.
+    const double w = max_x - min_x, h = max_y - min_y;
+    const double side = std::sqrt(w * h / static_cast<double>(kMaxCells));
+    const uint32_t nx = std::clamp<uint32_t>(static_cast<uint32_t>(w / side), 1, 4096);
+    const uint32_t ny = std::clamp<uint32_t>(static_cast<uint32_t>(kMaxCells / nx), 1, 4096);
+    const double cell_x = w / nx, cell_y = h / ny;
+    std::vector<uint8_t> mask(static_cast<std::size_t>(nx) * ny, kOutside);
+
+    auto col = [&](double x)
+    {
+        const double f = std::floor((x - min_x) / cell_x);
+        return static_cast<uint32_t>(std::clamp(f, 0.0, static_cast<double>(nx - 1)));
+    };
+    auto row = [&](double y)
+    {
+        const double f = std::floor((y - min_y) / cell_y);
+        return static_cast<uint32_t>(std::clamp(f, 0.0, static_cast<double>(ny - 1)));
+    };
+
+    // Kenarın geçtiği her hücre sınır hücresidir. Kenar satır satır
+    // kırpılır; hücre kenarına denk gelen noktalar yuvarlama yüzünden
+    // kaçmasın diye aralık her yönde hücrenin milyonda biri kadar genişletilir.
+    const double eps_x = cell_x * 1e-6, eps_y = cell_y * 1e-6;
+    for (const GeoPolygon &p : polygons)
+        for (const auto &ring : p.rings)
+            for (std::size_t i = 0; i < ring.size(); ++i)
+            {
+                const auto &a = ring[i];
+                const auto &b = ring[(i + 1) % ring.size()];
+                const double ylo = std::min(a.second, b.second), yhi = std::max(a.second, b.second);
+                for (uint32_t r = row(ylo - eps_y), r1 = row(yhi + eps_y); r <= r1; ++r)
+                {
+                    double x0 = std::min(a.first, b.first), x1 = std::max(a.first, b.first);
+                    if (a.second != b.second)
+                    {
+                        const double y0 = std::clamp(min_y + r * cell_y, ylo, yhi);
+                        const double y1 = std::clamp(min_y + (r + 1) * cell_y, ylo, yhi);
+                        const double k = (b.first - a.first) / (b.second - a.second);
+                        const double xa = a.first + (y0 - a.second) * k, xb = a.first + (y1 - a.second) * k;
+                        x0 = std::min(xa, xb);
+                        x1 = std::max(xa, xb);
+                    }
+                    uint8_t *line = mask.data() + static_cast<std::size_t>(r) * nx;
+                    for (uint32_t c = col(x0 - eps_x), c1 = col(x1 + eps_x); c <= c1; ++c)
+                        line[c] = kBorder;
+                }
+            }
+
+    index_.build(std::move(polygons));
+    min_x_ = min_x;
+    min_y_ = min_y;
+    max_x_ = max_x;
+    max_y_ = max_y;
+
+    // Satırdaki ardışık sınır dışı hücrelerin arasından kenar geçmez; her
+    // koşunun ilk hücresinin merkezi kesin test edilir, koşu aynı sonucu alır.
+    std::size_t border = 0;
+    for (uint32_t r = 0; r < ny; ++r)
+    {
+        uint8_t *line = mask.data() + static_cast<std::size_t>(r) * nx;
+        const double cy = min_y + (r + 0.5) * cell_y;
+        for (uint32_t c = 0; c < nx;)
+        {
+            if (line[c] == kBorder)
+            {
+                ++border;
+                ++c;
+                continue;
+            }
+            const uint8_t state = exact(cy, min_x + (c + 0.5) * cell_x) ? kInside : kOutside;
+            for (; c < nx && line[c] != kBorder; ++c)
+                line[c] = state;
+        }
+    }
+
+    nx_ = nx;
+    ny_ = ny;
+    inv_cell_x_ = 1.0 / cell_x;
+    inv_cell_y_ = 1.0 / cell_y;
+    mask_ = std::move(mask);
+    border_cells_ = border;
+    return true;
+}
+
+bool OperatingArea::exact(double lat, double lon) const
+{
+    if (index_.size() == 0)
+        return lon >= min_x_ && lon <= max_x_ && lat >= min_y_ && lat <= max_y_;
+    bool inside = false;
+    index_.query(lat, lon, [&inside](uint32_t) { inside = true; });
+    return inside;
+}
+
+std::string OperatingArea::describe() const
+{
+    std::ostringstream out;
+    if (mask_.empty())
+    {
+        out << "kutu " << min_y_ << "-" << max_y_ << "K " << min_x_ << "-" << max_x_ << "D";
+        return out.str();
+    }
+    out << index_.size() << " poligon, " << nx_ << "x" << ny_ << " maske, sınır hücre %"
+        << 100.0 * static_cast<double>(border_cells_) / static_cast<double>(mask_.size());
+    return out.str();
+}
+
+std::shared_ptr<const OperatingArea> load_operating_area(const std::string &path)
+{
+    auto area = std::make_shared<OperatingArea>();
+    if (!path.empty())
+    {
+        std::vector<GeoPolygon> polygons;
+        std::string error;
+        std::size_t skipped = 0;
+        if (!load_geojson_polygons(path, polygons, &error, &skipped))
+        {
+            Logger::instance().log(LogLevel::Warn, "AREA", {{"msg", "işletim alanı yüklenemedi"}, {"what", error}});
+            return nullptr;
+        }
+        if (!area->build(std::move(polygons)))
+        {
+            Logger::instance().log(LogLevel::Warn, "AREA",
+                                   {{"msg", "işletim alanında poligon yok"}, {"path", path}});
+            return nullptr;
+        }
+        if (skipped > 0)
+            Logger::instance().log(LogLevel::Warn, "AREA",
+                                   {{"msg", "poligon olmayan geometriler atlandı"}, {"skipped", skipped}});
+    }
+    Logger::instance().log(LogLevel::Info, "AREA", {{"msg", "işletim alanı"}, {"area", area->describe()}});
+    return area;
+}
@@ -0,0 +1,71 @@
+#ifndef OPERATINGAREA_H
+#define OPERATINGAREA_H
+
+#include "geofence.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Servislerin kayıt kabul ettiği işletim alanı (radar / IFF / DataLink).
+//
+// Varsayılan alan eski sabit Türkiye kutusudur (36-42 K, 26-45 D). Poligon
+// verildiğinde (GeoJSON, birden çok poligon birleşim olarak) poligonların
+// kutusu üzerine bir raster maske kurulur: hücre tamamen içeride / dışarıda
+// ise sonuç tek bayt okumayla döner, sadece poligon kenarı geçen sınır
+// hücrelerinde GeofenceIndex'in bant ızgarasıyla kesin test yapılır.
+class OperatingArea
+{
+public:
+    OperatingArea(); // sabit Türkiye kutusu
+
+    // Poligonlardan maske kurar; kenarı olmayan küme false döner (alan
+    // değişmez).
+    bool build(std::vector<GeoPolygon> polygons);
+
+    bool contains(double lat, double lon) const
+    {
+        if (!(lon >= min_x_ && lon <= max_x_ && lat >= min_y_ && lat <= max_y_))
+            return false;
+        if (mask_.empty())
+            return true;
+        const double fx = (lon - min_x_) * inv_cell_x_;
+        const double fy = (lat - min_y_) * inv_cell_y_;
+        const uint32_t cx = std::min(nx_ - 1, static_cast<uint32_t>(fx));
+        const uint32_t cy = std::min(ny_ - 1, static_cast<uint32_t>(fy));
+        const uint8_t cell = mask_[static_cast<std::size_t>(cy) * nx_ + cx];
+        if (cell != kBorder)
+            return cell == kInside;
+        return exact(lat, lon);
+    }
+
+    // Maskesiz (poligon) kesin test; maske doğrulaması ve sınır hücreleri için.
+    bool exact(double lat, double lon) const;
+
+    bool isBox() const { return mask_.empty(); }
+    std::size_t polygons() const { return index_.size(); }
+    std::size_t cells() const { return mask_.size(); }
+    std::size_t borderCells() const { return border_cells_; }
+    std::string describe() const;
+
+private:
+    static constexpr uint8_t kOutside = 0;
+    static constexpr uint8_t kInside = 1;
+    static constexpr uint8_t kBorder = 2;
+    static constexpr std::size_t kMaxCells = 1u << 20; // 1 MB maske
+
+    double min_x_, min_y_, max_x_, max_y_; // lon / lat
+    double inv_cell_x_ = 0.0, inv_cell_y_ = 0.0;
+    uint32_t nx_ = 0, ny_ = 0;
+    std::vector<uint8_t> mask_; // satır satır (lat), boşsa kutu modu
+    std::size_t border_cells_ = 0;
+    GeofenceIndex index_;
+};
+
+// path boşsa varsayılan kutu; doluysa GeoJSON'dan kurulan alan. Hata
+// loglanır ve nullptr döner (çağıran mevcut alanı korur).
+std::shared_ptr<const OperatingArea> load_operating_area(const std::string &path);
+
+#endif
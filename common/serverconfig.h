@@ -0,0 +1,47 @@
+#ifndef SERVERCONFIG_H
+#define SERVERCONFIG_H
+
+#include "config.h"
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/resource_quota.h>
+
+// gRPC sunucu kaynakları; 0 olan alanlarda gRPC varsayılanı kullanılır.
+struct ServerDefaults
+{
+    int max_threads = 0;
+    int memory_mb = 0;
+    int num_cqs = 0;
+    int min_pollers = 0;
+    int max_pollers = 0;
+};
+
+// server.max_threads, server.memory_mb, server.num_cqs, server.min_pollers,
+// server.max_pollers anahtarlarını ServerBuilder'a uygular. Sadece
+// başlangıçta okunur (BuildAndStart sonrası değiştirilemez).
+inline void apply_server_config(const Config &cfg, grpc::ServerBuilder &builder, const ServerDefaults &def = {})
+{
+    const int64_t max_threads = cfg.getInt("server.max_threads", def.max_threads);
+    const int64_t memory_mb = cfg.getInt("server.memory_mb", def.memory_mb);
+    if (max_threads > 0 || memory_mb > 0)
+    {
+        grpc::ResourceQuota quota("aewc");
+        if (max_threads > 0)
+            quota.SetMaxThreads(static_cast<int>(max_threads));
+        if (memory_mb > 0)
+            quota.Resize(static_cast<std::size_t>(memory_mb) * 1024 * 1024);
+        builder.SetResourceQuota(quota);
+    }
+
+    const int64_t num_cqs = cfg.getInt("server.num_cqs", def.num_cqs);
+    const int64_t min_pollers = cfg.getInt("server.min_pollers", def.min_pollers);
+    const int64_t max_pollers = cfg.getInt("server.max_pollers", def.max_pollers);
+    if (num_cqs > 0)
+        builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS, static_cast<int>(num_cqs));
+    if (min_pollers > 0)
+        builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, static_cast<int>(min_pollers));
+    if (max_pollers > 0)
+        builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, static_cast<int>(max_pollers));
+}
+
+#endif
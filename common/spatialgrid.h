@@ -0,0 +1,137 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Enlem/boylam noktaları için düzgün ızgara (uniform grid) indeksi.
+// build() noktaları sayma sıralamasıyla (counting sort) hücrelerine
+// dizer; her hücre items_ içinde ardışık bir aralıktır (CSR), böylece
+// dikdörtgen sorgusu sadece örtüşen hücreleri sırayla yürür.
+//
+// Her tick yeniden kurulacak şekilde tasarlanmıştır: O(n), tamponlar
+// yeniden kullanılır, ısınmadan sonra heap ayırması yapılmaz.
+class SpatialGrid
+{
+public:
+    explicit SpatialGrid(double cell_deg = 0.25) : cell_deg_(cell_deg) {}
+
+    // point(i) -> std::pair<double, double>{lat, lon}, i < n.
+    template <typename PointFn>
+    void build(std::size_t n, PointFn &&point)
+    {
+        items_.resize(n);
+        if (n == 0)
+        {
+            rows_ = cols_ = 0;
+            cell_start_.assign(1, 0);
+            return;
+        }
+
+        double min_lat = 90.0, max_lat = -90.0, min_lon = 180.0, max_lon = -180.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::pair<double, double> p = point(i);
+            items_[i] = Item{p.first, p.second, static_cast<uint32_t>(i)};
+            min_lat = std::min(min_lat, p.first);
+            max_lat = std::max(max_lat, p.first);
+            min_lon = std::min(min_lon, p.second);
+            max_lon = std::max(max_lon, p.second);
+        }
+
+        // Çok geniş bir kapsamda hücre sayısı kMaxSide x kMaxSide ile sınırlanır.
+        step_ = std::max(cell_deg_, std::max(max_lat - min_lat, max_lon - min_lon) / kMaxSide);
+        origin_lat_ = min_lat;
+        origin_lon_ = min_lon;
+        rows_ = static_cast<int>((max_lat - min_lat) / step_) + 1;
+        cols_ = static_cast<int>((max_lon - min_lon) / step_) + 1;
+
+        const std::size_t cells = static_cast<std::size_t>(rows_) * static_cast<std::size_t>(cols_);
+        cell_start_.assign(cells + 1, 0);
+        cell_of_.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const uint32_t c = cellIndex(row(items_[i].lat), col(items_[i].lon));
+            cell_of_[i] = c;
+            ++cell_start_[c + 1];
+        }
+        for (std::size_t c = 0; c < cells; ++c)
+            cell_start_[c + 1] += cell_start_[c];
+
+        sorted_.resize(n);
+        cursor_.assign(cell_start_.begin(), cell_start_.end() - 1);
+        for (std::size_t i = 0; i < n; ++i)
+            sorted_[cursor_[cell_of_[i]]++] = items_[i];
+        items_.swap(sorted_);
+    }
+
+    // [min_lat, max_lat] x [min_lon, max_lon] içindeki noktaların
+    // indekslerini visit(uint32_t) ile verir (sıra hücre sırasıdır).
+    template <typename Fn>
+    void query(double min_lat, double min_lon, double max_lat, double max_lon, Fn &&visit) const
+    {
+        if (rows_ == 0 || min_lat > max_lat || min_lon > max_lon)
+            return;
+
+        const int r0 = std::max(0, row(min_lat));
+        const int r1 = std::min(rows_ - 1, row(max_lat));
+        const int c0 = std::max(0, col(min_lon));
+        const int c1 = std::min(cols_ - 1, col(max_lon));
+        for (int r = r0; r <= r1; ++r)
+        {
+            const uint32_t first = cellIndex(r, c0);
+            const uint32_t last = cellIndex(r, c1);
+            // Bir satırdaki hücreler items_ içinde bitişik olduğundan tek aralıktır.
+            for (uint32_t k = cell_start_[first]; k < cell_start_[last + 1]; ++k)
+            {
+                const Item &it = items_[k];
+                if (it.lat >= min_lat && it.lat <= max_lat && it.lon >= min_lon && it.lon <= max_lon)
+                    visit(it.index);
+            }
+        }
+    }
+
+    std::size_t size() const { return items_.size(); }
+
+private:
+    static constexpr int kMaxSide = 1024;
+
+    struct Item
+    {
+        double lat;
+        double lon;
+        uint32_t index;
+    };
+
+    int row(double lat) const { return clampFloor((lat - origin_lat_) / step_, rows_); }
+    int col(double lon) const { return clampFloor((lon - origin_lon_) / step_, cols_); }
+    uint32_t cellIndex(int r, int c) const { return static_cast<uint32_t>(r * cols_ + c); }
+
+    // Izgara dışındaki sorgu köşeleri -1 / side olarak döner; query bunları kırpar.
+    static int clampFloor(double v, int side)
+    {
+        if (v < 0.0)
+            return -1;
+        const double f = std::floor(v);
+        return f >= side ? side : static_cast<int>(f);
+    }
+
+    double cell_deg_;
+    double step_ = 0.25;
+    double origin_lat_ = 0.0;
+    double origin_lon_ = 0.0;
+    int rows_ = 0;
+    int cols_ = 0;
+
+    std::vector<Item> items_;
+    std::vector<Item> sorted_;
+    std::vector<uint32_t> cell_start_;
+    std::vector<uint32_t> cell_of_;
+    std::vector<uint32_t> cursor_;
+};
+
+#endif
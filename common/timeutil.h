@@ -0,0 +1,23 @@
+#ifndef TIMEUTIL_H
+#define TIMEUTIL_H
+
+#include <chrono>
+#include <cstdint>
+
+// Mesajlara basılan zaman damgaları (sim_time_us, enqueue_time_us) için duvar
+// saati. Client aynı saatle karşılaştırdığından steady_clock kullanılamaz.
+inline int64_t unix_micros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// İki unix_micros() değeri arasındaki farkı histograma yazılabilir süreye
+// çevirir; saat geri atlarsa 0 döner.
+inline std::chrono::microseconds micros_since(int64_t from_us, int64_t to_us)
+{
+    return std::chrono::microseconds(to_us > from_us ? to_us - from_us : 0);
+}
+
+#endif
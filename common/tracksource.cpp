@@ -0,0 +1,436 @@
+#include "tracksource.h"
+#include "logger.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <sys/stat.h>
+
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/uri.hpp>
+#include <mongocxx/options/find.hpp>
+
+// Süreç başına tek mongocxx::instance olabilir; servisler yerine burada tutulur.
+static mongocxx::instance s_mongo_instance{};
+
+namespace
+{
+bool get_double_safe(const bsoncxx::document::view &v, const char *key, double &out)
+{
+    auto elem = v[key];
+    if (!elem)
+        return false;
+    switch (elem.type())
+    {
+    case bsoncxx::type::k_double:
+        out = elem.get_double().value;
+        return true;
+    case bsoncxx::type::k_int32:
+        out = static_cast<double>(elem.get_int32().value);
+        return true;
+    case bsoncxx::type::k_int64:
+        out = static_cast<double>(elem.get_int64().value);
+        return true;
+    default:
+        return false;
+    }
+}
+
+void get_string_utf8(const bsoncxx::document::view &v, const char *key, const char *def, std::string &out)
+{
+    auto elem = v[key];
+    if (elem && elem.type() == bsoncxx::type::k_string)
+    {
+        auto sv = elem.get_string().value;
+        out.assign(sv.data(), sv.size());
+        return;
+    }
+    out.assign(def);
+}
+
+bool get_oid_key(const bsoncxx::document::view &v, ObjectId &out)
+{
+    auto elem = v["_id"];
+    if (!elem)
+        return false;
+    if (elem.type() == bsoncxx::type::k_oid)
+    {
+        std::memcpy(out.bytes, elem.get_oid().value.bytes(), sizeof(out.bytes));
+        return true;
+    }
+    if (elem.type() == bsoncxx::type::k_string)
+    {
+        auto sv = elem.get_string().value;
+        if (sv.empty())
+            return false;
+        if (ObjectId::from_hex(sv.data(), sv.size(), out))
+            return true;
+
+        // ObjectId olmayan string _id'ler: 96 bitlik FNV-1a özetine indir.
+        uint64_t h1 = 0xcbf29ce484222325ULL;
+        uint32_t h2 = 0x811c9dc5u;
+        for (char c : sv)
+        {
+            h1 = (h1 ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+            h2 = (h2 ^ static_cast<uint8_t>(c)) * 0x01000193u;
+        }
+        std::memcpy(out.bytes, &h1, 8);
+        std::memcpy(out.bytes + 8, &h2, 4);
+        return true;
+    }
+    return false;
+}
+
+ObjectId ordinal_id(uint64_t ordinal)
+{
+    ObjectId id;
+    std::memcpy(id.bytes + 4, &ordinal, sizeof(ordinal));
+    return id;
+}
+
+std::string read_file(const std::string &path)
+{
+    std::ifstream f(path, std::ios::binary);
+    if (!f)
+        throw std::runtime_error("dosya açılamadı: " + path);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+// Okumada ayrıştırılamayan belgeler; load başına tek satır loglanır.
+struct SkippedDocuments
+{
+    std::size_t count = 0;
+    std::string first_error;
+
+    void add(const std::exception &e)
+    {
+        if (count++ == 0)
+            first_error = e.what();
+    }
+
+    void report(const std::string &source) const
+    {
+        if (count == 0)
+            return;
+        Logger::instance().log(LogLevel::Warn, "SOURCE",
+                               {{"msg", "bozuk belgeler atlandı"},
+                                {"source", source},
+                                {"skipped", count},
+                                {"first_error", first_error}});
+    }
+};
+
+bool ends_with(const std::string &s, const char *suffix)
+{
+    const std::size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+} // namespace
+
+TrackStatus track_status_from_string(const std::string &s)
+{
+    if (s == "FRIEND")
+        return TrackStatus::Friend;
+    if (s == "FOE")
+        return TrackStatus::Foe;
+    return TrackStatus::Unknown;
+}
+
+const char *track_status_name(TrackStatus status)
+{
+    switch (status)
+    {
+    case TrackStatus::Friend:
+        return "FRIEND";
+    case TrackStatus::Foe:
+        return "FOE";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+bool parse_track_document(const bsoncxx::document::view &doc, const TrackSchema &schema,
+                          uint64_t ordinal, TrackRecord &out)
+{
+    if (!get_double_safe(doc, "lat", out.lat))
+        return false;
+    if (!get_double_safe(doc, "lon", out.lon))
+        return false;
+
+    if (!get_oid_key(doc, out.id))
+        out.id = ordinal_id(ordinal);
+
+    out.velocity = 0.0;
+    out.baro_altitude = 0.0;
+    out.geo_altitude = 0.0;
+    if (schema.velocity_key)
+        get_double_safe(doc, schema.velocity_key, out.velocity);
+    if (schema.baro_key)
+        get_double_safe(doc, schema.baro_key, out.baro_altitude);
+    if (schema.geo_key)
+        get_double_safe(doc, schema.geo_key, out.geo_altitude);
+
+    if (schema.callsign_key)
+        get_string_utf8(doc, schema.callsign_key, "UNKNOWN", out.callsign);
+    if (schema.status_key)
+        get_string_utf8(doc, schema.status_key, "UNKNOWN", out.status);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+
+MongoTrackSource::MongoTrackSource(std::string mongo_uri, std::string db_name, std::string coll_name,
+                                   TrackSchema schema, std::shared_ptr<mongocxx::pool> pool, int32_t batch_size)
+    : mongo_uri_(std::move(mongo_uri)),
+      db_name_(std::move(db_name)),
+      coll_name_(std::move(coll_name)),
+      schema_(schema),
+      pool_(std::move(pool)),
+      batch_size_(batch_size) {}
+
+void MongoTrackSource::load(std::vector<TrackRecord> &out)
+{
+    out.clear();
+
+    std::unique_ptr<mongocxx::client> own;
+    mongocxx::pool::entry entry;
+    mongocxx::client *conn = nullptr;
+    if (pool_)
+    {
+        entry = pool_->acquire();
+        conn = &*entry;
+    }
+    else
+    {
+        own = std::make_unique<mongocxx::client>(mongocxx::uri{mongo_uri_});
+        conn = own.get();
+    }
+    auto coll = (*conn)[db_name_][coll_name_];
+
+    mongocxx::options::find find_opts;
+    find_opts.sort(bsoncxx::builder::basic::make_document(
+        bsoncxx::builder::basic::kvp("_id", 1)));
+    if (batch_size_ > 0)
+        find_opts.batch_size(batch_size_);
+
+    uint64_t ordinal = 0;
+    TrackRecord rec;
+    SkippedDocuments skipped;
+    auto cursor = coll.find({}, find_opts);
+    for (auto &&doc : cursor)
+    {
+        try
+        {
+            if (parse_track_document(doc, schema_, ordinal++, rec))
+                out.push_back(rec);
+        }
+        catch (const std::exception &e)
+        {
+            // Tek bozuk belge tüm okumayı düşürmesin.
+            skipped.add(e);
+        }
+    }
+    skipped.report(describe());
+}
+
+std::string MongoTrackSource::describe() const
+{
+    return std::string(pool_ ? "mongo (havuz) " : "mongo ") + mongo_uri_ + " / " + db_name_ + "." + coll_name_;
+}
+
+// ---------------------------------------------------------------------------
+
+FileTrackSource::FileTrackSource(std::string path, TrackSchema schema)
+    : path_(std::move(path)), schema_(schema) {}
+
+void FileTrackSource::load(std::vector<TrackRecord> &out)
+{
+    struct stat st;
+    if (::stat(path_.c_str(), &st) != 0)
+        throw std::runtime_error("dosya bulunamadı: " + path_);
+
+    std::shared_ptr<const std::vector<TrackRecord>> records;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (!cache_ || st.st_mtime != cache_mtime_)
+        {
+            const std::string data = read_file(path_);
+            auto parsed = std::make_shared<std::vector<TrackRecord>>();
+            if (ends_with(path_, ".bson"))
+                parseBson(data, *parsed);
+            else
+                parseJsonLines(data, *parsed);
+            cache_ = std::move(parsed);
+            cache_mtime_ = st.st_mtime;
+        }
+        records = cache_;
+    }
+
+    out.assign(records->begin(), records->end());
+}
+
+void FileTrackSource::parseBson(const std::string &data, std::vector<TrackRecord> &out) const
+{
+    // mongodump biçimi: her belge kendi int32 (little-endian) uzunluğuyla başlar.
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(data.data());
+    std::size_t off = 0;
+    uint64_t ordinal = 0;
+    TrackRecord rec;
+    while (off + 5 <= data.size())
+    {
+        int32_t len = 0;
+        std::memcpy(&len, p + off, 4);
+        if (len < 5 || off + static_cast<std::size_t>(len) > data.size())
+            throw std::runtime_error("bozuk BSON dosyası: " + path_);
+
+        bsoncxx::document::view doc(p + off, static_cast<std::size_t>(len));
+        if (parse_track_document(doc, schema_, ordinal++, rec))
+            out.push_back(rec);
+        off += static_cast<std::size_t>(len);
+    }
+}
+
+void FileTrackSource::parseJsonLines(const std::string &data, std::vector<TrackRecord> &out) const
+{
+    uint64_t ordinal = 0;
+    TrackRecord rec;
+    SkippedDocuments skipped;
+    std::size_t pos = 0;
+    while (pos < data.size())
+    {
+        std::size_t eol = data.find('\n', pos);
+        if (eol == std::string::npos)
+            eol = data.size();
+
+        std::size_t b = pos;
+        while (b < eol && (data[b] == ' ' || data[b] == '\t' || data[b] == '\r'))
+            ++b;
+        if (b < eol && data[b] == '{')
+        {
+            try
+            {
+                auto doc = bsoncxx::from_json(bsoncxx::stdx::string_view(data.data() + b, eol - b));
+                if (parse_track_document(doc.view(), schema_, ordinal, rec))
+                    out.push_back(rec);
+            }
+            catch (const std::exception &e)
+            {
+                // Geçersiz satır atlanır.
+                skipped.add(e);
+            }
+            ++ordinal;
+        }
+        pos = eol + 1;
+    }
+    skipped.report(describe());
+}
+
+std::string FileTrackSource::describe() const
+{
+    return "file " + path_;
+}
+
+// ---------------------------------------------------------------------------
+
+MemoryTrackSource::MemoryTrackSource(std::vector<TrackRecord> records, std::string label)
+    : records_(std::move(records)), label_(std::move(label)) {}
+
+void MemoryTrackSource::load(std::vector<TrackRecord> &out)
+{
+    out.assign(records_.begin(), records_.end());
+}
+
+std::string MemoryTrackSource::describe() const
+{
+    return label_ + " (" + std::to_string(records_.size()) + " kayıt)";
+}
+
+std::vector<TrackRecord> make_synthetic_tracks(std::size_t n, uint32_t seed)
+{
+    // simService AircraftGenerator ile aynı aralıklar.
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> lat(36.0, 42.0);
+    std::uniform_real_distribution<double> lon(26.0, 45.0);
+    std::uniform_real_distribution<double> vel(200.0, 1000.0);
+    std::uniform_real_distribution<double> baro(1111.0, 11111.0);
+    std::uniform_real_distribution<double> geo_delta(0.0, 100.0);
+    std::uniform_int_distribution<int> letter(0, 25);
+    std::uniform_int_distribution<int> number(0, 99);
+    std::bernoulli_distribution friendly(0.5);
+
+    std::vector<TrackRecord> out(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        TrackRecord &r = out[i];
+        r.id = ordinal_id(i);
+        r.lat = lat(rng);
+        r.lon = lon(rng);
+        r.velocity = vel(rng);
+        r.baro_altitude = baro(rng);
+        r.geo_altitude = r.baro_altitude + geo_delta(rng);
+        if (friendly(rng))
+        {
+            char cs[8];
+            std::snprintf(cs, sizeof(cs), "%c%c%02d", 'A' + letter(rng), 'A' + letter(rng), number(rng));
+            r.callsign = cs;
+            r.status = "FRIEND";
+        }
+        else
+        {
+            r.callsign = "UNKNOWN";
+            r.status = "UNKNOWN";
+        }
+    }
+    return out;
+}
+
+std::unique_ptr<TrackSource> make_track_source(const std::string &spec,
+                                               const std::string &mongo_uri,
+                                               const std::string &db_name,
+                                               const std::string &coll_name,
+                                               const TrackSchema &schema,
+                                               std::shared_ptr<mongocxx::pool> pool,
+                                               int32_t mongo_batch_size)
+{
+    if (spec.empty() || spec == "mongo")
+        return std::make_unique<MongoTrackSource>(mongo_uri, db_name, coll_name, schema, std::move(pool),
+                                                  mongo_batch_size);
+
+    if (spec.compare(0, 5, "file:") == 0)
+    {
+        std::string path = spec.substr(5);
+        const std::size_t at = path.find("{coll}");
+        if (at != std::string::npos)
+            path.replace(at, 6, coll_name);
+        if (path.empty())
+            throw std::invalid_argument("file: kaynağı için yol gerekli");
+        return std::make_unique<FileTrackSource>(std::move(path), schema);
+    }
+
+    if (spec.compare(0, 10, "synthetic:") == 0)
+    {
+        char *end = nullptr;
+        const unsigned long long n = std::strtoull(spec.c_str() + 10, &end, 10);
+        if (end == spec.c_str() + 10 || *end != '\0')
+            throw std::invalid_argument("synthetic:<adet> bekleniyor: " + spec);
+        return std::make_unique<MemoryTrackSource>(make_synthetic_tracks(static_cast<std::size_t>(n)), "synthetic");
+    }
+
+    throw std::invalid_argument("bilinmeyen veri kaynağı: " + spec);
+}
+
+std::string track_source_spec_from_env()
+{
+    if (const char *v = std::getenv("AEWC_TRACK_SOURCE"))
+        return v;
+    return "mongo";
+}
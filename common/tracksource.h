@@ -0,0 +1,159 @@
+#ifndef TRACKSOURCE_H
+#define TRACKSOURCE_H
+
+#include "objectid.h"
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/document/view.hpp>
+#include <mongocxx/pool.hpp>
+
+// Servislerin okuduğu ortak iz kaydı. Radar callsign kullanmaz, IFF
+// hız/irtifa kullanmaz; şemada okunmayan alanlar varsayılan değerinde kalır.
+struct TrackRecord
+{
+    ObjectId id;
+    std::string callsign;
+    std::string status;
+    double lat = 0.0;
+    double lon = 0.0;
+    double velocity = 0.0;
+    double baro_altitude = 0.0;
+    double geo_altitude = 0.0;
+};
+
+// IFF kimlik durumu; kümeleme gibi sıcak yollarda string yerine kullanılır.
+enum class TrackStatus : uint8_t
+{
+    Unknown = 0,
+    Friend = 1,
+    Foe = 2,
+};
+constexpr std::size_t kTrackStatusCount = 3;
+
+// "FRIEND" / "FOE" dışındaki her şey (boş dahil) Unknown'dır.
+TrackStatus track_status_from_string(const std::string &s);
+const char *track_status_name(TrackStatus status);
+
+// Koleksiyonlara göre okunacak alanlar. Anahtar nullptr ise alan okunmaz
+// (radar'da baroAltitude, datalink'te baroaltitude gibi isimler farklı).
+struct TrackSchema
+{
+    const char *velocity_key = nullptr;
+    const char *baro_key = nullptr;
+    const char *geo_key = nullptr;
+    const char *callsign_key = nullptr;
+    const char *status_key = nullptr; // belgede yoksa "UNKNOWN"
+
+    // Radar belgelerinde status her zaman bulunmaz (simService yazmaz); varsa
+    // kümelerin dominant_status'u ve status_change kuralı onu kullanır.
+    static TrackSchema radar() { return {"velocity", "baroAltitude", "geoAltitude", nullptr, "status"}; }
+    static TrackSchema iff() { return {nullptr, nullptr, nullptr, "callsign", "status"}; }
+    static TrackSchema datalink() { return {"velocity", "baroaltitude", "geoaltitude", "callsign", "status"}; }
+};
+
+// Tek bir belgeyi şemaya göre ayrıştırır; lat/lon yoksa false döner.
+// _id yoksa (JSON dökümleri) kimlik ordinal'den türetilir.
+bool parse_track_document(const bsoncxx::document::view &doc, const TrackSchema &schema,
+                          uint64_t ordinal, TrackRecord &out);
+
+// Servislerin veri kaynağı. load() tüm kayıtları out'a yazar (önce temizler);
+// kaynağa ulaşılamazsa exception fırlatır, bozuk tekil kayıtlar atlanır
+// (sayıları ve ilk hata load başına bir SOURCE uyarısıyla loglanır).
+// load() thread-safe'tir; eşzamanlı stream'ler aynı kaynaktan kilitsiz okur.
+class TrackSource
+{
+public:
+    virtual ~TrackSource() = default;
+
+    virtual void load(std::vector<TrackRecord> &out) = 0;
+
+    // Başlangıç logu için ("mongo mongodb://.../aewc.radar" gibi).
+    virtual std::string describe() const = 0;
+};
+
+// Koleksiyonu _id sırasıyla okur. pool verilirse bağlantı oradan alınır
+// (aewc_host'ta üç servis tek havuzu paylaşır), yoksa her load()'da yeni
+// bağlantı açılır.
+class MongoTrackSource final : public TrackSource
+{
+public:
+    MongoTrackSource(std::string mongo_uri, std::string db_name, std::string coll_name, TrackSchema schema,
+                     std::shared_ptr<mongocxx::pool> pool = nullptr, int32_t batch_size = 0);
+
+    void load(std::vector<TrackRecord> &out) override;
+    std::string describe() const override;
+
+    const std::string &uri() const { return mongo_uri_; }
+    const std::string &db() const { return db_name_; }
+    const std::string &collection() const { return coll_name_; }
+
+private:
+    std::string mongo_uri_;
+    std::string db_name_;
+    std::string coll_name_;
+    TrackSchema schema_;
+    std::shared_ptr<mongocxx::pool> pool_;
+    int32_t batch_size_; // 0: sürücü varsayılanı
+};
+
+// mongodump (.bson, art arda BSON belgeleri) veya mongoexport (.json/.jsonl,
+// satır başına bir belge) dosyasından okur. Dosya değişmedikçe ayrıştırılmış
+// kayıtlar bellekten döner; önbellek paylaşılan, değişmez bir vektördür ve
+// kilit yalnız onu değiştirirken tutulur, kopyalama kilitsiz yapılır.
+class FileTrackSource final : public TrackSource
+{
+public:
+    FileTrackSource(std::string path, TrackSchema schema);
+
+    void load(std::vector<TrackRecord> &out) override;
+    std::string describe() const override;
+
+private:
+    void parseBson(const std::string &data, std::vector<TrackRecord> &out) const;
+    void parseJsonLines(const std::string &data, std::vector<TrackRecord> &out) const;
+
+    std::string path_;
+    TrackSchema schema_;
+    std::shared_ptr<const std::vector<TrackRecord>> cache_;
+    std::time_t cache_mtime_ = 0;
+    std::mutex cache_mutex_;
+};
+
+// Sabit kayıt kümesi; benchmark ve Mongo'suz performans testleri için.
+class MemoryTrackSource final : public TrackSource
+{
+public:
+    explicit MemoryTrackSource(std::vector<TrackRecord> records, std::string label = "memory");
+
+    void load(std::vector<TrackRecord> &out) override;
+    std::string describe() const override;
+
+private:
+    std::vector<TrackRecord> records_;
+    std::string label_;
+};
+
+// Türkiye içinde n adet rastgele (seed'e göre tekrarlanabilir) kayıt.
+std::vector<TrackRecord> make_synthetic_tracks(std::size_t n, uint32_t seed = 42);
+
+// spec: "mongo" | "file:<yol>" | "synthetic:<adet>". Yoldaki "{coll}"
+// koleksiyon adıyla değiştirilir, böylece tek ayar üç servise de yeter.
+// Geçersiz spec için std::invalid_argument fırlatır.
+std::unique_ptr<TrackSource> make_track_source(const std::string &spec,
+                                               const std::string &mongo_uri,
+                                               const std::string &db_name,
+                                               const std::string &coll_name,
+                                               const TrackSchema &schema,
+                                               std::shared_ptr<mongocxx::pool> pool = nullptr,
+                                               int32_t mongo_batch_size = 0);
+
+// AEWC_TRACK_SOURCE ortam değişkeni, yoksa "mongo".
+std::string track_source_spec_from_env();
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef WEBMERCATOR_H
+#define WEBMERCATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// WGS84 derece -> EPSG:3857 (Web Mercator, metre). Client'ların her hedef
+// için yaptığı fromLonLat projeksiyonu sunucuda frame başına tek geçişte
+// yapılır.
+//
+// Toplu geçiş std::log/std::tan yerine dallanmasız polinomlar kullanır;
+// döngü gövdesinde çağrı ve dal olmadığından derleyici -O3'te vektörleştirir
+// (SSE2/AVX/NEON, intrinsics'siz):
+//   y = R * atanh(sin(lat)) = R/2 * ln((1 + s) / (1 - s))
+//   sin: Taylor serisi x^21'e kadar (|lat| <= 85.0511° için kesme < 1e-16)
+//   ln : üs/mantis ayrıştırma + atanh serisi z^21'e kadar (|z| <= 0.172)
+// |lat| <= kMaxLat aralığında std::log/std::tan referansına göre hata
+// 1 mm'nin altındadır (radar_bench BM_MercatorBatch max_err_m ölçer);
+// hatanın çoğu kutuplara yakın 1/(1 - s^2) büyütmesinden gelir.
+//
+// Döngüde kayan nokta karşılaştırması da yoktur: -ftrapping-math altında
+// GCC karşılaştırma içeren döngüyü if-convert edemez. Enlem kırpması bu
+// yüzden çağırana bırakılır (MercatorFrame toplama sırasında kırpar).
+constexpr double kWebMercatorRadius = 6378137.0;
+constexpr double kWebMercatorMaxLat = 85.05112877980659;
+
+// Tekil dönüşüm (referans); küme merkezleri gibi az sayıda nokta için.
+inline void web_mercator_project(double lat, double lon, double &x, double &y)
+{
+    constexpr double kDegToRad = 3.14159265358979323846 / 180.0;
+    constexpr double kQuarterPi = 3.14159265358979323846 / 4.0;
+    lat = lat > kWebMercatorMaxLat ? kWebMercatorMaxLat : (lat < -kWebMercatorMaxLat ? -kWebMercatorMaxLat : lat);
+    x = kWebMercatorRadius * lon * kDegToRad;
+    y = kWebMercatorRadius * std::log(std::tan(kQuarterPi + lat * kDegToRad * 0.5));
+}
+
+// lat/lon dizilerinden x/y dizilerine toplu dönüşüm; diziler çakışmamalıdır.
+// |lat| <= kWebMercatorMaxLat olmalıdır.
+inline void web_mercator_project_batch(const double *__restrict lat, const double *__restrict lon, std::size_t n,
+                                       double *__restrict x, double *__restrict y)
+{
+    constexpr double kDegToRad = 3.14159265358979323846 / 180.0;
+    constexpr double kLn2 = 0.69314718055994530942;
+    constexpr double kSqrt2 = 1.41421356237309504880;
+    constexpr double kHalfLn2 = 0.34657359027997265471;
+    constexpr uint64_t kMantMask = (uint64_t(1) << 52) - 1;
+    constexpr uint64_t kOneBits = 0x3FF0000000000000ull; // 1.0
+    constexpr uint64_t kMagicBits = 0x4330000000000000ull; // 2^52
+    constexpr double kMagic = 4503599627370496.0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = kWebMercatorRadius * kDegToRad * lon[i];
+
+        // sin(a), |a| <= 1.4845
+        const double a = lat[i] * kDegToRad;
+        const double a2 = a * a;
+        double p = 1.0 / 51090942171709440000.0;
+        p = p * a2 - 1.0 / 121645100408832000.0;
+        p = p * a2 + 1.0 / 355687428096000.0;
+        p = p * a2 - 1.0 / 1307674368000.0;
+        p = p * a2 + 1.0 / 6227020800.0;
+        p = p * a2 - 1.0 / 39916800.0;
+        p = p * a2 + 1.0 / 362880.0;
+        p = p * a2 - 1.0 / 5040.0;
+        p = p * a2 + 1.0 / 120.0;
+        p = p * a2 - 1.0 / 6.0;
+        const double s = a + a * a2 * p;
+
+        // r = m * 2^e, m in [1, 2). r > 0 normal sayıdır (kMaxLat'te
+        // ~[0.0068, 147]), bu yüzden üs bitleri doğrudan okunur.
+        const double r = (1.0 + s) / (1.0 - s);
+        uint64_t bits;
+        std::memcpy(&bits, &r, sizeof(bits));
+        const uint64_t mant_bits = (bits & kMantMask) | kOneBits;
+        const uint64_t exp_bits = (bits >> 52) | kMagicBits;
+        double m, e;
+        std::memcpy(&m, &mant_bits, sizeof(m));
+        std::memcpy(&e, &exp_bits, sizeof(e));
+        e = e - kMagic - 1023.0;
+
+        // ln(m) = ln(sqrt(2)) + 2 * atanh(z), z = (m - sqrt(2)) / (m + sqrt(2))
+        const double z = (m - kSqrt2) / (m + kSqrt2);
+        const double z2 = z * z;
+        double q = 1.0 / 21.0;
+        q = q * z2 + 1.0 / 19.0;
+        q = q * z2 + 1.0 / 17.0;
+        q = q * z2 + 1.0 / 15.0;
+        q = q * z2 + 1.0 / 13.0;
+        q = q * z2 + 1.0 / 11.0;
+        q = q * z2 + 1.0 / 9.0;
+        q = q * z2 + 1.0 / 7.0;
+        q = q * z2 + 1.0 / 5.0;
+        q = q * z2 + 1.0 / 3.0;
+        const double ln_m = kHalfLn2 + 2.0 * (z + z * z2 * q);
+
+        y[i] = kWebMercatorRadius * 0.5 * (e * kLn2 + ln_m);
+    }
+}
+
+// Frame başına yeniden kullanılan SoA tampon: noktalar bitişik lat/lon
+// dizilerine toplanır, tek toplu geçişte projekte edilir.
+class MercatorFrame
+{
+public:
+    // point(i) -> std::pair<double, double>{lat, lon}, i < n.
+    template <typename PointFn>
+    void project(std::size_t n, PointFn &&point)
+    {
+        lat_.resize(n);
+        lon_.resize(n);
+        x_.resize(n);
+        y_.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto p = point(i);
+            lat_[i] = std::min(std::max(p.first, -kWebMercatorMaxLat), kWebMercatorMaxLat);
+            lon_[i] = p.second;
+        }
+        web_mercator_project_batch(lat_.data(), lon_.data(), n, x_.data(), y_.data());
+    }
+
+    double x(std::size_t i) const { return x_[i]; }
+    double y(std::size_t i) const { return y_[i]; }
+    std::size_t size() const { return x_.size(); }
+
+private:
+    std::vector<double> lat_;
+    std::vector<double> lon_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+};
+
+#endif
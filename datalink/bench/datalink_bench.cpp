@@ -0,0 +1,25 @@
+// datalink servisinin stream yolu için Google Benchmark ölçümü.
+// Mongo veya gRPC bağlantısı gerekmez; kayıtlar bellekte sentetik üretilir.
+//
+//   cmake -DDATALINK_BUILD_BENCH=ON ... && ./datalink_bench
+
+#include "datalinkservice.h"
+#include "streambench.h"
+
+struct DataLinkBenchAccess
+{
+    static grpc::Status sendRecords(DataLinkServiceImpl &svc, grpc::ServerContext *context,
+                                    const datalink::DLRequest *request,
+                                    grpc::ServerWriterInterface<datalink::DLStreamResponse> *writer)
+    {
+        return svc.sendRecords(context, request, writer);
+    }
+};
+
+static void BM_StreamDataLink(benchmark::State &state)
+{
+    run_stream_bench(state, &DataLinkBenchAccess::sendRecords);
+}
+BENCHMARK(BM_StreamDataLink)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
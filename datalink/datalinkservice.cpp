@@ -1,147 +1,149 @@
 #include "datalinkservice.h"
-
-#include <bsoncxx/json.hpp>
-#include <mongocxx/client.hpp>
-#include <mongocxx/instance.hpp>
-#include <mongocxx/uri.hpp>
+#include "framearena.h"
+#include "idformat.h"
+#include "logger.h"
+#include "metrics.h"
+#include "timeutil.h"
 
 #include <iostream>
 #include <thread>
 #include <chrono>
-#include <sstream>
-#include <iomanip>
 #include <vector>
 #include <algorithm>
 
-static mongocxx::instance s_mongo_instance{};
+// Kayıt başına satırlar örneklenir.
+static LogRateLimiter s_dl_log_limiter(20);
+
+namespace {
+struct StreamMetrics {
+    MetricsRegistry& r = MetricsRegistry::instance();
+    Histogram& mongo_query = r.histogram("datalink_mongo_query_duration_seconds", "TrackSource::load süresi (Mongo find + cursor okuma)");
+    Histogram& write = r.histogram("datalink_stream_write_duration_seconds", "Tek bir ServerWriter::Write süresi");
+    Histogram& record_age = r.histogram("datalink_record_age_at_write_seconds", "Kaydın Mongo'dan okunmasından (sim_time_us) Write tamamlanmasına kadar geçen süre");
+    Counter& messages_sent = r.counter("datalink_messages_sent_total", "Gönderilen DataLink mesajları");
+    Counter& frames_dropped = r.counter("datalink_frames_dropped_total", "Yazma hatası yüzünden yarım kalan akışlar");
+    Gauge& active_streams = r.gauge("datalink_active_streams", "Açık StreamDataLink çağrıları");
+};
+
+StreamMetrics& metrics() {
+    static StreamMetrics m;
+    return m;
+}
+} // namespace
 
 DataLinkServiceImpl::DataLinkServiceImpl(std::string mongo_uri,
                                          std::string db_name,
                                          std::string coll_name)
-    : mongo_uri_(std::move(mongo_uri)),
-      db_name_(std::move(db_name)),
-      coll_name_(std::move(coll_name)) {}
-
-std::string DataLinkServiceImpl::get_string_utf8(const bsoncxx::document::view& v,
-                                                 const char* key,
-                                                 const std::string& def) {
-    auto elem = v[key];
-    if (!elem) return def;
-    if (elem.type() == bsoncxx::type::k_string) {
-        auto sv = elem.get_string().value;
-        return std::string(sv.data(), sv.size());
-    }
-    return def;
-}
+    : DataLinkServiceImpl(std::make_unique<MongoTrackSource>(std::move(mongo_uri), std::move(db_name),
+                                                             std::move(coll_name), TrackSchema::datalink())) {}
 
-bool DataLinkServiceImpl::get_double_safe(const bsoncxx::document::view& v,
-                                          const char* key,
-                                          double& out) {
-    auto elem = v[key];
-    if (!elem) return false;
-    switch (elem.type()) {
-        case bsoncxx::type::k_double: out = elem.get_double().value; return true;
-        case bsoncxx::type::k_int32:  out = static_cast<double>(elem.get_int32().value); return true;
-        case bsoncxx::type::k_int64:  out = static_cast<double>(elem.get_int64().value); return true;
-        default: return false;
-    }
-}
+DataLinkServiceImpl::DataLinkServiceImpl(std::unique_ptr<TrackSource> source)
+    : source_(std::move(source)) {}
 
-bool DataLinkServiceImpl::is_in_tr_bbox(double lat, double lon) {
-    return (lat >= 36.0 && lat <= 42.0 && lon >= 26.0 && lon <= 45.0);
+void DataLinkServiceImpl::setOperatingArea(std::shared_ptr<const OperatingArea> area) {
+    std::lock_guard<std::mutex> lock(area_mutex_);
+    area_ = std::move(area);
 }
 
 grpc::Status DataLinkServiceImpl::StreamDataLink(
     grpc::ServerContext* context,
     const datalink::DLRequest* request,
     grpc::ServerWriter<datalink::DLStreamResponse>* writer)
+{
+    GaugeGuard stream_guard(metrics().active_streams);
+    return sendRecords(context, request, writer);
+}
+
+grpc::Status DataLinkServiceImpl::sendRecords(
+    grpc::ServerContext* context,
+    const datalink::DLRequest* request,
+    grpc::ServerWriterInterface<datalink::DLStreamResponse>* writer)
 {
     try {
-        mongocxx::client conn{mongocxx::uri{mongo_uri_}};
-        auto db   = conn[db_name_];
-        auto coll = db[coll_name_];
-
-        struct DLRecord {
-            std::string callsign;
-            std::string status;
-            double lat;
-            double lon;
-            double velocity;
-            double baroalt;
-            double geoalt;
-        };
-
-        std::vector<DLRecord> records;
-
-        auto cursor = coll.find({});
-        for (auto&& doc : cursor) {
-            std::string callsign = get_string_utf8(doc, "callsign", "UNKNOWN");
-            std::string status   = get_string_utf8(doc, "status", "UNKNOWN");
-
-            double lat=0, lon=0, vel=0, baro=0, geo=0;
-            if (!get_double_safe(doc, "lat", lat)) continue;
-            if (!get_double_safe(doc, "lon", lon)) continue;
-            get_double_safe(doc, "velocity", vel);
-            get_double_safe(doc, "baroaltitude", baro);
-            get_double_safe(doc, "geoaltitude", geo);
-
-            if (!is_in_tr_bbox(lat, lon)) continue;
-
-            records.push_back({callsign, status, lat, lon, vel, baro, geo});
+        std::vector<TrackRecord> records;
+
+        const auto query_start = std::chrono::steady_clock::now();
+        const int64_t sim_time_us = unix_micros();
+        source_->load(records);
+        metrics().mongo_query.record(std::chrono::steady_clock::now() - query_start);
+
+        std::shared_ptr<const OperatingArea> area;
+        {
+            std::lock_guard<std::mutex> lock(area_mutex_);
+            area = area_;
         }
+        records.erase(std::remove_if(records.begin(), records.end(),
+                                     [&area](const TrackRecord& r) { return !area->contains(r.lat, r.lon); }),
+                      records.end());
 
         std::sort(records.begin(), records.end(),
-            [](const DLRecord& a, const DLRecord& b) {
+            [](const TrackRecord& a, const TrackRecord& b) {
                 if (a.lat != b.lat) return a.lat < b.lat;
                 if (a.lon != b.lon) return a.lon < b.lon;
                 return a.callsign < b.callsign;
             });
 
-        std::ostringstream oss;
+        char id[kRankIdBufSize];
         int rank = 0;
+        uint64_t seq = 0;
+
+        // Her kayıt arenada kurulur ve Write'tan hemen sonra bırakılır; blok
+        // stream boyunca yeniden kullanılır.
+        FrameArena arena(4 * 1024);
 
         for (const auto& rec : records) {
             ++rank;
-            oss.str(std::string());
-            oss.clear();
-            oss << "DL" << std::setw(3) << std::setfill('0') << rank;
 
-            datalink::DLStreamResponse resp;
+            datalink::DLStreamResponse& resp = *arena.create<datalink::DLStreamResponse>();
             datalink::DLData* data = resp.mutable_data();
-            data->set_id(oss.str());
+            data->set_id(id, format_rank_id(id, "DL", rank));
             data->set_callsign(rec.callsign);
             data->set_status(rec.status);
             data->set_lat(rec.lat);
             data->set_lon(rec.lon);
             data->set_velocity(rec.velocity);
-            data->set_baroalt(rec.baroalt);
-            data->set_geoalt(rec.geoalt);
-
-            std::cout << "[DL] ID: " << data->id()
-                      << " | Callsign: " << data->callsign()
-                      << " | Status: " << data->status()
-                      << " | Lat: " << data->lat()
-                      << " | Lon: " << data->lon()
-                      << " | Vel: " << data->velocity()
-                      << " | Baro: " << data->baroalt()
-                      << " | Geo: " << data->geoalt()
-                      << std::endl;
-
-            if (!writer->Write(resp)) {
-                std::cerr << "[DL] Client disconnected." << std::endl;
+            data->set_baroalt(rec.baro_altitude);
+            data->set_geoalt(rec.geo_altitude);
+            resp.set_seq(++seq);
+            resp.set_sim_time_us(sim_time_us);
+
+            if (s_dl_log_limiter.allow(LogLevel::Info)) {
+                Logger::instance().log(LogLevel::Info, "DL",
+                                       {{"id", data->id()},
+                                        {"callsign", data->callsign()},
+                                        {"status", data->status()},
+                                        {"lat", data->lat()},
+                                        {"lon", data->lon()},
+                                        {"vel", data->velocity()},
+                                        {"baro", data->baroalt()},
+                                        {"geo", data->geoalt()}});
+            }
+
+            resp.set_enqueue_time_us(unix_micros());
+            const auto write_start = std::chrono::steady_clock::now();
+            const bool written = writer->Write(resp);
+            arena.reset();
+            metrics().write.record(std::chrono::steady_clock::now() - write_start);
+            metrics().record_age.record(micros_since(sim_time_us, unix_micros()));
+
+            if (!written) {
+                metrics().frames_dropped.inc();
+                Logger::instance().log(LogLevel::Info, "DL", {{"msg", "Client disconnected"}});
                 break;
             }
+            metrics().messages_sent.inc();
 
             if (context->IsCancelled()) {
-                std::cout << "[DL] Stream cancelled by client." << std::endl;
+                Logger::instance().log(LogLevel::Info, "DL", {{"msg", "Stream cancelled by client"}});
                 break;
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            if (!request->unpaced())
+                std::this_thread::sleep_for(std::chrono::milliseconds(pacing_ms_.load(std::memory_order_relaxed)));
         }
 
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] MongoDB DataLink query failed: " << e.what() << std::endl;
+        Logger::instance().log(LogLevel::Error, "DL", {{"msg", "DataLink source query failed"}, {"what", e.what()}});
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
     }
 
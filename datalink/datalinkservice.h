@@ -1,17 +1,28 @@
 #pragma once
-#include <bsoncxx/document/view.hpp>
-#include <bsoncxx/types.hpp>
-
 #include <grpcpp/grpcpp.h>
 #include "datalink.grpc.pb.h"
+#include "operatingarea.h"
+#include "tracksource.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 
 class DataLinkServiceImpl final : public datalink::DataLink::Service {
+    friend struct DataLinkBenchAccess;
+
 public:
     DataLinkServiceImpl(std::string mongo_uri,
                         std::string db_name,
                         std::string coll_name);
+    explicit DataLinkServiceImpl(std::unique_ptr<TrackSource> source);
+
+    // Kayıtlar arası bekleme (config datalink.pacing_ms); açık stream'lere de hemen uygulanır.
+    void setPacingMs(int ms) { pacing_ms_.store(ms < 0 ? 0 : ms, std::memory_order_relaxed); }
+
+    // Kayıt kabul alanı (config area.path); sonraki stream'den itibaren geçerli.
+    void setOperatingArea(std::shared_ptr<const OperatingArea> area);
 
     grpc::Status StreamDataLink(
         grpc::ServerContext* context,
@@ -19,15 +30,15 @@ public:
         grpc::ServerWriter<datalink::DLStreamResponse>* writer) override;
 
 private:
-    std::string mongo_uri_;
-    std::string db_name_;
-    std::string coll_name_;
-
-    std::string get_string_utf8(const bsoncxx::document::view& v,
-                                const char* key,
-                                const std::string& def);
-    bool get_double_safe(const bsoncxx::document::view& v,
-                         const char* key,
-                         double& out);
-    bool is_in_tr_bbox(double lat, double lon);
+    // Kaynağı okuyup kayıtları sırayla yazar. ServerWriterInterface:
+    // datalink_bench gRPC'siz sahte writer ile çağırır.
+    grpc::Status sendRecords(grpc::ServerContext* context,
+                             const datalink::DLRequest* request,
+                             grpc::ServerWriterInterface<datalink::DLStreamResponse>* writer);
+
+    std::unique_ptr<TrackSource> source_;
+    std::atomic<int> pacing_ms_{50};
+
+    std::shared_ptr<const OperatingArea> area_ = std::make_shared<OperatingArea>();
+    std::mutex area_mutex_;
 };
@@ -1,79 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: datalink.proto
-
-#include "datalink.pb.h"
-#include "datalink.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-namespace datalink {
-
-static const char* DataLink_method_names[] = {
-  "/datalink.DataLink/StreamDataLink",
-};
-
-std::unique_ptr< DataLink::Stub> DataLink::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< DataLink::Stub> stub(new DataLink::Stub(channel, options));
-  return stub;
-}
-
-DataLink::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_StreamDataLink_(DataLink_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
-  {}
-
-::grpc::ClientReader< ::datalink::DLStreamResponse>* DataLink::Stub::StreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request) {
-  return ::grpc::internal::ClientReaderFactory< ::datalink::DLStreamResponse>::Create(channel_.get(), rpcmethod_StreamDataLink_, context, request);
-}
-
-void DataLink::Stub::async::StreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest* request, ::grpc::ClientReadReactor< ::datalink::DLStreamResponse>* reactor) {
-  ::grpc::internal::ClientCallbackReaderFactory< ::datalink::DLStreamResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamDataLink_, context, request, reactor);
-}
-
-::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>* DataLink::Stub::AsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::datalink::DLStreamResponse>::Create(channel_.get(), cq, rpcmethod_StreamDataLink_, context, request, true, tag);
-}
-
-::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>* DataLink::Stub::PrepareAsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::datalink::DLStreamResponse>::Create(channel_.get(), cq, rpcmethod_StreamDataLink_, context, request, false, nullptr);
-}
-
-DataLink::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      DataLink_method_names[0],
-      ::grpc::internal::RpcMethod::SERVER_STREAMING,
-      new ::grpc::internal::ServerStreamingHandler< DataLink::Service, ::datalink::DLRequest, ::datalink::DLStreamResponse>(
-          [](DataLink::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::datalink::DLRequest* req,
-             ::grpc::ServerWriter<::datalink::DLStreamResponse>* writer) {
-               return service->StreamDataLink(ctx, req, writer);
-             }, this)));
-}
-
-DataLink::Service::~Service() {
-}
-
-::grpc::Status DataLink::Service::StreamDataLink(::grpc::ServerContext* context, const ::datalink::DLRequest* request, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* writer) {
-  (void) context;
-  (void) request;
-  (void) writer;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace datalink
-
@@ -1,239 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: datalink.proto
-#ifndef GRPC_datalink_2eproto__INCLUDED
-#define GRPC_datalink_2eproto__INCLUDED
-
-#include "datalink.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-
-namespace datalink {
-
-class DataLink final {
- public:
-  static constexpr char const* service_full_name() {
-    return "datalink.DataLink";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    std::unique_ptr< ::grpc::ClientReaderInterface< ::datalink::DLStreamResponse>> StreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReaderInterface< ::datalink::DLStreamResponse>>(StreamDataLinkRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>> AsyncStreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>>(AsyncStreamDataLinkRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>> PrepareAsyncStreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>>(PrepareAsyncStreamDataLinkRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void StreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest* request, ::grpc::ClientReadReactor< ::datalink::DLStreamResponse>* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientReaderInterface< ::datalink::DLStreamResponse>* StreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>* AsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::datalink::DLStreamResponse>* PrepareAsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    std::unique_ptr< ::grpc::ClientReader< ::datalink::DLStreamResponse>> StreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReader< ::datalink::DLStreamResponse>>(StreamDataLinkRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>> AsyncStreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>>(AsyncStreamDataLinkRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>> PrepareAsyncStreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>>(PrepareAsyncStreamDataLinkRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void StreamDataLink(::grpc::ClientContext* context, const ::datalink::DLRequest* request, ::grpc::ClientReadReactor< ::datalink::DLStreamResponse>* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientReader< ::datalink::DLStreamResponse>* StreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request) override;
-    ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>* AsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncReader< ::datalink::DLStreamResponse>* PrepareAsyncStreamDataLinkRaw(::grpc::ClientContext* context, const ::datalink::DLRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_StreamDataLink_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status StreamDataLink(::grpc::ServerContext* context, const ::datalink::DLRequest* request, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* writer);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamDataLink(::grpc::ServerContext* context, ::datalink::DLRequest* request, ::grpc::ServerAsyncWriter< ::datalink::DLStreamResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_StreamDataLink<Service > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::datalink::DLRequest, ::datalink::DLStreamResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::datalink::DLRequest* request) { return this->StreamDataLink(context, request); }));
-    }
-    ~WithCallbackMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::datalink::DLStreamResponse>* StreamDataLink(
-      ::grpc::CallbackServerContext* /*context*/, const ::datalink::DLRequest* /*request*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_StreamDataLink<Service > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamDataLink(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamDataLink(context, request); }));
-    }
-    ~WithRawCallbackMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamDataLink(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
-  };
-  typedef Service StreamedUnaryService;
-  template <class BaseClass>
-  class WithSplitStreamingMethod_StreamDataLink : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithSplitStreamingMethod_StreamDataLink() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::SplitServerStreamingHandler<
-          ::datalink::DLRequest, ::datalink::DLStreamResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerSplitStreamer<
-                     ::datalink::DLRequest, ::datalink::DLStreamResponse>* streamer) {
-                       return this->StreamedStreamDataLink(context,
-                         streamer);
-                  }));
-    }
-    ~WithSplitStreamingMethod_StreamDataLink() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status StreamDataLink(::grpc::ServerContext* /*context*/, const ::datalink::DLRequest* /*request*/, ::grpc::ServerWriter< ::datalink::DLStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with split streamed
-    virtual ::grpc::Status StreamedStreamDataLink(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::datalink::DLRequest,::datalink::DLStreamResponse>* server_split_streamer) = 0;
-  };
-  typedef WithSplitStreamingMethod_StreamDataLink<Service > SplitStreamedService;
-  typedef WithSplitStreamingMethod_StreamDataLink<Service > StreamedService;
-};
-
-}  // namespace datalink
-
-
-#endif  // GRPC_datalink_2eproto__INCLUDED
@@ -1,5 +1,10 @@
 #include <grpcpp/grpcpp.h>
 #include "datalinkservice.h"   // Senin DataLinkServiceImpl sınıfın
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "serverconfig.h"
+#include "tracksource.h"
 #include "datalink.grpc.pb.h"
 
 #include <iostream>
@@ -7,15 +12,54 @@
 #include <string>
 
 int main(int argc, char** argv) {
-    std::string server_address("0.0.0.0:50052");
+    // --config datalink.conf ve --anahtar=değer override'ları (bkz. config/aewc.conf).
+    Config cfg;
+    std::string cfg_error;
+    if (!cfg.load(argc, argv, &cfg_error)) {
+        std::cerr << "[DL] " << cfg_error << std::endl;
+        return 1;
+    }
 
-    std::string mongo_uri = "mongodb://localhost:27017";
-    std::string db_name   = "aewc";
-    std::string coll_name = "datalink";
+    Logger::instance().start(logger_options(cfg));
 
-    DataLinkServiceImpl service(mongo_uri, db_name, coll_name);
+    MetricsRegistry::instance().callbackGauge("aewc_log_records_dropped", "Kuyruk dolu olduğu için düşürülen log kayıtları",
+                                              [] { return static_cast<double>(Logger::instance().dropped()); });
+    MetricsServer metrics_server;
+    metrics_server.start(static_cast<uint16_t>(cfg.getInt("datalink.metrics_port", MetricsServer::portFromEnv(9252))));
+
+    std::string server_address = cfg.getString("datalink.address", "0.0.0.0:50052");
+
+    std::string mongo_uri = cfg.getString("mongo.uri", "mongodb://localhost:27017");
+    std::string db_name   = cfg.getString("mongo.db", "aewc");
+    std::string coll_name = cfg.getString("datalink.collection", "datalink");
+
+    // source.spec=file:/data/{coll}.bson veya synthetic:N ile Mongo'suz çalışır.
+    std::unique_ptr<TrackSource> source;
+    try {
+        source = make_track_source(cfg.getString("source.spec", track_source_spec_from_env()),
+                                   mongo_uri, db_name, coll_name, TrackSchema::datalink(), nullptr,
+                                   static_cast<int32_t>(cfg.getInt("mongo.batch_size", 0)));
+    } catch (const std::exception& e) {
+        std::cerr << "[DL] Veri kaynağı hatası: " << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "[DL] Veri kaynağı: " << source->describe() << std::endl;
+    DataLinkServiceImpl service(std::move(source));
+    service.setPacingMs(static_cast<int>(cfg.getInt("datalink.pacing_ms", 50)));
+    if (auto area = load_operating_area(cfg.getString("area.path", "")))
+        service.setOperatingArea(std::move(area));
+
+    // SIGHUP: datalink.pacing_ms, area.path ve log.level yeniden okunur.
+    ConfigWatcher watcher;
+    watcher.start(cfg, [&service](const Config& c) {
+        service.setPacingMs(static_cast<int>(c.getInt("datalink.pacing_ms", 50)));
+        if (auto area = load_operating_area(c.getString("area.path", "")))
+            service.setOperatingArea(std::move(area));
+        Logger::instance().setLevel(logger_options(c).level);
+    });
 
     grpc::ServerBuilder builder;
+    apply_server_config(cfg, builder);
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
 
@@ -0,0 +1,308 @@
+#include "association.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr double kEarthRadiusM = 6371008.8;
+constexpr double kDegToRad = 3.14159265358979323846 / 180.0;
+constexpr double kMetersPerDegree = kEarthRadiusM * kDegToRad;
+constexpr double kMissCost = 1.0;
+constexpr double kInf = std::numeric_limits<double>::infinity();
+} // namespace
+
+void Associator::setGates(const AssocGates &gates)
+{
+    if (gates.position_m <= 0.0)
+        return;
+    if (gates.position_m != gates_.position_m)
+        grid_ = SpatialGrid(gates.position_m / kMetersPerDegree);
+    gates_ = gates;
+}
+
+double Associator::distanceMeters(const AssocPoint &a, const AssocPoint &b)
+{
+    const double dlat = (b.lat - a.lat) * kDegToRad;
+    const double dlon = (b.lon - a.lon) * kDegToRad * std::cos((a.lat + b.lat) * 0.5 * kDegToRad);
+    return kEarthRadiusM * std::sqrt(dlat * dlat + dlon * dlon);
+}
+
+bool Associator::candidateCost(const AssocPoint &t, const AssocPoint &r, double cos_lat, double &cost) const
+{
+    // Ucuz boyutlar önce. NaN karşılaştırmaları false döner; bilinmeyen
+    // boyut kapıyı geçer, maliyete girmez.
+    const double dalt = std::fabs(t.alt_m - r.alt_m);
+    if (dalt > gates_.altitude_m)
+        return false;
+    const double dv = std::fabs(t.speed_mps - r.speed_mps);
+    if (dv > gates_.speed_mps)
+        return false;
+
+    // distanceMeters ile aynı yaklaşım; cos izin enleminden bir kez alınır.
+    const double dy = (r.lat - t.lat) * kMetersPerDegree;
+    const double dx = (r.lon - t.lon) * kMetersPerDegree * cos_lat;
+    const double gate2 = gates_.position_m * gates_.position_m;
+    const double d2 = dx * dx + dy * dy;
+    if (d2 > gate2)
+        return false;
+
+    double sum = d2 / gate2;
+    int dims = 1;
+    if (dalt == dalt)
+    {
+        sum += (dalt / gates_.altitude_m) * (dalt / gates_.altitude_m);
+        ++dims;
+    }
+    if (dv == dv)
+    {
+        sum += (dv / gates_.speed_mps) * (dv / gates_.speed_mps);
+        ++dims;
+    }
+    cost = sum / dims;
+    return true;
+}
+
+std::size_t Associator::associate(const std::vector<AssocPoint> &tracks, const std::vector<AssocPoint> &reports,
+                                  std::vector<int32_t> &match, std::vector<double> &distance_m)
+{
+    match.assign(tracks.size(), kNoMatch);
+    distance_m.assign(tracks.size(), 0.0);
+    edge_col_.clear();
+    edge_cost_.clear();
+    if (tracks.empty() || reports.empty())
+        return 0;
+
+    grid_.build(reports.size(), [&reports](std::size_t i)
+                { return std::make_pair(reports[i].lat, reports[i].lon); });
+
+    // Kapı: ızgara sorgusu + boyut başına eşik.
+    row_begin_.resize(tracks.size() + 1);
+    const double dlat = gates_.position_m / kMetersPerDegree;
+    for (std::size_t t = 0; t < tracks.size(); ++t)
+    {
+        row_begin_[t] = static_cast<uint32_t>(edge_col_.size());
+        const AssocPoint &p = tracks[t];
+        // Boylam derecesi enlemle kısalır; kutba yakın kapı genişler.
+        const double cos_lat = std::cos(p.lat * kDegToRad);
+        const double dlon = dlat / std::max(cos_lat, 0.01);
+        grid_.query(p.lat - dlat, p.lon - dlon, p.lat + dlat, p.lon + dlon, [&](uint32_t r)
+                    {
+            double cost;
+            if (candidateCost(p, reports[r], cos_lat, cost))
+            {
+                edge_col_.push_back(r);
+                edge_cost_.push_back(cost);
+            } });
+    }
+    row_begin_[tracks.size()] = static_cast<uint32_t>(edge_col_.size());
+
+    const std::size_t cols = reports.size() + tracks.size();
+    col_of_row_.assign(tracks.size(), kNoMatch);
+    row_cost_.assign(tracks.size(), kMissCost);
+    row_of_col_.assign(cols, kNoMatch);
+    price_.assign(cols, 0.0);
+    if (dist_.size() < cols)
+    {
+        dist_.resize(cols, kInf);
+        pred_row_.resize(cols, kNoMatch);
+        pred_cost_.resize(cols, 0.0);
+        done_.resize(cols, 0);
+    }
+
+    reduceRows(reports.size());
+    for (uint32_t t : free_rows_)
+        augment(t, reports.size());
+
+    std::size_t matched = 0;
+    for (std::size_t t = 0; t < tracks.size(); ++t)
+    {
+        const int32_t c = col_of_row_[t];
+        if (c == kNoMatch || static_cast<std::size_t>(c) >= reports.size())
+            continue;
+        match[t] = c;
+        distance_m[t] = distanceMeters(tracks[t], reports[static_cast<std::size_t>(c)]);
+        ++matched;
+    }
+    return matched;
+}
+
+// JV "augmenting row reduction": serbest satır en ucuz sütununa teklif verir,
+// sütunun potansiyeli ikinci en iyiyle arasındaki fark kadar düşer ve
+// önceki sahibi serbest kalır (auction adımı). Çakışmaların çoğu burada
+// ucuzca çözülür; kalan serbest satırlar free_rows_'ta augment()'e kalır.
+void Associator::reduceRows(std::size_t reports)
+{
+    free_rows_.clear();
+    for (std::size_t t = 0; t + 1 < row_begin_.size(); ++t)
+        if (row_begin_[t] != row_begin_[t + 1])
+            free_rows_.push_back(static_cast<uint32_t>(t));
+
+    for (int pass = 0; pass < kReductionPasses; ++pass)
+    {
+        // Gerçel maliyetlerde fiyat adımları çok küçülebilir; teklif sayısı sınırlanır.
+        std::size_t budget = 4 * free_rows_.size();
+        next_free_.clear();
+        std::size_t k = 0;
+        while (k < free_rows_.size())
+        {
+            const uint32_t row = free_rows_[k++];
+            const uint32_t miss_col = static_cast<uint32_t>(reports + row);
+            uint32_t j1 = miss_col, j2 = miss_col;
+            double u1 = kMissCost - price_[miss_col], u2 = kInf;
+            double cost1 = kMissCost, cost2 = kMissCost;
+            for (uint32_t e = row_begin_[row]; e < row_begin_[row + 1]; ++e)
+            {
+                const double h = edge_cost_[e] - price_[edge_col_[e]];
+                if (h < u1)
+                {
+                    u2 = u1, j2 = j1, cost2 = cost1;
+                    u1 = h, j1 = edge_col_[e], cost1 = edge_cost_[e];
+                }
+                else if (h < u2)
+                {
+                    u2 = h, j2 = edge_col_[e], cost2 = edge_cost_[e];
+                }
+            }
+
+            int32_t owner = row_of_col_[j1];
+            const bool strict = u1 < u2;
+            if (strict)
+                price_[j1] -= u2 - u1;
+            else if (owner != kNoMatch)
+            {
+                // Eşitlikte döngüye girmemek için dolu en iyi yerine ikinci sütun alınır.
+                j1 = j2;
+                cost1 = cost2;
+                owner = row_of_col_[j1];
+            }
+
+            row_of_col_[j1] = static_cast<int32_t>(row);
+            col_of_row_[row] = static_cast<int32_t>(j1);
+            row_cost_[row] = cost1;
+            if (owner == kNoMatch)
+                continue;
+
+            col_of_row_[static_cast<std::size_t>(owner)] = kNoMatch;
+            if (strict && budget > 0)
+            {
+                --budget;
+                free_rows_[--k] = static_cast<uint32_t>(owner);
+            }
+            else
+                next_free_.push_back(static_cast<uint32_t>(owner));
+        }
+        free_rows_.swap(next_free_);
+    }
+}
+
+// Serbest satır row için en kısa artırma yolu (Jonker-Volgenant). İndirgenmiş
+// maliyet c(r, c) - price[c]; atanmış satırın kendi sütununda bu değer
+// satırdaki en küçük değerdir, Dijkstra bu yüzden negatif kenar görmez.
+void Associator::augment(uint32_t row, std::size_t reports)
+{
+    const uint32_t begin = row_begin_[row];
+    const uint32_t end = row_begin_[row + 1];
+    const uint32_t miss_col = static_cast<uint32_t>(reports + row);
+
+    // Hızlı yol: satırdaki en ucuz sütun boşsa doğrudan atanır (yoğun
+    // olmayan trafikte izlerin çoğu buradan geçer).
+    uint32_t best_col = miss_col;
+    double best = kMissCost - price_[miss_col];
+    double best_cost = kMissCost;
+    for (uint32_t e = begin; e < end; ++e)
+    {
+        const double reduced = edge_cost_[e] - price_[edge_col_[e]];
+        if (reduced < best)
+        {
+            best = reduced;
+            best_col = edge_col_[e];
+            best_cost = edge_cost_[e];
+        }
+    }
+    if (row_of_col_[best_col] == kNoMatch)
+    {
+        row_of_col_[best_col] = static_cast<int32_t>(row);
+        col_of_row_[row] = static_cast<int32_t>(best_col);
+        row_cost_[row] = best_cost;
+        return;
+    }
+
+    touched_.clear();
+    scanned_.clear();
+    heap_.clear();
+    const auto after = [](const HeapEntry &a, const HeapEntry &b)
+    { return a.dist > b.dist; };
+
+    auto relax = [&](uint32_t r, double base)
+    {
+        auto visit = [&](uint32_t c, double cost)
+        {
+            const double nd = base + cost - price_[c];
+            if (nd >= dist_[c])
+                return;
+            if (dist_[c] == kInf)
+                touched_.push_back(c);
+            dist_[c] = nd;
+            pred_row_[c] = static_cast<int32_t>(r);
+            pred_cost_[c] = cost;
+            heap_.push_back(HeapEntry{nd, c});
+            std::push_heap(heap_.begin(), heap_.end(), after);
+        };
+        for (uint32_t e = row_begin_[r]; e < row_begin_[r + 1]; ++e)
+            if (!done_[edge_col_[e]])
+                visit(edge_col_[e], edge_cost_[e]);
+        const uint32_t own_miss = static_cast<uint32_t>(reports + r);
+        if (!done_[own_miss])
+            visit(own_miss, kMissCost);
+    };
+
+    relax(row, 0.0);
+    uint32_t free_col = miss_col;
+    double dmin = 0.0;
+    while (!heap_.empty())
+    {
+        std::pop_heap(heap_.begin(), heap_.end(), after);
+        const HeapEntry top = heap_.back();
+        heap_.pop_back();
+        if (done_[top.col] || top.dist > dist_[top.col])
+            continue;
+
+        done_[top.col] = 1;
+        scanned_.push_back(top.col);
+        const int32_t owner = row_of_col_[top.col];
+        if (owner == kNoMatch)
+        {
+            free_col = top.col;
+            dmin = top.dist;
+            break;
+        }
+        // Atanmış satırın kendi sütunundaki indirgenmiş maliyeti sıfır kabul edilir.
+        const uint32_t r = static_cast<uint32_t>(owner);
+        relax(r, top.dist - (row_cost_[r] - price_[top.col]));
+    }
+
+    // Potansiyel güncellemesi: taranan sütunlar dmin'e göre kaydırılır.
+    for (uint32_t c : scanned_)
+        price_[c] += dist_[c] - dmin;
+
+    // Yolu geriye doğru çevir.
+    uint32_t c = free_col;
+    for (;;)
+    {
+        const uint32_t r = static_cast<uint32_t>(pred_row_[c]);
+        const int32_t prev = col_of_row_[r];
+        row_of_col_[c] = static_cast<int32_t>(r);
+        col_of_row_[r] = static_cast<int32_t>(c);
+        row_cost_[r] = pred_cost_[c];
+        if (r == row)
+            break;
+        c = static_cast<uint32_t>(prev);
+    }
+
+    for (uint32_t t : touched_)
+    {
+        dist_[t] = kInf;
+        done_[t] = 0;
+    }
+}
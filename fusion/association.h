@@ -0,0 +1,100 @@
+#ifndef ASSOCIATION_H
+#define ASSOCIATION_H
+
+#include "spatialgrid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Radar izleri ile IFF / DataLink raporlarının eşleştirilmesi (global
+// nearest neighbour). Raporlar ızgaraya dizilir; her iz için sadece kapı
+// (gate) içindeki raporlar aday olur ve seyrek bir maliyet matrisi kurulur.
+// Atama bu matris üzerinde toplam maliyeti en küçükleyen Hungarian /
+// Jonker-Volgenant ile çözülür: önce satır indirgemesi (auction adımları),
+// kalan serbest izler için en kısa artırma yolu (shortest augmenting path).
+// Her izin yalnız kendisine açık bir "eşleşmeme" sütunu vardır, bu yüzden
+// artırma yolu sadece izin bağlı bileşeninde dolaşır.
+struct AssocPoint
+{
+    static constexpr double kUnknown = std::numeric_limits<double>::quiet_NaN();
+
+    double lat;
+    double lon;
+    double alt_m = kUnknown;     // barometrik irtifa; bilinmiyorsa NaN
+    double speed_mps = kUnknown; // yer hızı; bilinmiyorsa NaN
+};
+
+// Boyut başına kapı. İrtifa ve hız, sadece iki tarafta da biliniyorsa
+// kapıya ve maliyete girer.
+struct AssocGates
+{
+    double position_m = 5000.0;
+    double altitude_m = 300.0;
+    double speed_mps = 60.0;
+};
+
+class Associator
+{
+public:
+    static constexpr int32_t kNoMatch = -1;
+
+    // Izgara hücresi konum kapısına göre seçilir.
+    void setGates(const AssocGates &gates);
+    const AssocGates &gates() const { return gates_; }
+
+    // match[i]: tracks[i]'ye atanan rapor indeksi ya da kNoMatch;
+    // distance_m[i]: eşleşme mesafesi (eşleşme yoksa 0). Dönüş eşleşen iz sayısı.
+    std::size_t associate(const std::vector<AssocPoint> &tracks, const std::vector<AssocPoint> &reports,
+                          std::vector<int32_t> &match, std::vector<double> &distance_m);
+
+    // Son associate() çağrısındaki aday (kapı içi iz-rapor) çifti sayısı.
+    std::size_t candidates() const { return edge_col_.size(); }
+
+    // Eşdikdörtgen (equirectangular) yaklaşık mesafe; kapı ölçeğinde
+    // (birkaç km) haversine ile farkı metrenin altındadır.
+    static double distanceMeters(const AssocPoint &a, const AssocPoint &b);
+
+private:
+    // Kapı içindeki adayın maliyeti: boyut başına (fark / kapı)^2'lerin
+    // ortalaması, [0, 1]. Eşleşmemenin maliyeti kMissCost = 1.
+    bool candidateCost(const AssocPoint &t, const AssocPoint &r, double cos_lat, double &cost) const;
+    void reduceRows(std::size_t reports);
+    void augment(uint32_t row, std::size_t reports);
+
+    static constexpr int kReductionPasses = 2;
+
+    AssocGates gates_;
+    SpatialGrid grid_{5000.0 / 111195.0};
+
+    // Seyrek maliyet matrisi (CSR): satır = iz, sütun = rapor. İz t'nin
+    // eşleşmeme sütunu reports + t'dir ve saklanmaz.
+    std::vector<uint32_t> row_begin_;
+    std::vector<uint32_t> edge_col_;
+    std::vector<double> edge_cost_;
+
+    // Atama durumu ve sütun potansiyelleri (JV'deki v).
+    std::vector<int32_t> col_of_row_;
+    std::vector<int32_t> row_of_col_;
+    std::vector<double> row_cost_;
+    std::vector<double> price_;
+    std::vector<uint32_t> free_rows_;
+    std::vector<uint32_t> next_free_;
+
+    // Dijkstra tamponları; sadece dokunulan sütunlar geri sıfırlanır.
+    struct HeapEntry
+    {
+        double dist;
+        uint32_t col;
+    };
+    std::vector<double> dist_;
+    std::vector<int32_t> pred_row_;
+    std::vector<double> pred_cost_;
+    std::vector<uint8_t> done_;
+    std::vector<uint32_t> touched_;
+    std::vector<uint32_t> scanned_;
+    std::vector<HeapEntry> heap_;
+};
+
+#endif
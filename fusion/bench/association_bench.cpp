@@ -0,0 +1,238 @@
+// fusion eşleştirmesinin (kapı + global atama) Google Benchmark ölçümleri.
+// İzler ve raporlar bellekte sentetik üretilir; raporların çoğu bir izin
+// gürültülü kopyası, kalanı ilgisiz (clutter) rapordur.
+//
+//   cmake -DFUSION_BUILD_BENCH=ON ... && ./fusion_bench --benchmark_filter=Associate
+
+#include "association.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Scenario
+{
+    std::vector<AssocPoint> tracks;
+    std::vector<AssocPoint> reports;
+    std::vector<int32_t> truth; // reports[i]'yi üreten iz ya da -1 (clutter)
+};
+
+// Türkiye kutusuna dağılmış n iz; izlerin %90'ı için bir rapor, üstüne
+// %10 clutter. with_kinematics=false IFF gibi sadece konum taşıyan raporlar.
+Scenario makeScenario(std::size_t n, bool with_kinematics)
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> lat(36.0, 42.0), lon(26.0, 45.0);
+    std::uniform_real_distribution<double> alt(1000.0, 12000.0), speed(80.0, 260.0), unit(0.0, 1.0);
+    std::normal_distribution<double> pos_noise_deg(0.0, 300.0 / 111320.0), alt_noise(0.0, 30.0), speed_noise(0.0, 5.0);
+
+    Scenario s;
+    s.tracks.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        s.tracks.push_back(AssocPoint{lat(rng), lon(rng), alt(rng), speed(rng)});
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (unit(rng) < 0.9)
+        {
+            const AssocPoint &t = s.tracks[i];
+            AssocPoint r{t.lat + pos_noise_deg(rng), t.lon + pos_noise_deg(rng)};
+            if (with_kinematics)
+            {
+                r.alt_m = t.alt_m + alt_noise(rng);
+                r.speed_mps = t.speed_mps + speed_noise(rng);
+            }
+            s.reports.push_back(r);
+            s.truth.push_back(static_cast<int32_t>(i));
+        }
+    }
+    for (std::size_t i = 0; i < n / 10; ++i)
+    {
+        AssocPoint r{lat(rng), lon(rng)};
+        if (with_kinematics)
+        {
+            r.alt_m = alt(rng);
+            r.speed_mps = speed(rng);
+        }
+        s.reports.push_back(r);
+        s.truth.push_back(-1);
+    }
+
+    // Rapor sırası izlerden bağımsız olsun.
+    std::vector<std::size_t> order(s.reports.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+    Scenario shuffled{s.tracks, {}, {}};
+    for (std::size_t i : order)
+    {
+        shuffled.reports.push_back(s.reports[i]);
+        shuffled.truth.push_back(s.truth[i]);
+    }
+    return shuffled;
+}
+
+// Associator::candidateCost'un kopyası (private); kapı dışı çift false döner.
+bool pairCost(const AssocGates &g, const AssocPoint &t, const AssocPoint &r, double &cost)
+{
+    const double m_per_deg = 6371008.8 * (3.14159265358979323846 / 180.0);
+    const double dalt = std::fabs(t.alt_m - r.alt_m), dv = std::fabs(t.speed_mps - r.speed_mps);
+    if (dalt > g.altitude_m || dv > g.speed_mps)
+        return false;
+    const double dy = (r.lat - t.lat) * m_per_deg;
+    const double dx = (r.lon - t.lon) * m_per_deg * std::cos(t.lat * (3.14159265358979323846 / 180.0));
+    const double gate2 = g.position_m * g.position_m, d2 = dx * dx + dy * dy;
+    if (d2 > gate2)
+        return false;
+    double sum = d2 / gate2;
+    int dims = 1;
+    if (dalt == dalt)
+    {
+        sum += (dalt / g.altitude_m) * (dalt / g.altitude_m);
+        ++dims;
+    }
+    if (dv == dv)
+    {
+        sum += (dv / g.speed_mps) * (dv / g.speed_mps);
+        ++dims;
+    }
+    cost = sum / dims;
+    return true;
+}
+
+// Kaba kuvvet en küçük toplam maliyet (eşleşmeme 1): izler sırayla,
+// kullanılmış raporlar bit maskesinde (rapor sayısı <= 16).
+double bruteOptimum(const AssocGates &g, const std::vector<AssocPoint> &tracks, const std::vector<AssocPoint> &reports)
+{
+    const std::size_t masks = std::size_t{1} << reports.size();
+    std::vector<double> best(masks, INFINITY), next(masks);
+    best[0] = 0.0;
+    for (const AssocPoint &t : tracks)
+    {
+        std::fill(next.begin(), next.end(), INFINITY);
+        for (std::size_t m = 0; m < masks; ++m)
+        {
+            if (best[m] == INFINITY)
+                continue;
+            next[m] = std::min(next[m], best[m] + 1.0);
+            for (std::size_t r = 0; r < reports.size(); ++r)
+            {
+                double c;
+                if (!(m & (std::size_t{1} << r)) && pairCost(g, t, reports[r], c))
+                    next[m | (std::size_t{1} << r)] = std::min(next[m | (std::size_t{1} << r)], best[m] + c);
+            }
+        }
+        best.swap(next);
+    }
+    return *std::min_element(best.begin(), best.end());
+}
+} // namespace
+
+// range(0): iz sayısı, range(1): konum kapısı (m), range(2): irtifa+hız var mı.
+static void BM_Associate(benchmark::State &state)
+{
+    const Scenario s = makeScenario(static_cast<std::size_t>(state.range(0)), state.range(2) != 0);
+    Associator assoc;
+    AssocGates gates;
+    gates.position_m = static_cast<double>(state.range(1));
+    assoc.setGates(gates);
+
+    std::vector<int32_t> match;
+    std::vector<double> distance;
+    std::size_t matched = 0;
+    for (auto _ : state)
+    {
+        matched = assoc.associate(s.tracks, s.reports, match, distance);
+        benchmark::DoNotOptimize(match.data());
+    }
+
+    std::size_t correct = 0;
+    for (std::size_t t = 0; t < match.size(); ++t)
+        if (match[t] != Associator::kNoMatch && s.truth[static_cast<std::size_t>(match[t])] == static_cast<int32_t>(t))
+            ++correct;
+    state.counters["reports"] = static_cast<double>(s.reports.size());
+    state.counters["candidates"] = static_cast<double>(assoc.candidates());
+    state.counters["matched"] = static_cast<double>(matched);
+    state.counters["correct"] = static_cast<double>(correct);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Associate)
+    ->ArgsProduct({{10000, 50000}, {5000, 20000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+// 3000 küçük, yoğun örnek (1-7 iz, 1-8 rapor, ~8 km kare içinde; kapılar
+// çakışır, çakışma çözümü ve artırma yolları sık işler). mismatched,
+// atamanın toplam maliyeti kaba kuvvet optimumundan farklı (ya da rapor iki
+// kez / kapı dışı atanmış) örnek sayısıdır; 0 değilse ölçüm hatayla biter.
+static void BM_AssociateSmall(benchmark::State &state)
+{
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int> track_count(1, 7), report_count(1, 8);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<std::vector<AssocPoint>> tracks(3000), reports(3000);
+    for (std::size_t k = 0; k < tracks.size(); ++k)
+    {
+        const bool kinematics = k % 2 == 1;
+        auto point = [&]
+        {
+            AssocPoint p{39.0 + 0.07 * unit(rng), 32.0 + 0.09 * unit(rng)};
+            if (kinematics)
+            {
+                p.alt_m = 5000.0 + 400.0 * unit(rng);
+                p.speed_mps = 200.0 + 80.0 * unit(rng);
+            }
+            return p;
+        };
+        for (int i = track_count(rng); i > 0; --i)
+            tracks[k].push_back(point());
+        for (int i = report_count(rng); i > 0; --i)
+            reports[k].push_back(point());
+    }
+
+    Associator assoc;
+    AssocGates gates;
+    gates.position_m = 5000.0;
+    assoc.setGates(gates);
+    std::vector<int32_t> match;
+    std::vector<double> distance;
+    for (auto _ : state)
+        for (std::size_t k = 0; k < tracks.size(); ++k)
+        {
+            assoc.associate(tracks[k], reports[k], match, distance);
+            benchmark::DoNotOptimize(match.data());
+        }
+
+    std::size_t mismatched = 0;
+    for (std::size_t k = 0; k < tracks.size(); ++k)
+    {
+        assoc.associate(tracks[k], reports[k], match, distance);
+        std::vector<uint8_t> used(reports[k].size(), 0);
+        double total = 0.0;
+        bool valid = true;
+        for (std::size_t t = 0; t < match.size(); ++t)
+        {
+            double c = 1.0;
+            if (match[t] != Associator::kNoMatch)
+            {
+                const std::size_t r = static_cast<std::size_t>(match[t]);
+                valid = valid && !used[r] && pairCost(gates, tracks[k][t], reports[k][r], c);
+                used[r] = 1;
+            }
+            total += c;
+        }
+        mismatched += !valid || std::fabs(total - bruteOptimum(gates, tracks[k], reports[k])) > 1e-9;
+    }
+    state.counters["mismatched"] = static_cast<double>(mismatched);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(tracks.size()));
+    if (mismatched != 0)
+        state.SkipWithError("atama kaba kuvvet optimumundan farklı");
+}
+BENCHMARK(BM_AssociateSmall)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,264 @@
+// Şüpheli hedef modelinin (SuspicionModel) tek örnek değerlendirme süresi.
+// Eğitilmiş model depoda olmadığından ağaçlar, defterdeki kurallarla
+// etiketlenmiş sentetik veriye rastgele bölmelerle tam büyütülerek üretilir
+// (sklearn RandomForest gibi bootstrap + yaprak saf olana kadar bölme).
+//
+//   cmake -DFUSION_BUILD_BENCH=ON ... && ./suspicion_bench
+
+#include "suspicionmodel.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+const char *const kCallsigns[] = {"CU61", "GR47", "IS63", "KU15", "MA85", "ML99", "PR09", "QB22", "UNKNOWN", "UX56", "XU35", "YY71"};
+const char *const kStatuses[] = {"FRIEND", "UNKNOWN"};
+
+using Row = std::array<double, 8>; // callsign, friend_foe, lat, lon, speed, baroAltitude, geoAltitude, heading
+
+struct Data
+{
+    std::vector<Row> rows;
+    std::vector<int> labels;
+};
+
+// Defterdeki etiket kurallarının tek satırdan görülebilenleri (hız > 900,
+// geoAltitude < 100) + önceki kayda bağlı kuralların yerini tutan gürültü.
+Data makeData(std::size_t n, std::mt19937_64 &rng)
+{
+    std::uniform_real_distribution<double> unit(0.0, 1.0), lat(36.0, 42.0), lon(26.0, 45.0);
+    std::uniform_int_distribution<int> callsign(0, 11), speed(100, 1000), alt(0, 12000), heading(0, 359);
+    Data d;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const bool unknown = unit(rng) < 0.4;
+        Row r{unknown ? 8.0 : static_cast<double>(callsign(rng)), unknown ? 1.0 : 0.0, lat(rng), lon(rng),
+              static_cast<double>(speed(rng)), static_cast<double>(alt(rng)), static_cast<double>(alt(rng)),
+              static_cast<double>(heading(rng))};
+        const bool rule = r[4] > 900.0 || r[6] < 100.0 || unit(rng) < 0.03;
+        d.rows.push_back(r);
+        d.labels.push_back(unknown && rule ? 1 : 0);
+    }
+    return d;
+}
+
+// Tek ağacı model metin biçiminde yazar (ölçek 1, ortalama 0 olduğundan
+// eşikler ham değerlerdir).
+void growTree(const Data &d, std::mt19937_64 &rng, std::ostream &out, std::size_t &nodes, uint32_t &max_depth)
+{
+    struct Node
+    {
+        int left = -1, right = -1, feature = -1;
+        double threshold = 0.0, p1 = 0.0;
+    };
+    std::vector<Node> tree;
+    std::uniform_int_distribution<std::size_t> pick(0, d.rows.size() - 1);
+    std::vector<std::size_t> sample(d.rows.size());
+    for (std::size_t &s : sample)
+        s = pick(rng);
+
+    struct Task
+    {
+        std::size_t begin, end;
+        int node;
+        uint32_t depth;
+    };
+    tree.emplace_back();
+    std::vector<Task> stack{{0, sample.size(), 0, 0}};
+    std::uniform_int_distribution<int> feature(0, 7);
+    while (!stack.empty())
+    {
+        const Task t = stack.back();
+        stack.pop_back();
+        std::size_t positives = 0;
+        for (std::size_t i = t.begin; i < t.end; ++i)
+            positives += static_cast<std::size_t>(d.labels[sample[i]]);
+        tree[t.node].p1 = static_cast<double>(positives) / static_cast<double>(t.end - t.begin);
+        max_depth = std::max(max_depth, t.depth);
+        if (positives == 0 || positives == t.end - t.begin)
+            continue;
+
+        // sklearn gibi: max_features = sqrt(8) ~ 2 rastgele özellik, her biri
+        // için gini azalmasını en büyükleyen eşik.
+        double best_gini = 1e300, threshold = 0.0;
+        int f = -1;
+        for (int k = 0; k < 2; ++k)
+        {
+            const int cand = feature(rng);
+            std::sort(sample.begin() + t.begin, sample.begin() + t.end, [&](std::size_t a, std::size_t b)
+                      { return d.rows[a][cand] < d.rows[b][cand]; });
+            const double n = static_cast<double>(t.end - t.begin);
+            double left_pos = 0.0;
+            for (std::size_t i = t.begin; i + 1 < t.end; ++i)
+            {
+                left_pos += d.labels[sample[i]];
+                const double a = d.rows[sample[i]][cand], b = d.rows[sample[i + 1]][cand];
+                if (a == b)
+                    continue;
+                const double nl = static_cast<double>(i + 1 - t.begin), nr = n - nl;
+                const double right_pos = static_cast<double>(positives) - left_pos;
+                const double gini = nl - left_pos * left_pos / nl - (nl - left_pos) * (nl - left_pos) / nl +
+                                    nr - right_pos * right_pos / nr - (nr - right_pos) * (nr - right_pos) / nr;
+                if (gini < best_gini)
+                {
+                    best_gini = gini;
+                    threshold = 0.5 * (a + b);
+                    f = cand;
+                }
+            }
+        }
+        if (f < 0)
+            continue;
+        const std::size_t mid = static_cast<std::size_t>(
+            std::partition(sample.begin() + t.begin, sample.begin() + t.end, [&](std::size_t s)
+                           { return d.rows[s][f] <= threshold; }) -
+            sample.begin());
+        if (mid == t.begin || mid == t.end)
+            continue;
+
+        tree[t.node].feature = f;
+        tree[t.node].threshold = threshold;
+        tree[t.node].left = static_cast<int>(tree.size());
+        tree.emplace_back();
+        tree[t.node].right = static_cast<int>(tree.size());
+        tree.emplace_back();
+        stack.push_back({mid, t.end, tree[t.node].right, t.depth + 1});
+        stack.push_back({t.begin, mid, tree[t.node].left, t.depth + 1});
+    }
+
+    out << "tree " << tree.size() << "\n";
+    for (const Node &n : tree)
+        out << n.left << ' ' << n.right << ' ' << n.feature << ' ' << n.threshold << ' ' << n.p1 << "\n";
+    nodes += tree.size();
+}
+
+struct Forest
+{
+    SuspicionModel model;
+    std::size_t nodes = 0;
+    uint32_t max_depth = 0;
+};
+
+const Forest &forest()
+{
+    static const Forest forest = []
+    {
+        Forest f;
+        std::mt19937_64 rng(42);
+        const Data d = makeData(40000, rng);
+        std::stringstream text;
+        text.precision(17);
+        text << "aewc-suspicious-model 1\n"
+             << "features 8 callsign friend_foe lat lon speed baroAltitude geoAltitude heading\n"
+             << "classes callsign 12";
+        for (const char *c : kCallsigns)
+            text << ' ' << c;
+        text << "\nclasses friend_foe 2 FRIEND UNKNOWN\n"
+             << "mean 8 0 0 0 0 0 0 0 0\nscale 8 1 1 1 1 1 1 1 1\ntrees 100\n";
+        for (int t = 0; t < 100; ++t)
+            growTree(d, rng, text, f.nodes, f.max_depth);
+        std::string error;
+        if (!f.model.parse(text, &error))
+            throw std::runtime_error(error);
+        return f;
+    }();
+    return forest;
+}
+
+void BM_SuspicionProbability(benchmark::State &state)
+{
+    const Forest &f = forest();
+    std::mt19937_64 rng(7);
+    const Data d = makeData(4096, rng);
+    std::vector<SuspicionInput> inputs;
+    for (const Row &r : d.rows)
+    {
+        SuspicionInput in;
+        in.callsign = kCallsigns[static_cast<int>(r[0])];
+        in.status = kStatuses[static_cast<int>(r[1])];
+        in.lat = r[2];
+        in.lon = r[3];
+        in.speed = r[4];
+        in.baro_altitude = r[5];
+        in.geo_altitude = r[6];
+        in.heading = r[7];
+        inputs.push_back(in);
+    }
+
+    std::size_t i = 0;
+    double correct = 0.0;
+    for (auto _ : state)
+    {
+        const double p = f.model.probability(inputs[i]);
+        benchmark::DoNotOptimize(p);
+        correct += (p > 0.5) == (d.labels[i] != 0);
+        i = (i + 1) % inputs.size();
+    }
+    state.counters["trees"] = static_cast<double>(f.model.trees());
+    state.counters["nodes"] = static_cast<double>(f.nodes);
+    state.counters["max_depth"] = static_cast<double>(f.max_depth);
+    state.counters["accuracy"] = correct / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SuspicionProbability)->Unit(benchmark::kNanosecond);
+
+// Tick boyutunda toplu skorlama; kategorik kodlama dahil, satır başına süre
+// items_per_second'dan okunur. Sonuç tek örnek yoluyla karşılaştırılır.
+void BM_SuspicionScore(benchmark::State &state)
+{
+    const Forest &f = forest();
+    std::mt19937_64 rng(11);
+    const Data d = makeData(static_cast<std::size_t>(state.range(0)), rng);
+
+    SuspicionBatch batch;
+    std::vector<double> out(d.rows.size());
+    for (auto _ : state)
+    {
+        batch.resize(d.rows.size());
+        for (std::size_t i = 0; i < d.rows.size(); ++i)
+        {
+            const Row &r = d.rows[i];
+            batch.callsign[i] = f.model.callsignCode(kCallsigns[static_cast<int>(r[0])]);
+            batch.status[i] = f.model.statusCode(kStatuses[static_cast<int>(r[1])]);
+            batch.lat[i] = r[2];
+            batch.lon[i] = r[3];
+            batch.speed[i] = r[4];
+            batch.baro_altitude[i] = r[5];
+            batch.geo_altitude[i] = r[6];
+            batch.heading[i] = r[7];
+        }
+        f.model.score(batch, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < d.rows.size(); ++i)
+    {
+        const Row &r = d.rows[i];
+        SuspicionInput in;
+        in.callsign = kCallsigns[static_cast<int>(r[0])];
+        in.status = kStatuses[static_cast<int>(r[1])];
+        in.lat = r[2];
+        in.lon = r[3];
+        in.speed = r[4];
+        in.baro_altitude = r[5];
+        in.geo_altitude = r[6];
+        in.heading = r[7];
+        mismatched += f.model.probability(in) != out[i];
+    }
+    state.counters["mismatched"] = static_cast<double>(mismatched);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SuspicionScore)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,690 @@
+#include "fusionservice.h"
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "timeutil.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct FusionMetrics
+{
+    MetricsRegistry &r = MetricsRegistry::instance();
+    Histogram &frame = r.histogram("fusion_frame_duration_seconds", "Tick birleştirme: rapor snapshot + eşleştirme + mesaj kurma");
+    Histogram &associate = r.histogram("fusion_association_duration_seconds", "Tek kaynak için kapı + global atama (IFF ya da DataLink)");
+    Histogram &score = r.histogram("fusion_scoring_duration_seconds", "Tick'teki tüm izler için şüpheli hedef modeli");
+    Histogram &score_batch = r.histogram("fusion_score_batch_duration_seconds", "ScoreBatch isteğinin skorlanması");
+    Histogram &write = r.histogram("fusion_stream_write_duration_seconds", "Tek bir ServerWriter::Write süresi");
+    Histogram &radar_to_publish = r.histogram("fusion_radar_to_publish_seconds", "Radar sim_time_us'tan frame yayınına kadar geçen süre");
+    Counter &frames = r.counter("fusion_frames_total", "Yayınlanan birleştirilmiş tick'ler");
+    Counter &frames_skipped = r.counter("fusion_frames_skipped_total", "Birleştirme yetişemediği için atlanan radar tick'leri");
+    Counter &radar_late = r.counter("fusion_radar_late_total", "Tick'i kapandıktan sonra gelen radar mesajları");
+    Counter &upstream_errors = r.counter("fusion_upstream_errors_total", "Hata ile biten upstream stream'leri");
+    Counter &messages_sent = r.counter("fusion_messages_sent_total", "Gönderilen FusedFrame parçaları");
+    Counter &score_batch_rows = r.counter("fusion_score_batch_rows_total", "ScoreBatch ile skorlanan satırlar");
+    Gauge &active_streams = r.gauge("fusion_active_streams", "Açık StreamFusedTracks çağrıları");
+    Gauge &tracks = r.gauge("fusion_tracks", "Son tick'teki radar izi");
+    Gauge &iff_matched = r.gauge("fusion_iff_matched", "Son tick'te IFF raporu eşleşen iz");
+    Gauge &datalink_matched = r.gauge("fusion_datalink_matched", "Son tick'te DataLink raporu eşleşen iz");
+    Gauge &iff_reports = r.gauge("fusion_iff_reports", "Kullanılabilir IFF raporu");
+    Gauge &datalink_reports = r.gauge("fusion_datalink_reports", "Kullanılabilir DataLink raporu");
+    Gauge &iff_pass_ms = r.gauge("fusion_iff_pass_ms", "Son IFF beslemesinin tüm kayıtları okuma süresi (ms)");
+    Gauge &datalink_pass_ms = r.gauge("fusion_datalink_pass_ms", "Son DataLink beslemesinin tüm kayıtları okuma süresi (ms)");
+    Gauge &candidates = r.gauge("fusion_association_candidates", "Son tick'te kapı içindeki iz-rapor çifti (IFF + DataLink)");
+    Gauge &suspicious = r.gauge("fusion_suspicious_tracks", "Son tick'te şüpheli (olasılık > 0.5) iz");
+};
+
+FusionMetrics &metrics()
+{
+    static FusionMetrics m;
+    return m;
+}
+
+// proto3 alanlarında "yok" ile 0 ayırt edilemez; 0 irtifa/hız eşleştirmede
+// bilinmiyor sayılır ki eksik alanlı kayıtlar kapıdan düşmesin.
+double knownOrNaN(double v)
+{
+    return v != 0.0 ? v : AssocPoint::kUnknown;
+}
+} // namespace
+
+FusionSettings FusionSettings::fromConfig(const Config &cfg)
+{
+    FusionSettings s;
+    s.gate_m = cfg.getDouble("fusion.gate_m", s.gate_m);
+    s.alt_gate_m = cfg.getDouble("fusion.alt_gate_m", s.alt_gate_m);
+    s.speed_gate_mps = cfg.getDouble("fusion.speed_gate_mps", s.speed_gate_mps);
+    s.report_ttl_s = static_cast<int>(cfg.getInt("fusion.report_ttl_s", s.report_ttl_s));
+    s.frame_quiet_ms = static_cast<int>(cfg.getInt("fusion.frame_quiet_ms", s.frame_quiet_ms));
+    s.tracks_per_message = static_cast<int>(cfg.getInt("fusion.tracks_per_message", s.tracks_per_message));
+    s.model_path = cfg.getString("fusion.model_path", s.model_path);
+
+    if (s.gate_m <= 0.0)
+        s.gate_m = 1.0;
+    if (s.alt_gate_m <= 0.0)
+        s.alt_gate_m = 1.0;
+    if (s.speed_gate_mps <= 0.0)
+        s.speed_gate_mps = 1.0;
+    if (s.report_ttl_s < 1)
+        s.report_ttl_s = 1;
+    if (s.frame_quiet_ms < 1)
+        s.frame_quiet_ms = 1;
+    if (s.tracks_per_message < 1)
+        s.tracks_per_message = 1;
+    return s;
+}
+
+FusionUpstream FusionUpstream::fromConfig(const Config &cfg)
+{
+    FusionUpstream u;
+    u.radar_target = cfg.getString("fusion.radar_target", u.radar_target);
+    u.iff_target = cfg.getString("fusion.iff_target", u.iff_target);
+    u.datalink_target = cfg.getString("fusion.datalink_target", u.datalink_target);
+    u.radar_interval_ms = static_cast<int>(cfg.getInt("fusion.radar_interval_ms", u.radar_interval_ms));
+    u.resubscribe_ms = static_cast<int>(cfg.getInt("fusion.resubscribe_ms", u.resubscribe_ms));
+    if (u.resubscribe_ms < 1)
+        u.resubscribe_ms = 1;
+    return u;
+}
+
+FusionServiceImpl::FusionServiceImpl(FusionUpstream upstream)
+    : upstream_(std::move(upstream)) {}
+
+FusionServiceImpl::~FusionServiceImpl()
+{
+    stop();
+}
+
+void FusionServiceImpl::configure(const FusionSettings &settings)
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    settings_ = settings;
+}
+
+FusionSettings FusionServiceImpl::settings() const
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    return settings_;
+}
+
+bool FusionServiceImpl::loadModel(const std::string &path)
+{
+    std::shared_ptr<SuspicionModel> model;
+    if (!path.empty())
+    {
+        model = std::make_shared<SuspicionModel>();
+        std::string error;
+        if (!model->load(path, &error))
+        {
+            Logger::instance().log(LogLevel::Warn, "FUSION",
+                                   {{"msg", "şüpheli hedef modeli yüklenemedi"}, {"what", error}});
+            return false;
+        }
+        Logger::instance().log(LogLevel::Info, "FUSION",
+                               {{"msg", "şüpheli hedef modeli yüklendi"},
+                                {"path", path},
+                                {"trees", model->trees()},
+                                {"nodes", model->nodes()}});
+    }
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    model_ = std::move(model);
+    return true;
+}
+
+void FusionServiceImpl::start()
+{
+    if (!threads_.empty())
+        return;
+    stopping_ = false;
+
+    threads_.emplace_back(&FusionServiceImpl::runRadarFeed, this);
+
+    threads_.emplace_back([this]
+                          {
+        auto stub = iff::IFFService::NewStub(
+            grpc::CreateChannel(upstream_.iff_target, grpc::InsecureChannelCredentials()));
+        runReportFeed<iff::IFFStreamResponse>(
+            "IFF",
+            [&stub](grpc::ClientContext *ctx)
+            {
+                iff::IFFRequest req;
+                req.set_unpaced(true);
+                return stub->StreamIFFData(ctx, req);
+            },
+            [](const iff::IFFStreamResponse &resp, Report &out)
+            {
+                const iff::IFFData &d = resp.data();
+                out.id = d.id();
+                out.callsign = d.callsign();
+                out.status = d.status();
+                out.lat = d.lat();
+                out.lon = d.lon();
+            },
+            iff_, metrics().iff_pass_ms); });
+
+    threads_.emplace_back([this]
+                          {
+        auto stub = datalink::DataLink::NewStub(
+            grpc::CreateChannel(upstream_.datalink_target, grpc::InsecureChannelCredentials()));
+        runReportFeed<datalink::DLStreamResponse>(
+            "DATALINK",
+            [&stub](grpc::ClientContext *ctx)
+            {
+                datalink::DLRequest req;
+                req.set_unpaced(true);
+                return stub->StreamDataLink(ctx, req);
+            },
+            [](const datalink::DLStreamResponse &resp, Report &out)
+            {
+                const datalink::DLData &d = resp.data();
+                out.id = d.id();
+                out.callsign = d.callsign();
+                out.status = d.status();
+                out.lat = d.lat();
+                out.lon = d.lon();
+                out.alt_m = knownOrNaN(d.baroalt());
+                out.speed_mps = knownOrNaN(d.velocity());
+            },
+            datalink_, metrics().datalink_pass_ms); });
+
+    threads_.emplace_back(&FusionServiceImpl::runFusionLoop, this);
+}
+
+void FusionServiceImpl::stop()
+{
+    if (threads_.empty())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stopping_ = true;
+    }
+    stop_cv_.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        for (grpc::ClientContext *ctx : calls_)
+            ctx->TryCancel();
+    }
+    radar_cv_.notify_all();
+    frame_cv_.notify_all();
+
+    for (std::thread &t : threads_)
+        t.join();
+    threads_.clear();
+}
+
+bool FusionServiceImpl::registerCall(grpc::ClientContext *ctx)
+{
+    std::lock_guard<std::mutex> lock(calls_mutex_);
+    if (stopping_)
+        return false;
+    calls_.push_back(ctx);
+    return true;
+}
+
+void FusionServiceImpl::unregisterCall(grpc::ClientContext *ctx)
+{
+    std::lock_guard<std::mutex> lock(calls_mutex_);
+    calls_.erase(std::remove(calls_.begin(), calls_.end(), ctx), calls_.end());
+}
+
+void FusionServiceImpl::waitRetry(int ms)
+{
+    std::unique_lock<std::mutex> lock(stop_mutex_);
+    stop_cv_.wait_for(lock, std::chrono::milliseconds(ms), [this]
+                      { return stopping_.load(); });
+}
+
+// ---------------------------------------------------------------------------
+// Upstream okuyucuları
+
+void FusionServiceImpl::runRadarFeed()
+{
+    auto stub = radar::RadarService::NewStub(
+        grpc::CreateChannel(upstream_.radar_target, grpc::InsecureChannelCredentials()));
+
+    while (!stopping_)
+    {
+        grpc::ClientContext ctx;
+        if (!registerCall(&ctx))
+            break;
+
+        radar::StreamRequest req;
+        req.set_refresh_interval_ms(upstream_.radar_interval_ms);
+        req.set_web_mercator(true);
+        // Eşleştirme zıplayan ham konumla değil, filtrelenmiş konumla yapılır.
+        req.set_smoothed(true);
+        auto reader = stub->StreamRadarTargets(&ctx, req);
+
+        // Yeni stream'in tick sayacı baştan başlar.
+        {
+            std::lock_guard<std::mutex> lock(radar_mutex_);
+            radar_pending_.clear();
+            closed_tick_ = 0;
+        }
+
+        radar::RadarTarget msg;
+        while (reader->Read(&msg))
+            onRadarTarget(msg);
+        const grpc::Status status = reader->Finish();
+        unregisterCall(&ctx);
+        if (stopping_)
+            break;
+
+        if (!status.ok())
+            metrics().upstream_errors.inc();
+        Logger::instance().log(LogLevel::Warn, "RADAR",
+                               {{"msg", "radar stream'i bitti, yeniden abone olunacak"},
+                                {"target", upstream_.radar_target},
+                                {"code", static_cast<int>(status.error_code())},
+                                {"what", status.error_message()}});
+        waitRetry(upstream_.resubscribe_ms);
+    }
+}
+
+void FusionServiceImpl::onRadarTarget(const radar::RadarTarget &msg)
+{
+    std::lock_guard<std::mutex> lock(radar_mutex_);
+    if (msg.tick() <= closed_tick_)
+    {
+        metrics().radar_late.inc();
+        return;
+    }
+    if (!radar_pending_.empty() && msg.tick() != pending_tick_)
+    {
+        closeRadarTickLocked();
+        radar_cv_.notify_one();
+    }
+
+    RadarTrack t;
+    t.id = msg.id();
+    t.lat = msg.lat();
+    t.lon = msg.lon();
+    t.velocity = msg.velocity();
+    t.baro_altitude = msg.baro_altitude();
+    t.geo_altitude = msg.geo_altitude();
+    t.heading = msg.heading();
+    t.merc_x = msg.merc_x();
+    t.merc_y = msg.merc_y();
+    radar_pending_.push_back(std::move(t));
+    pending_tick_ = msg.tick();
+    pending_sim_time_us_ = msg.sim_time_us();
+    last_radar_msg_ = std::chrono::steady_clock::now();
+}
+
+// radar_mutex_ tutulurken çağrılır. Birleştirme döngüsü önceki tick'i henüz
+// almadıysa o tick atlanır; her zaman en yeni tick işlenir.
+void FusionServiceImpl::closeRadarTickLocked()
+{
+    if (ready_)
+        metrics().frames_skipped.inc();
+    radar_ready_.swap(radar_pending_);
+    radar_pending_.clear();
+    ready_sim_time_us_ = pending_sim_time_us_;
+    closed_tick_ = pending_tick_;
+    ready_ = true;
+}
+
+// IFF ve DataLink okuyucusu. Her iki servis de kayıtlarını bir kez gönderip
+// stream'i bitirir; okuyucu resubscribe_ms sonra yeniden abone olur ve
+// raporları id'ye göre günceller. Kayıtlar pacing'siz (unpaced) istenir:
+// pacing_ms aralıkla gelselerdi ~600 kayıttan sonra bir tur report_ttl_s'i
+// aşar, raporlar yenilenmeden düşerdi. Tur yine de TTL'den uzun sürerse
+// (çok büyük kaynak) uyarı loglanır; süre pass_ms'te izlenir.
+template <typename Response, typename OpenFn, typename ToReportFn>
+void FusionServiceImpl::runReportFeed(const char *name, OpenFn &&open, ToReportFn &&to_report, ReportTable &table,
+                                      Gauge &pass_ms)
+{
+    bool ttl_warned = false;
+    while (!stopping_)
+    {
+        grpc::ClientContext ctx;
+        if (!registerCall(&ctx))
+            break;
+
+        const auto pass_start = std::chrono::steady_clock::now();
+        auto reader = open(&ctx);
+        Response resp;
+        Report report;
+        while (reader->Read(&resp))
+        {
+            to_report(resp, report);
+            report.received_us = unix_micros();
+            std::lock_guard<std::mutex> lock(table.mutex);
+            table.by_id[report.id] = report;
+        }
+        const grpc::Status status = reader->Finish();
+        unregisterCall(&ctx);
+        if (stopping_)
+            break;
+
+        if (status.ok())
+        {
+            const int64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                           std::chrono::steady_clock::now() - pass_start)
+                                           .count();
+            pass_ms.set(elapsed_ms);
+            const int64_t refresh_ms = elapsed_ms + upstream_.resubscribe_ms;
+            const int64_t ttl_ms = static_cast<int64_t>(settings().report_ttl_s) * 1000;
+            if (refresh_ms > ttl_ms && !ttl_warned)
+                Logger::instance().log(LogLevel::Warn, name,
+                                       {{"msg", "tur report_ttl_s'ten uzun, raporlar yenilenmeden düşecek"},
+                                        {"pass_ms", elapsed_ms},
+                                        {"resubscribe_ms", upstream_.resubscribe_ms},
+                                        {"report_ttl_s", settings().report_ttl_s}});
+            ttl_warned = refresh_ms > ttl_ms;
+        }
+
+        if (!status.ok())
+        {
+            metrics().upstream_errors.inc();
+            Logger::instance().log(LogLevel::Warn, name,
+                                   {{"msg", "upstream stream hatası, yeniden abone olunacak"},
+                                    {"code", static_cast<int>(status.error_code())},
+                                    {"what", status.error_message()}});
+        }
+        waitRetry(upstream_.resubscribe_ms);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Birleştirme
+
+void FusionServiceImpl::runFusionLoop()
+{
+    while (!stopping_)
+    {
+        const int quiet_ms = settings().frame_quiet_ms;
+        int64_t sim_time_us = 0;
+        {
+            std::unique_lock<std::mutex> lock(radar_mutex_);
+            radar_cv_.wait_for(lock, std::chrono::milliseconds(quiet_ms), [this]
+                               { return ready_ || stopping_; });
+            if (stopping_)
+                break;
+            if (!ready_)
+            {
+                // Radar tick'i bitirdi ama sonraki tick henüz başlamadı.
+                if (radar_pending_.empty() ||
+                    std::chrono::steady_clock::now() - last_radar_msg_ < std::chrono::milliseconds(quiet_ms))
+                    continue;
+                closeRadarTickLocked();
+            }
+            frame_tracks_.swap(radar_ready_);
+            sim_time_us = ready_sim_time_us_;
+            ready_ = false;
+        }
+
+        fuseFrame(sim_time_us);
+    }
+}
+
+void FusionServiceImpl::snapshotReports(ReportTable &table, int64_t min_received_us, std::vector<Report> &out)
+{
+    out.clear();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    for (auto it = table.by_id.begin(); it != table.by_id.end();)
+    {
+        if (it->second.received_us < min_received_us)
+        {
+            it = table.by_id.erase(it);
+            continue;
+        }
+        out.push_back(it->second);
+        ++it;
+    }
+}
+
+void FusionServiceImpl::fuseFrame(int64_t sim_time_us)
+{
+    ScopedTimer frame_timer(metrics().frame);
+    FusionSettings s;
+    std::shared_ptr<const SuspicionModel> model;
+    {
+        std::lock_guard<std::mutex> lock(settings_mutex_);
+        s = settings_;
+        model = model_;
+    }
+
+    const int64_t min_received_us = unix_micros() - static_cast<int64_t>(s.report_ttl_s) * 1000000;
+    snapshotReports(iff_, min_received_us, iff_reports_);
+    snapshotReports(datalink_, min_received_us, dl_reports_);
+
+    track_points_.resize(frame_tracks_.size());
+    for (std::size_t i = 0; i < frame_tracks_.size(); ++i)
+    {
+        const RadarTrack &t = frame_tracks_[i];
+        track_points_[i] = AssocPoint{t.lat, t.lon, knownOrNaN(t.baro_altitude), knownOrNaN(t.velocity)};
+    }
+
+    associator_.setGates(AssocGates{s.gate_m, s.alt_gate_m, s.speed_gate_mps});
+    std::size_t candidates = 0;
+    auto associate = [&](const std::vector<Report> &reports, std::vector<int32_t> &match, std::vector<double> &dist)
+    {
+        ScopedTimer timer(metrics().associate);
+        report_points_.resize(reports.size());
+        for (std::size_t i = 0; i < reports.size(); ++i)
+            report_points_[i] = AssocPoint{reports[i].lat, reports[i].lon, reports[i].alt_m, reports[i].speed_mps};
+        const std::size_t matched = associator_.associate(track_points_, report_points_, match, dist);
+        candidates += associator_.candidates();
+        return matched;
+    };
+    const std::size_t iff_matched = associate(iff_reports_, iff_match_, iff_distance_);
+    const std::size_t dl_matched = associate(dl_reports_, dl_match_, dl_distance_);
+
+    // Kimlik için IFF esastır; DataLink sadece IFF eşleşmesi yoksa kullanılır.
+    identity_.resize(frame_tracks_.size());
+    for (std::size_t i = 0; i < frame_tracks_.size(); ++i)
+    {
+        if (iff_match_[i] != Associator::kNoMatch)
+            identity_[i] = &iff_reports_[iff_match_[i]];
+        else if (dl_match_[i] != Associator::kNoMatch)
+            identity_[i] = &dl_reports_[dl_match_[i]];
+        else
+            identity_[i] = nullptr;
+    }
+
+    // Şüpheli hedef skoru; girdiler client'a giden birleştirilmiş izle aynıdır.
+    std::size_t suspicious = 0;
+    if (model)
+    {
+        ScopedTimer timer(metrics().score);
+        score_batch_.resize(frame_tracks_.size());
+        const uint32_t unknown_callsign = model->callsignCode("UNKNOWN");
+        const uint32_t unknown_status = model->statusCode("UNKNOWN");
+        for (std::size_t i = 0; i < frame_tracks_.size(); ++i)
+        {
+            const RadarTrack &t = frame_tracks_[i];
+            const Report *ident = identity_[i];
+            score_batch_.callsign[i] = ident ? model->callsignCode(ident->callsign) : unknown_callsign;
+            score_batch_.status[i] = ident ? model->statusCode(ident->status) : unknown_status;
+            score_batch_.lat[i] = t.lat;
+            score_batch_.lon[i] = t.lon;
+            score_batch_.speed[i] = t.velocity;
+            score_batch_.baro_altitude[i] = t.baro_altitude;
+            score_batch_.geo_altitude[i] = t.geo_altitude;
+            score_batch_.heading[i] = t.heading;
+        }
+        suspicion_.resize(frame_tracks_.size());
+        model->score(score_batch_, suspicion_.data());
+        for (double p : suspicion_)
+            suspicious += p > 0.5;
+    }
+
+    auto frame = std::make_shared<PublishedFrame>();
+    frame->tick = ++fusion_tick_;
+    const std::size_t per_part = static_cast<std::size_t>(s.tracks_per_message);
+    frame->parts.reserve(frame_tracks_.size() / per_part + 1);
+
+    for (std::size_t i = 0; i < frame_tracks_.size(); ++i)
+    {
+        if (frame->parts.empty() || static_cast<std::size_t>(frame->parts.back().tracks_size()) >= per_part)
+        {
+            frame->parts.emplace_back();
+            frame->parts.back().mutable_tracks()->Reserve(
+                static_cast<int>(std::min(per_part, frame_tracks_.size() - i)));
+        }
+
+        const RadarTrack &t = frame_tracks_[i];
+        fusion::FusedTrack &out = *frame->parts.back().add_tracks();
+        out.set_radar_id(t.id);
+        out.set_lat(t.lat);
+        out.set_lon(t.lon);
+        out.set_velocity(t.velocity);
+        out.set_baro_altitude(t.baro_altitude);
+        out.set_geo_altitude(t.geo_altitude);
+        out.set_heading(t.heading);
+        out.set_merc_x(t.merc_x);
+        out.set_merc_y(t.merc_y);
+
+        const Report *iff = iff_match_[i] != Associator::kNoMatch ? &iff_reports_[iff_match_[i]] : nullptr;
+        const Report *dl = dl_match_[i] != Associator::kNoMatch ? &dl_reports_[dl_match_[i]] : nullptr;
+        if (iff)
+        {
+            out.set_iff_id(iff->id);
+            out.set_iff_distance_m(iff_distance_[i]);
+        }
+        if (dl)
+        {
+            out.set_datalink_id(dl->id);
+            out.set_datalink_distance_m(dl_distance_[i]);
+        }
+        const Report *ident = identity_[i];
+        out.set_callsign(ident ? ident->callsign : "UNKNOWN");
+        out.set_status(ident ? ident->status : "UNKNOWN");
+        if (model)
+        {
+            out.set_suspicious_probability(suspicion_[i]);
+            out.set_suspicious(suspicion_[i] > 0.5);
+        }
+    }
+
+    // Radar boş tick gönderdiyse de client'lar haritayı temizleyebilsin.
+    if (frame->parts.empty())
+        frame->parts.emplace_back();
+
+    const int64_t publish_us = unix_micros();
+    for (fusion::FusedFrame &part : frame->parts)
+    {
+        part.set_seq(++part_seq_);
+        part.set_tick(frame->tick);
+        part.set_sim_time_us(sim_time_us);
+        part.set_enqueue_time_us(publish_us);
+        part.set_total_tracks(static_cast<uint32_t>(frame_tracks_.size()));
+        part.set_iff_matched(static_cast<uint32_t>(iff_matched));
+        part.set_datalink_matched(static_cast<uint32_t>(dl_matched));
+        part.set_scored(model != nullptr);
+    }
+    frame->parts.back().set_last(true);
+
+    metrics().tracks.set(static_cast<int64_t>(frame_tracks_.size()));
+    metrics().iff_matched.set(static_cast<int64_t>(iff_matched));
+    metrics().datalink_matched.set(static_cast<int64_t>(dl_matched));
+    metrics().candidates.set(static_cast<int64_t>(candidates));
+    metrics().suspicious.set(static_cast<int64_t>(suspicious));
+    metrics().iff_reports.set(static_cast<int64_t>(iff_reports_.size()));
+    metrics().datalink_reports.set(static_cast<int64_t>(dl_reports_.size()));
+    metrics().frames.inc();
+    metrics().radar_to_publish.record(micros_since(sim_time_us, publish_us));
+
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex_);
+        frame_ = std::move(frame);
+    }
+    frame_cv_.notify_all();
+}
+
+// ---------------------------------------------------------------------------
+
+grpc::Status FusionServiceImpl::StreamFusedTracks(
+    grpc::ServerContext *context,
+    const fusion::FusionRequest * /*request*/,
+    grpc::ServerWriter<fusion::FusedFrame> *writer)
+{
+    GaugeGuard stream_guard(metrics().active_streams);
+
+    // Client yavaşsa ara tick'ler atlanır; her zaman en son frame gönderilir.
+    uint64_t sent_tick = 0;
+    while (!context->IsCancelled() && !stopping_)
+    {
+        std::shared_ptr<const PublishedFrame> frame;
+        {
+            std::unique_lock<std::mutex> lock(frame_mutex_);
+            // İptal kontrolü için bekleme en fazla 250 ms sürer.
+            frame_cv_.wait_for(lock, std::chrono::milliseconds(250), [&]
+                               { return (frame_ && frame_->tick != sent_tick) || stopping_; });
+            if (!frame_ || frame_->tick == sent_tick)
+                continue;
+            frame = frame_;
+        }
+
+        for (const fusion::FusedFrame &part : frame->parts)
+        {
+            const auto write_start = std::chrono::steady_clock::now();
+            const bool written = writer->Write(part);
+            metrics().write.record(std::chrono::steady_clock::now() - write_start);
+            if (!written)
+            {
+                Logger::instance().log(LogLevel::Info, "FUSION", {{"msg", "Writer kapandı, client ayrıldı"}});
+                return grpc::Status::OK;
+            }
+            metrics().messages_sent.inc();
+        }
+        sent_tick = frame->tick;
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status FusionServiceImpl::ScoreBatch(
+    grpc::ServerContext * /*context*/,
+    const fusion::ScoreBatchRequest *request,
+    fusion::ScoreBatchResponse *response)
+{
+    std::shared_ptr<const SuspicionModel> model;
+    {
+        std::lock_guard<std::mutex> lock(settings_mutex_);
+        model = model_;
+    }
+    if (!model)
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "şüpheli hedef modeli yüklü değil");
+
+    // Sayısal sütunlar aynı uzunlukta olmalı; callsign / status boş
+    // bırakılırsa tüm satırlar UNKNOWN sayılır.
+    const int n = request->lat_size();
+    if (request->lon_size() != n || request->speed_size() != n || request->baro_altitude_size() != n ||
+        request->geo_altitude_size() != n || request->heading_size() != n)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "sütun uzunlukları farklı");
+    if ((request->callsign_size() != 0 && request->callsign_size() != n) ||
+        (request->status_size() != 0 && request->status_size() != n))
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "callsign / status uzunluğu satır sayısından farklı");
+
+    ScopedTimer timer(metrics().score_batch);
+    SuspicionBatch batch;
+    batch.resize(static_cast<std::size_t>(n));
+    const uint32_t unknown_callsign = model->callsignCode("UNKNOWN");
+    const uint32_t unknown_status = model->statusCode("UNKNOWN");
+    for (int i = 0; i < n; ++i)
+    {
+        batch.callsign[i] = request->callsign_size() ? model->callsignCode(request->callsign(i)) : unknown_callsign;
+        batch.status[i] = request->status_size() ? model->statusCode(request->status(i)) : unknown_status;
+    }
+    std::copy(request->lat().begin(), request->lat().end(), batch.lat.begin());
+    std::copy(request->lon().begin(), request->lon().end(), batch.lon.begin());
+    std::copy(request->speed().begin(), request->speed().end(), batch.speed.begin());
+    std::copy(request->baro_altitude().begin(), request->baro_altitude().end(), batch.baro_altitude.begin());
+    std::copy(request->geo_altitude().begin(), request->geo_altitude().end(), batch.geo_altitude.begin());
+    std::copy(request->heading().begin(), request->heading().end(), batch.heading.begin());
+
+    response->mutable_probability()->Resize(n, 0.0);
+    model->score(batch, response->mutable_probability()->mutable_data());
+    metrics().score_batch_rows.inc(static_cast<uint64_t>(n));
+    return grpc::Status::OK;
+}
@@ -0,0 +1,194 @@
+#ifndef FUSIONSERVICE_H
+#define FUSIONSERVICE_H
+
+#include "fusion.grpc.pb.h"
+#include "radar.grpc.pb.h"
+#include "iff.grpc.pb.h"
+#include "datalink.grpc.pb.h"
+#include "association.h"
+#include "suspicionmodel.h"
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class Config;
+class Gauge;
+
+// Çalışma anında (SIGHUP) değiştirilebilen ayarlar; config'te fusion.*.
+struct FusionSettings
+{
+    double gate_m = 5000.0;       // radar izi ile rapor arasındaki en büyük mesafe
+    double alt_gate_m = 300.0;    // barometrik irtifa farkı kapısı (iki tarafta da varsa)
+    double speed_gate_mps = 60.0; // yer hızı farkı kapısı (iki tarafta da varsa)
+    int report_ttl_s = 30;        // bu süredir güncellenmeyen IFF/DataLink raporu kullanılmaz
+    int frame_quiet_ms = 50;      // radar bu süre sessiz kalırsa tick tamamlanmış sayılır
+    int tracks_per_message = 1000; // FusedFrame parçası başına iz
+    std::string model_path; // şüpheli hedef modeli (ai/export_model.py çıktısı); boşsa skor üretilmez
+
+    static FusionSettings fromConfig(const Config &cfg);
+};
+
+// Upstream servis adresleri; sadece başlangıçta okunur.
+struct FusionUpstream
+{
+    std::string radar_target = "localhost:50053";
+    std::string iff_target = "localhost:50051";
+    std::string datalink_target = "localhost:50052";
+    int radar_interval_ms = 1000; // radar'dan istenen refresh_interval_ms
+    int resubscribe_ms = 1000;    // biten/kopan upstream stream'i yeniden açma beklemesi
+
+    static FusionUpstream fromConfig(const Config &cfg);
+};
+
+// Radar, IFF ve DataLink stream'lerine tek kez abone olur, her radar
+// tick'inde izleri raporlarla konum, irtifa ve hıza göre eşleştirir ve
+// sonucu tüm StreamFusedTracks client'larına aynı frame olarak yayınlar.
+class FusionServiceImpl final : public fusion::FusionService::Service
+{
+public:
+    explicit FusionServiceImpl(FusionUpstream upstream);
+    ~FusionServiceImpl() override;
+
+    // Upstream okuyucularını ve birleştirme döngüsünü başlatır / durdurur.
+    void start();
+    void stop();
+
+    // Sonraki tick'ten itibaren geçerli olur.
+    void configure(const FusionSettings &settings);
+    FusionSettings settings() const;
+
+    // Şüpheli hedef modelini (ai/export_model.py çıktısı) yükler; sonraki
+    // tick'ten itibaren izler skorlanır. Boş yol modeli kaldırır. Dosya
+    // okunamazsa önceki model kullanılmaya devam eder.
+    bool loadModel(const std::string &path);
+
+    grpc::Status StreamFusedTracks(
+        grpc::ServerContext *context,
+        const fusion::FusionRequest *request,
+        grpc::ServerWriter<fusion::FusedFrame> *writer) override;
+
+    // Sütun düzenindeki satırları yüklü modelle skorlar (tick dışı, örn.
+    // kayıtlı veri ya da başka bir servisin hedefleri).
+    grpc::Status ScoreBatch(
+        grpc::ServerContext *context,
+        const fusion::ScoreBatchRequest *request,
+        fusion::ScoreBatchResponse *response) override;
+
+private:
+    struct RadarTrack
+    {
+        std::string id;
+        double lat = 0.0;
+        double lon = 0.0;
+        int32_t velocity = 0;
+        int32_t baro_altitude = 0;
+        int32_t geo_altitude = 0;
+        double heading = 0.0;
+        double merc_x = 0.0;
+        double merc_y = 0.0;
+    };
+
+    struct Report
+    {
+        std::string id;
+        std::string callsign;
+        std::string status;
+        double lat = 0.0;
+        double lon = 0.0;
+        double alt_m = AssocPoint::kUnknown;
+        double speed_mps = AssocPoint::kUnknown;
+        int64_t received_us = 0;
+    };
+
+    // IFF/DataLink raporlarının id'ye göre son hali.
+    struct ReportTable
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, Report> by_id;
+    };
+
+    // Yayınlanan tick; parçalar bir kez kurulur, stream'ler paylaşır.
+    struct PublishedFrame
+    {
+        uint64_t tick = 0;
+        std::vector<fusion::FusedFrame> parts;
+    };
+
+    void runRadarFeed();
+    template <typename Response, typename OpenFn, typename ToReportFn>
+    void runReportFeed(const char *name, OpenFn &&open, ToReportFn &&to_report, ReportTable &table,
+                       Gauge &pass_ms);
+    void runFusionLoop();
+
+    void onRadarTarget(const radar::RadarTarget &msg);
+    void closeRadarTickLocked();
+    void fuseFrame(int64_t sim_time_us);
+    static void snapshotReports(ReportTable &table, int64_t min_received_us, std::vector<Report> &out);
+
+    // stop() bekleyen upstream çağrılarını iptal edebilsin diye kaydedilir.
+    bool registerCall(grpc::ClientContext *ctx);
+    void unregisterCall(grpc::ClientContext *ctx);
+    void waitRetry(int ms);
+
+    FusionUpstream upstream_;
+    FusionSettings settings_;
+    std::shared_ptr<const SuspicionModel> model_;
+    mutable std::mutex settings_mutex_;
+
+    std::atomic<bool> stopping_{false};
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    std::vector<std::thread> threads_;
+    std::mutex calls_mutex_;
+    std::vector<grpc::ClientContext *> calls_;
+
+    // Radar okuyucusu -> birleştirme döngüsü. Tick, bir sonraki tick'in ilk
+    // mesajı geldiğinde ya da radar frame_quiet_ms boyunca sessiz kalınca
+    // kapanır.
+    std::mutex radar_mutex_;
+    std::condition_variable radar_cv_;
+    std::vector<RadarTrack> radar_pending_;
+    uint64_t pending_tick_ = 0;
+    int64_t pending_sim_time_us_ = 0;
+    std::chrono::steady_clock::time_point last_radar_msg_;
+    uint64_t closed_tick_ = 0;
+    std::vector<RadarTrack> radar_ready_;
+    int64_t ready_sim_time_us_ = 0;
+    bool ready_ = false;
+
+    ReportTable iff_;
+    ReportTable datalink_;
+
+    // Birleştirme döngüsünün tick'ler arasında yeniden kullandığı tamponlar.
+    std::vector<RadarTrack> frame_tracks_;
+    std::vector<Report> iff_reports_;
+    std::vector<Report> dl_reports_;
+    std::vector<AssocPoint> track_points_;
+    std::vector<AssocPoint> report_points_;
+    std::vector<int32_t> iff_match_;
+    std::vector<int32_t> dl_match_;
+    std::vector<double> iff_distance_;
+    std::vector<double> dl_distance_;
+    std::vector<const Report *> identity_;
+    SuspicionBatch score_batch_;
+    std::vector<double> suspicion_;
+    Associator associator_;
+    uint64_t fusion_tick_ = 0;
+    uint64_t part_seq_ = 0;
+
+    // Birleştirme döngüsü -> StreamFusedTracks.
+    std::mutex frame_mutex_;
+    std::condition_variable frame_cv_;
+    std::shared_ptr<const PublishedFrame> frame_;
+};
+
+#endif
@@ -0,0 +1,81 @@
+// Radar, IFF ve DataLink stream'lerini birleştiren fusion servisi. Üç
+// servise client olarak abone olur, radar izlerini raporlarla konum, irtifa
+// ve hıza göre eşleştirir ve tick başına birleştirilmiş frame yayınlar.
+//
+//   fusion --config config/aewc.conf --fusion.gate_m=3000
+
+#include "fusionservice.h"
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "serverconfig.h"
+#include <grpcpp/grpcpp.h>
+#include <iostream>
+#include <memory>
+#include <string>
+
+int main(int argc, char** argv) {
+
+    // --config fusion.conf ve --anahtar=değer override'ları (bkz. config/aewc.conf).
+    Config cfg;
+    std::string cfg_error;
+    if (!cfg.load(argc, argv, &cfg_error)) {
+        std::cerr << "[ERROR] " << cfg_error << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string server_address = cfg.getString("fusion.address", "0.0.0.0:50054");
+    const FusionUpstream upstream = FusionUpstream::fromConfig(cfg);
+
+    Logger::instance().start(logger_options(cfg));
+
+    MetricsRegistry::instance().callbackGauge("aewc_log_records_dropped", "Kuyruk dolu olduğu için düşürülen log kayıtları",
+                                              [] { return static_cast<double>(Logger::instance().dropped()); });
+    MetricsServer metrics_server;
+    metrics_server.start(static_cast<uint16_t>(cfg.getInt("fusion.metrics_port", MetricsServer::portFromEnv(9254))));
+
+    try {
+
+        FusionServiceImpl service(upstream);
+        const FusionSettings settings = FusionSettings::fromConfig(cfg);
+        service.configure(settings);
+        service.loadModel(settings.model_path);
+
+        // SIGHUP: fusion.gate_m, alt_gate_m, speed_gate_mps, report_ttl_s, frame_quiet_ms,
+        // tracks_per_message, model_path (model dosyası yeniden okunur) ve log.level.
+        ConfigWatcher watcher;
+        watcher.start(cfg, [&service](const Config& c) {
+            const FusionSettings s = FusionSettings::fromConfig(c);
+            service.configure(s);
+            service.loadModel(s.model_path);
+            Logger::instance().setLevel(logger_options(c).level);
+        });
+
+        grpc::ServerBuilder builder;
+        apply_server_config(cfg, builder);
+        builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+        builder.RegisterService(&service);
+
+        std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+        if (!server) {
+            std::cerr << "[ERROR] gRPC server başlatılamadı." << std::endl;
+            return EXIT_FAILURE;
+        }
+        service.start();
+
+        std::cout << "[INFO] Fusion Service listening on " << server_address << std::endl;
+        std::cout << "[INFO] Upstream: radar " << upstream.radar_target << ", iff " << upstream.iff_target
+                  << ", datalink " << upstream.datalink_target << std::endl;
+        if (!cfg.path().empty())
+            std::cout << "[INFO] Yapılandırma: " << cfg.path() << " (SIGHUP ile yeniden yüklenir)" << std::endl;
+        std::cout << "[INFO] CTRL+C ile durdurabilirsiniz." << std::endl;
+
+        server->Wait();
+        service.stop();
+    } catch (const std::exception& e) {
+        std::cerr << "[ERROR] Sunucu başlatılamadı: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
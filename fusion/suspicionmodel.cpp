@@ -0,0 +1,403 @@
+#include "suspicionmodel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace
+{
+constexpr const char *kMagic = "aewc-suspicious-model";
+constexpr int kVersion = 1;
+constexpr std::size_t kMaxTrees = 100000;
+constexpr std::size_t kMaxNodesPerTree = 1u << 26;
+
+// Girdi sütunlarının eğitimdeki adları (SuspicionModel::Column sırasıyla).
+const std::string kColumnNames[] = {"callsign", "friend_foe", "lat", "lon", "speed", "baroAltitude", "geoAltitude", "heading"};
+
+// '#' ile başlayan satırları atlayarak sonraki kelimeyi okur.
+bool nextWord(std::istream &in, std::string &word)
+{
+    while (in >> word)
+    {
+        if (word[0] != '#')
+            return true;
+        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return false;
+}
+
+bool fail(std::string *error, const std::string &msg)
+{
+    if (error)
+        *error = msg;
+    return false;
+}
+
+const float kLeafThreshold = std::numeric_limits<float>::quiet_NaN();
+
+// float x için x <= t ancak ve ancak x <= floatAtMost(t).
+float floatAtMost(double t)
+{
+    if (t >= std::numeric_limits<float>::max())
+        return std::numeric_limits<float>::max();
+    if (t < -std::numeric_limits<float>::max())
+        return -std::numeric_limits<float>::infinity();
+    float f = static_cast<float>(t);
+    if (static_cast<double>(f) > t)
+        f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+    return f;
+}
+
+// LabelEncoder'da UNKNOWN yoksa predict servisi gibi sona eklenmiş sayılır.
+uint32_t unknownIndex(const std::vector<std::string> &classes)
+{
+    const auto it = std::find(classes.begin(), classes.end(), "UNKNOWN");
+    return static_cast<uint32_t>(it - classes.begin());
+}
+} // namespace
+
+bool SuspicionModel::load(const std::string &path, std::string *error)
+{
+    std::ifstream in(path);
+    if (!in)
+        return fail(error, "model dosyası açılamadı: " + path);
+    std::string parse_error;
+    if (!parse(in, &parse_error))
+        return fail(error, path + ": " + parse_error);
+    return true;
+}
+
+bool SuspicionModel::parse(std::istream &in, std::string *error)
+{
+    SuspicionModel m;
+    std::string word;
+    int version = 0;
+    if (!nextWord(in, word) || word != kMagic || !(in >> version) || version != kVersion)
+        return fail(error, "başlık tanınmadı (aewc-suspicious-model 1 bekleniyor)");
+
+    bool have_features = false, have_callsign = false, have_status = false, have_mean = false, have_scale = false;
+    while (nextWord(in, word))
+    {
+        if (word == "features")
+        {
+            std::size_t n = 0;
+            if (!(in >> n) || n != kColumns)
+                return fail(error, "features: 8 sütun bekleniyor");
+            bool seen[kColumns] = {};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (!(in >> word))
+                    return fail(error, "features satırı eksik");
+                const auto it = std::find(std::begin(kColumnNames), std::end(kColumnNames), word);
+                if (it == std::end(kColumnNames))
+                    return fail(error, "bilinmeyen özellik: " + word);
+                const auto col = static_cast<uint32_t>(it - std::begin(kColumnNames));
+                if (seen[col])
+                    return fail(error, "özellik iki kez verilmiş: " + word);
+                seen[col] = true;
+                m.column_of_[i] = col;
+            }
+            have_features = true;
+        }
+        else if (word == "classes")
+        {
+            std::string column;
+            std::size_t k = 0;
+            if (!(in >> column >> k) || k == 0 || k > kMaxNodesPerTree)
+                return fail(error, "classes satırı okunamadı");
+            std::vector<std::string> classes(k);
+            for (std::string &c : classes)
+                if (!(in >> c))
+                    return fail(error, "classes " + column + " eksik");
+            if (column == kColumnNames[kCallsign])
+            {
+                m.callsign_classes_ = std::move(classes);
+                have_callsign = true;
+            }
+            else if (column == kColumnNames[kStatus])
+            {
+                m.status_classes_ = std::move(classes);
+                have_status = true;
+            }
+            else
+                return fail(error, "kategorik olmayan sütun için classes: " + column);
+        }
+        else if (word == "mean" || word == "scale")
+        {
+            double *dst = word == "mean" ? m.mean_ : m.scale_;
+            std::size_t n = 0;
+            if (!(in >> n) || n != kColumns)
+                return fail(error, word + ": 8 değer bekleniyor");
+            for (std::size_t i = 0; i < n; ++i)
+                if (!(in >> dst[i]))
+                    return fail(error, word + " satırı okunamadı");
+            (word == "mean" ? have_mean : have_scale) = true;
+        }
+        else if (word == "trees")
+        {
+            if (!have_features || !have_callsign || !have_status || !have_mean || !have_scale)
+                return fail(error, "trees'ten önce features, classes, mean ve scale gerekli");
+            std::size_t count = 0;
+            if (!(in >> count) || count == 0 || count > kMaxTrees)
+                return fail(error, "trees: geçersiz ağaç sayısı");
+            for (std::size_t t = 0; t < count; ++t)
+            {
+                std::size_t nodes = 0;
+                if (!nextWord(in, word) || word != "tree" || !(in >> nodes) || nodes == 0 || nodes > kMaxNodesPerTree)
+                    return fail(error, "ağaç " + std::to_string(t) + ": tree satırı okunamadı");
+                std::string tree_error;
+                if (!m.readTree(in, nodes, &tree_error))
+                    return fail(error, "ağaç " + std::to_string(t) + ": " + tree_error);
+            }
+        }
+        else
+            return fail(error, "bilinmeyen anahtar: " + word);
+    }
+
+    if (m.roots_.empty())
+        return fail(error, "model ağaç içermiyor");
+    for (std::size_t i = 0; i < kColumns; ++i)
+        if (!(m.scale_[i] > 0.0))
+            return fail(error, "scale pozitif olmalı");
+
+    m.callsign_unknown_ = unknownIndex(m.callsign_classes_);
+    m.status_unknown_ = unknownIndex(m.status_classes_);
+    m.tree_count_ = m.roots_.size();
+
+    // Son grup, katkısı 0 olan tek bir yaprakla doldurulur.
+    if (m.roots_.size() % kLanes != 0)
+    {
+        const auto pad = static_cast<uint32_t>(m.nodes_.size());
+        m.nodes_.push_back(Node{kLeafThreshold, pad << 3});
+        m.leaf_value_.push_back(0.0);
+        while (m.roots_.size() % kLanes != 0)
+            m.roots_.push_back(pad);
+    }
+
+    *this = std::move(m);
+    return true;
+}
+
+// Düğüm satırı: sol sağ özellik eşik p1 (ağaç içi indeksler, yaprakta -1).
+// Düğümler dosyadaki sıradan bağımsız olarak ön sıraya dizilir.
+bool SuspicionModel::readTree(std::istream &in, std::size_t count, std::string *error)
+{
+    struct Raw
+    {
+        long long left, right, feature;
+        double threshold, p1;
+    };
+    std::vector<Raw> raw(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Raw &r = raw[i];
+        if (!(in >> r.left >> r.right >> r.feature >> r.threshold >> r.p1))
+            return fail(error, "düğüm " + std::to_string(i) + " okunamadı");
+        const bool leaf = r.left < 0 || r.right < 0;
+        if (!leaf && (static_cast<std::size_t>(r.left) >= count || static_cast<std::size_t>(r.right) >= count ||
+                      r.feature < 0 || r.feature >= static_cast<long long>(kColumns)))
+            return fail(error, "düğüm " + std::to_string(i) + " geçersiz");
+    }
+    if (nodes_.size() + count >= (std::numeric_limits<uint32_t>::max() >> 3))
+        return fail(error, "düğüm sayısı çok büyük");
+
+    // Ön sıra: yığından önce sol çocuk çıkar ve hemen ebeveyninin arkasına
+    // yazılır; sağ çocuk yazılınca ebeveynin link'i düzeltilir. Her düğüme
+    // en fazla bir kez varılmalı (döngü yok).
+    const auto root = static_cast<uint32_t>(nodes_.size());
+    constexpr uint32_t kNoParent = std::numeric_limits<uint32_t>::max();
+    std::vector<std::pair<std::size_t, uint32_t>> stack{{0, kNoParent}};
+    std::size_t visited = 0;
+    while (!stack.empty())
+    {
+        const auto [i, right_of] = stack.back();
+        stack.pop_back();
+        if (++visited > count)
+            return fail(error, "ağaç yapısı geçersiz (döngü)");
+
+        const Raw &r = raw[i];
+        const auto self = static_cast<uint32_t>(nodes_.size());
+        if (right_of != kNoParent)
+            nodes_[right_of].link |= self << 3;
+        if (r.left < 0 || r.right < 0)
+        {
+            nodes_.push_back(Node{kLeafThreshold, self << 3});
+            leaf_value_.push_back(r.p1);
+            continue;
+        }
+        nodes_.push_back(Node{floatAtMost(r.threshold), static_cast<uint32_t>(r.feature)});
+        leaf_value_.push_back(0.0);
+        stack.emplace_back(static_cast<std::size_t>(r.right), self);
+        stack.emplace_back(static_cast<std::size_t>(r.left), kNoParent);
+    }
+    roots_.push_back(root);
+    return true;
+}
+
+uint32_t SuspicionModel::encode(const std::vector<std::string> &classes, uint32_t unknown, std::string_view value)
+{
+    for (std::size_t i = 0; i < classes.size(); ++i)
+        if (std::string_view(classes[i]) == value)
+            return static_cast<uint32_t>(i);
+    return unknown;
+}
+
+uint32_t SuspicionModel::callsignCode(std::string_view callsign) const
+{
+    return encode(callsign_classes_, callsign_unknown_, callsign);
+}
+
+uint32_t SuspicionModel::statusCode(std::string_view status) const
+{
+    return encode(status_classes_, status_unknown_, status);
+}
+
+double SuspicionModel::probability(const SuspicionInput &in) const
+{
+    if (tree_count_ == 0)
+        return 0.0;
+
+    double raw[kColumns];
+    raw[kCallsign] = callsignCode(in.callsign);
+    raw[kStatus] = statusCode(in.status);
+    raw[kLat] = in.lat;
+    raw[kLon] = in.lon;
+    raw[kSpeed] = in.speed;
+    raw[kBaroAltitude] = in.baro_altitude;
+    raw[kGeoAltitude] = in.geo_altitude;
+    raw[kHeading] = in.heading;
+
+    // StandardScaler float64'te; sklearn ağaçları girdiyi float32'ye çevirip
+    // double eşikle karşılaştırır; eşikler yüklemede buna göre yuvarlanmıştır.
+    float x[kColumns];
+    for (std::size_t i = 0; i < kColumns; ++i)
+        x[i] = static_cast<float>((raw[column_of_[i]] - mean_[i]) / scale_[i]);
+
+    const Node *nodes = nodes_.data();
+    double sum = 0.0;
+    for (std::size_t g = 0; g < roots_.size(); g += kLanes)
+    {
+        uint32_t at[kLanes];
+        for (std::size_t l = 0; l < kLanes; ++l)
+            at[l] = roots_[g + l];
+        // Gruptaki tüm ağaçlar yaprağa varınca (hiçbiri ilerlemeyince) biter.
+        for (bool moved = true; moved;)
+        {
+            moved = false;
+            for (std::size_t l = 0; l < kLanes; ++l)
+            {
+                // Dalsız seçim: yön rastgele olduğundan dallanma tahmin edilemez.
+                const Node n = nodes[at[l]];
+                const uint32_t right = n.link >> 3;
+                const uint32_t go_left = x[n.link & 7u] <= n.threshold;
+                const uint32_t next = right ^ ((right ^ (at[l] + 1)) & (0u - go_left));
+                moved |= next != at[l];
+                at[l] = next;
+            }
+        }
+        for (std::size_t l = 0; l < kLanes; ++l)
+            sum += leaf_value_[at[l]];
+    }
+    return sum / static_cast<double>(tree_count_);
+}
+
+void SuspicionBatch::resize(std::size_t rows)
+{
+    callsign.resize(rows);
+    status.resize(rows);
+    lat.resize(rows);
+    lon.resize(rows);
+    speed.resize(rows);
+    baro_altitude.resize(rows);
+    geo_altitude.resize(rows);
+    heading.resize(rows);
+}
+
+// probability() ile aynı ölçekleme, blok için sütun sütun; x[i * kBlock + r].
+void SuspicionModel::scaleBlock(const SuspicionBatch &batch, std::size_t begin, std::size_t rows, float *x) const
+{
+    const double *numeric[kColumns] = {nullptr, nullptr, batch.lat.data(), batch.lon.data(), batch.speed.data(),
+                                       batch.baro_altitude.data(), batch.geo_altitude.data(), batch.heading.data()};
+    for (std::size_t i = 0; i < kColumns; ++i)
+    {
+        float *dst = x + i * kBlock;
+        const double mean = mean_[i];
+        const double scale = scale_[i];
+        const uint32_t col = column_of_[i];
+        if (col == kCallsign || col == kStatus)
+        {
+            const uint32_t *src = (col == kCallsign ? batch.callsign.data() : batch.status.data()) + begin;
+            for (std::size_t r = 0; r < rows; ++r)
+                dst[r] = static_cast<float>((static_cast<double>(src[r]) - mean) / scale);
+        }
+        else
+        {
+            const double *src = numeric[col] + begin;
+            for (std::size_t r = 0; r < rows; ++r)
+                dst[r] = static_cast<float>((src[r] - mean) / scale);
+        }
+    }
+}
+
+void SuspicionModel::score(SuspicionBatch &batch, double *out) const
+{
+    const std::size_t n = batch.size();
+    if (tree_count_ == 0)
+    {
+        std::fill(out, out + n, 0.0);
+        return;
+    }
+
+    batch.x_.resize(kColumns * kBlock);
+    batch.at_.resize(kBlock);
+    batch.active_.resize(kBlock);
+    batch.sum_.resize(kBlock);
+    float *x = batch.x_.data();
+    uint32_t *at = batch.at_.data();
+    uint32_t *active = batch.active_.data();
+    double *sum = batch.sum_.data();
+    const Node *nodes = nodes_.data();
+
+    for (std::size_t begin = 0; begin < n; begin += kBlock)
+    {
+        const std::size_t rows = std::min(kBlock, n - begin);
+        scaleBlock(batch, begin, rows, x);
+        std::fill(sum, sum + rows, 0.0);
+
+        for (std::size_t t = 0; t < tree_count_; ++t)
+        {
+            for (std::size_t r = 0; r < rows; ++r)
+            {
+                at[r] = roots_[t];
+                active[r] = static_cast<uint32_t>(r);
+            }
+            // Her geçişte aktif satırlar bir adım ilerler; yerinde sayan
+            // (yaprağa varmış) satır listeden dalsız olarak düşer.
+            for (std::size_t live = rows; live > 0;)
+            {
+                std::size_t kept = 0;
+                for (std::size_t j = 0; j < live; ++j)
+                {
+                    const uint32_t r = active[j];
+                    const uint32_t node = at[r];
+                    const Node nd = nodes[node];
+                    const uint32_t right = nd.link >> 3;
+                    const uint32_t go_left = x[(nd.link & 7u) * kBlock + r] <= nd.threshold;
+                    const uint32_t next = right ^ ((right ^ (node + 1)) & (0u - go_left));
+                    at[r] = next;
+                    active[kept] = r;
+                    kept += next != node;
+                }
+                live = kept;
+            }
+            for (std::size_t r = 0; r < rows; ++r)
+                sum[r] += leaf_value_[at[r]];
+        }
+
+        for (std::size_t r = 0; r < rows; ++r)
+            out[begin + r] = sum[r] / static_cast<double>(tree_count_);
+    }
+}
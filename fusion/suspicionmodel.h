@@ -0,0 +1,138 @@
+#ifndef SUSPICIONMODEL_H
+#define SUSPICIONMODEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Şüpheli hedef modelinin (ai/appYpyZeka.ipynb, RandomForest + StandardScaler
+// + LabelEncoder) servis içinde değerlendirilmesi. Model ai/export_model.py
+// ile metin biçimine çevrilir; Python ve IPC gerekmez.
+//
+// Sonuç sklearn predict_proba[:, 1] ile birebir aynıdır: kategorik sütunlar
+// LabelEncoder gibi kodlanır (bilinmeyen değer UNKNOWN), ölçekleme float64'te
+// yapılır ve ağaçlar sklearn gibi float32'ye çevrilmiş girdiyle dolaşılır.
+struct SuspicionInput
+{
+    std::string_view callsign;
+    std::string_view status; // friend_foe: FRIEND / FOE / UNKNOWN
+    double lat = 0.0;
+    double lon = 0.0;
+    double speed = 0.0;
+    double baro_altitude = 0.0;
+    double geo_altitude = 0.0;
+    double heading = 0.0;
+};
+
+// Bir tick'in (ya da ScoreBatch isteğinin) satırları, sütun düzeninde (SoA).
+// Kategorik sütunlar SuspicionModel::callsignCode / statusCode kodlarıdır.
+// Nesne yeniden kullanıldıkça skorlama tamponları da yeniden kullanılır.
+class SuspicionBatch
+{
+public:
+    std::vector<uint32_t> callsign;
+    std::vector<uint32_t> status;
+    std::vector<double> lat;
+    std::vector<double> lon;
+    std::vector<double> speed;
+    std::vector<double> baro_altitude;
+    std::vector<double> geo_altitude;
+    std::vector<double> heading;
+
+    void resize(std::size_t rows);
+    std::size_t size() const { return lat.size(); }
+
+private:
+    friend class SuspicionModel;
+
+    // Blok başına ölçeklenmiş girdi (özellik-major), satırın düğümü, henüz
+    // yaprağa varmamış satırlar ve ağaçlar üzerindeki toplam.
+    std::vector<float> x_;
+    std::vector<uint32_t> at_;
+    std::vector<uint32_t> active_;
+    std::vector<double> sum_;
+};
+
+class SuspicionModel
+{
+public:
+    // Dosyayı okur; hata durumunda error doldurulur ve false döner, model
+    // değişmez.
+    bool load(const std::string &path, std::string *error);
+    bool parse(std::istream &in, std::string *error);
+
+    // Şüpheli olma olasılığı; sklearn predict() karşılığı p > 0.5'tir.
+    double probability(const SuspicionInput &in) const;
+
+    // LabelEncoder kodları; bilinmeyen değer UNKNOWN'ın kodunu alır.
+    uint32_t callsignCode(std::string_view callsign) const;
+    uint32_t statusCode(std::string_view status) const;
+
+    // Toplu skorlama: out[i] = probability(satır i), out batch.size()
+    // uzunluğunda olmalı. Satırlar kBlock'luk bloklara bölünür; her blokta
+    // ölçekleme sütun başına tek bir (vektörlenen) döngüdür, ağaçlar sırayla
+    // tüm bloğa uygulanır. Blok satırları birbirinden bağımsız olduğundan
+    // ağaç dolaşımının bellek okumaları örtüşür; yaprağa varan satırlar
+    // aktif listeden çıkarıldığından adım sayısı gerçek yol uzunluklarının
+    // toplamıdır. Sonuç probability() ile bit düzeyinde aynıdır.
+    void score(SuspicionBatch &batch, double *out) const;
+
+    bool empty() const { return tree_count_ == 0; }
+    std::size_t trees() const { return tree_count_; }
+    std::size_t nodes() const { return nodes_.size(); }
+
+private:
+    // Girdi sütunları; modeldeki sıra features satırından okunur.
+    enum Column : uint32_t
+    {
+        kCallsign,
+        kStatus,
+        kLat,
+        kLon,
+        kSpeed,
+        kBaroAltitude,
+        kGeoAltitude,
+        kHeading,
+        kColumns
+    };
+
+    // 8 baytlık düğüm, ağaç başına ön sıra (preorder): sol çocuk hemen
+    // sonraki düğümdür, link = sağ çocuk << 3 | özellik. sklearn'ün double
+    // eşiği float32 girdiyle karşılaştırıldığından eşik, kendisinden küçük
+    // ya da eşit en büyük float'a yuvarlanır; karşılaştırma sonucu değişmez.
+    // Yaprakta eşik NaN ve sağ çocuk kendisidir: karşılaştırma hep false
+    // döner, yaprağa erken varan ağaç grubun kalan adımlarında yerinde sayar.
+    struct Node
+    {
+        float threshold;
+        uint32_t link;
+    };
+    static_assert(kColumns <= 8, "özellik indeksi link'in alt 3 bitine sığmalı");
+
+    // Tek örnekte ağaç dolaşımı bağımlı bellek okumalarından oluşur; ağaçlar
+    // kLanes'lik gruplar halinde aynı anda dolaşılarak okumalar örtüştürülür.
+    static constexpr std::size_t kLanes = 8;
+    static constexpr std::size_t kBlock = 256;
+
+    bool readTree(std::istream &in, std::size_t count, std::string *error);
+    static uint32_t encode(const std::vector<std::string> &classes, uint32_t unknown, std::string_view value);
+    void scaleBlock(const SuspicionBatch &batch, std::size_t begin, std::size_t rows, float *x) const;
+
+    uint32_t column_of_[kColumns] = {};
+    std::vector<std::string> callsign_classes_;
+    std::vector<std::string> status_classes_;
+    uint32_t callsign_unknown_ = 0;
+    uint32_t status_unknown_ = 0;
+    double mean_[kColumns] = {};
+    double scale_[kColumns] = {};
+
+    std::vector<Node> nodes_;
+    std::vector<double> leaf_value_; // düğüm başına; sadece yapraklarda anlamlı
+    std::vector<uint32_t> roots_;    // kLanes'in katına, 0 olasılıklı yaprakla doldurulur
+    std::size_t tree_count_ = 0;
+};
+
+#endif
@@ -0,0 +1,252 @@
+// Radar, IFF ve DataLink servislerini tek süreçte çalıştıran ortak host.
+// Servisler tek bir grpc::ServerBuilder'a kaydedilir; gRPC thread havuzu,
+// bellek bütçesi (ResourceQuota), Mongo bağlantı havuzu, logger ve metrics
+// uç noktası paylaşılır. Her servis eski portunda dinlemeye devam eder, bu
+// yüzden client tarafında değişiklik gerekmez.
+//
+//   aewc_host --config config/aewc.conf --host.services radar,iff --server.max_threads 256
+
+#include "radarservice.h"
+#include "iffservice.h"
+#include "datalinkservice.h"
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "serverconfig.h"
+#include "tracksource.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <mongocxx/pool.hpp>
+#include <mongocxx/uri.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+struct Options
+{
+    bool radar = true;
+    bool iff = true;
+    bool datalink = true;
+    std::string radar_addr;
+    std::string iff_addr;
+    std::string datalink_addr;
+    std::string mongo_uri;
+    std::string db_name;
+    int pool_size = 8;
+    uint16_t metrics_port = 9250;
+};
+
+// Host için sunucu varsayılanları: tek CQ, az sayıda poller. Thread sınırı
+// yok: sync sunucu açık her streaming RPC için bir thread tutar ve bir konsol
+// tek başına 7 stream açar (radar, IFF, DataLink, alarm, geofence, çatışma,
+// tahmin); üç servisin paylaştığı sabit bir sınır birkaç konsolda
+// RESOURCE_EXHAUSTED'a yol açıyordu.
+const ServerDefaults kHostServerDefaults{0, 0, 1, 1, 2};
+
+void usage()
+{
+    std::cout << "Kullanım: aewc_host [--config DOSYA] [--anahtar=değer ...]\n"
+                 "  --host.services LIST       radar,iff,datalink (varsayılan: all)\n"
+                 "  --radar.address H:P        (0.0.0.0:50053)\n"
+                 "  --iff.address H:P          (0.0.0.0:50051)\n"
+                 "  --datalink.address H:P     (0.0.0.0:50052)\n"
+                 "  --mongo.uri URI            (mongodb://localhost:27017)\n"
+                 "  --mongo.db NAME            (aewc)\n"
+                 "  --mongo.pool_size N        paylaşılan Mongo bağlantı havuzu (8)\n"
+                 "  --server.max_threads N     tüm servisler için gRPC thread üst sınırı, 0 = sınırsız (0)\n"
+                 "  --server.memory_mb N       gRPC bellek bütçesi, 0 = sınırsız (0)\n"
+                 "  --host.metrics_port N      Prometheus uç noktası, 0 = kapalı (9250)\n"
+                 "  --source.spec SPEC         mongo | file:<yol> | synthetic:<adet>\n"
+                 "Tüm anahtarlar için bkz. config/aewc.conf.\n";
+}
+
+bool readOptions(const Config &cfg, Options &o)
+{
+    const std::string services = cfg.getString("host.services", "all");
+    o.radar = services == "all" || services.find("radar") != std::string::npos;
+    o.iff = services == "all" || services.find("iff") != std::string::npos;
+    o.datalink = services == "all" || services.find("datalink") != std::string::npos;
+    o.radar_addr = cfg.getString("radar.address", "0.0.0.0:50053");
+    o.iff_addr = cfg.getString("iff.address", "0.0.0.0:50051");
+    o.datalink_addr = cfg.getString("datalink.address", "0.0.0.0:50052");
+    o.mongo_uri = cfg.getString("mongo.uri", "mongodb://localhost:27017");
+    o.db_name = cfg.getString("mongo.db", "aewc");
+    o.pool_size = static_cast<int>(cfg.getInt("mongo.pool_size", 8));
+    o.metrics_port = static_cast<uint16_t>(cfg.getInt("host.metrics_port", MetricsServer::portFromEnv(9250)));
+
+    if (!o.radar && !o.iff && !o.datalink)
+    {
+        std::cerr << "En az bir servis seçilmeli" << std::endl;
+        return false;
+    }
+    if (o.pool_size <= 0)
+    {
+        std::cerr << "mongo.pool_size pozitif olmalı" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// URI'ye maxPoolSize ekler (kullanıcı zaten verdiyse dokunmaz).
+std::string withPoolSize(const std::string &uri, int pool_size)
+{
+    if (uri.find("maxPoolSize") != std::string::npos)
+        return uri;
+    const std::string opt = "maxPoolSize=" + std::to_string(pool_size);
+    if (uri.find('?') != std::string::npos)
+        return uri + "&" + opt;
+    return uri + (uri.back() == '/' ? "?" : "/?") + opt;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        if (a == "--help" || a == "-h")
+        {
+            usage();
+            return EXIT_SUCCESS;
+        }
+    }
+
+    Config cfg;
+    std::string cfg_error;
+    if (!cfg.load(argc, argv, &cfg_error))
+    {
+        std::cerr << cfg_error << std::endl;
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    Options opt;
+    if (!readOptions(cfg, opt))
+        return EXIT_FAILURE;
+
+    Logger::instance().start(logger_options(cfg));
+
+    MetricsRegistry::instance().callbackGauge("aewc_log_records_dropped", "Kuyruk dolu olduğu için düşürülen log kayıtları",
+                                              [] { return static_cast<double>(Logger::instance().dropped()); });
+    MetricsServer metrics_server;
+    metrics_server.start(opt.metrics_port);
+
+    try
+    {
+        const std::string spec = cfg.getString("source.spec", track_source_spec_from_env());
+        const int32_t batch_size = static_cast<int32_t>(cfg.getInt("mongo.batch_size", 0));
+
+        // Üç servis tek havuzu paylaşır; havuz sadece Mongo kaynağında açılır.
+        std::shared_ptr<mongocxx::pool> pool;
+        if (spec == "mongo")
+            pool = std::make_shared<mongocxx::pool>(mongocxx::uri{withPoolSize(opt.mongo_uri, opt.pool_size)});
+
+        std::unique_ptr<RadarServiceImpl> radar;
+        std::unique_ptr<IFFServiceImpl> iff;
+        std::unique_ptr<DataLinkServiceImpl> datalink;
+
+        grpc::ServerBuilder builder;
+
+        // Tüm servisler tek completion queue ve tek thread kotası üzerinden çalışır.
+        apply_server_config(cfg, builder, kHostServerDefaults);
+
+        if (opt.radar)
+        {
+            auto source = make_track_source(spec, opt.mongo_uri, opt.db_name, cfg.getString("radar.collection", "radar"),
+                                            TrackSchema::radar(), pool, batch_size);
+            std::cout << "[INFO] Radar    " << opt.radar_addr << "  <- " << source->describe() << std::endl;
+            radar = std::make_unique<RadarServiceImpl>(std::move(source));
+            const RadarSettings settings = RadarSettings::fromConfig(cfg);
+            radar->configure(settings);
+            radar->loadGeofences(settings.geofence_path);
+            builder.AddListeningPort(opt.radar_addr, grpc::InsecureServerCredentials());
+            builder.RegisterService(radar.get());
+        }
+        if (opt.iff)
+        {
+            auto source = make_track_source(spec, opt.mongo_uri, opt.db_name, cfg.getString("iff.collection", "iff"),
+                                            TrackSchema::iff(), pool, batch_size);
+            std::cout << "[INFO] IFF      " << opt.iff_addr << "  <- " << source->describe() << std::endl;
+            iff = std::make_unique<IFFServiceImpl>(std::move(source));
+            iff->setPacingMs(static_cast<int>(cfg.getInt("iff.pacing_ms", 50)));
+            builder.AddListeningPort(opt.iff_addr, grpc::InsecureServerCredentials());
+            builder.RegisterService(iff.get());
+        }
+        if (opt.datalink)
+        {
+            auto source = make_track_source(spec, opt.mongo_uri, opt.db_name, cfg.getString("datalink.collection", "datalink"),
+                                            TrackSchema::datalink(), pool, batch_size);
+            std::cout << "[INFO] DataLink " << opt.datalink_addr << "  <- " << source->describe() << std::endl;
+            datalink = std::make_unique<DataLinkServiceImpl>(std::move(source));
+            datalink->setPacingMs(static_cast<int>(cfg.getInt("datalink.pacing_ms", 50)));
+            builder.AddListeningPort(opt.datalink_addr, grpc::InsecureServerCredentials());
+            builder.RegisterService(datalink.get());
+        }
+
+        // İşletim alanı bir kez kurulur; çalışan servisler aynı maskeyi paylaşır.
+        auto apply_area = [&radar, &iff, &datalink](const Config &c)
+        {
+            auto area = load_operating_area(c.getString("area.path", ""));
+            if (!area)
+                return;
+            if (radar)
+                radar->setOperatingArea(area);
+            if (iff)
+                iff->setOperatingArea(area);
+            if (datalink)
+                datalink->setOperatingArea(area);
+        };
+        apply_area(cfg);
+
+        // SIGHUP: çalışan servislerin sıcak anahtarları, area.path ve log.level yeniden okunur.
+        ConfigWatcher watcher;
+        watcher.start(cfg, [&radar, &iff, &datalink, apply_area](const Config &c)
+                      {
+                          if (radar)
+                          {
+                              const RadarSettings s = RadarSettings::fromConfig(c);
+                              radar->configure(s);
+                              radar->loadGeofences(s.geofence_path);
+                          }
+                          if (iff)
+                              iff->setPacingMs(static_cast<int>(c.getInt("iff.pacing_ms", 50)));
+                          if (datalink)
+                              datalink->setPacingMs(static_cast<int>(c.getInt("datalink.pacing_ms", 50)));
+                          apply_area(c);
+                          Logger::instance().setLevel(logger_options(c).level);
+                      });
+
+        std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+        if (!server)
+        {
+            std::cerr << "[ERROR] gRPC server başlatılamadı." << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (radar)
+            radar->start();
+
+        const int64_t memory_mb = cfg.getInt("server.memory_mb", kHostServerDefaults.memory_mb);
+        const int64_t max_threads = cfg.getInt("server.max_threads", kHostServerDefaults.max_threads);
+        std::cout << "[INFO] aewc_host hazır (max-threads "
+                  << (max_threads > 0 ? std::to_string(max_threads) : std::string("sınırsız"))
+                  << ", bellek " << (memory_mb > 0 ? std::to_string(memory_mb) + " MB" : std::string("sınırsız"))
+                  << "). CTRL+C ile durdurabilirsiniz." << std::endl;
+        if (!cfg.path().empty())
+            std::cout << "[INFO] Yapılandırma: " << cfg.path() << " (SIGHUP ile yeniden yüklenir)" << std::endl;
+        server->Wait();
+        if (radar)
+            radar->stop();
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "[ERROR] Sunucu başlatılamadı: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,25 @@
+// iff servisinin stream yolu için Google Benchmark ölçümü.
+// Mongo veya gRPC bağlantısı gerekmez; kayıtlar bellekte sentetik üretilir.
+//
+//   cmake -DIFF_BUILD_BENCH=ON ... && ./iff_bench
+
+#include "iffservice.h"
+#include "streambench.h"
+
+struct IFFBenchAccess
+{
+    static grpc::Status sendRecords(IFFServiceImpl &svc, grpc::ServerContext *context,
+                                    const iff::IFFRequest *request,
+                                    grpc::ServerWriterInterface<iff::IFFStreamResponse> *writer)
+    {
+        return svc.sendRecords(context, request, writer);
+    }
+};
+
+static void BM_StreamIFFData(benchmark::State &state)
+{
+    run_stream_bench(state, &IFFBenchAccess::sendRecords);
+}
+BENCHMARK(BM_StreamIFFData)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,243 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: iff.proto
-#ifndef GRPC_iff_2eproto__INCLUDED
-#define GRPC_iff_2eproto__INCLUDED
-
-#include "iff.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-
-namespace iff {
-
-// IFF Servisi
-class IFFService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "iff.IFFService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    // Sürekli IFF verisi akışı
-    std::unique_ptr< ::grpc::ClientReaderInterface< ::iff::IFFStreamResponse>> StreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReaderInterface< ::iff::IFFStreamResponse>>(StreamIFFDataRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>> AsyncStreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>>(AsyncStreamIFFDataRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>> PrepareAsyncStreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>>(PrepareAsyncStreamIFFDataRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      // Sürekli IFF verisi akışı
-      virtual void StreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest* request, ::grpc::ClientReadReactor< ::iff::IFFStreamResponse>* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientReaderInterface< ::iff::IFFStreamResponse>* StreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>* AsyncStreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::iff::IFFStreamResponse>* PrepareAsyncStreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    std::unique_ptr< ::grpc::ClientReader< ::iff::IFFStreamResponse>> StreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReader< ::iff::IFFStreamResponse>>(StreamIFFDataRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>> AsyncStreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>>(AsyncStreamIFFDataRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>> PrepareAsyncStreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>>(PrepareAsyncStreamIFFDataRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void StreamIFFData(::grpc::ClientContext* context, const ::iff::IFFRequest* request, ::grpc::ClientReadReactor< ::iff::IFFStreamResponse>* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientReader< ::iff::IFFStreamResponse>* StreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request) override;
-    ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>* AsyncStreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncReader< ::iff::IFFStreamResponse>* PrepareAsyncStreamIFFDataRaw(::grpc::ClientContext* context, const ::iff::IFFRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_StreamIFFData_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    // Sürekli IFF verisi akışı
-    virtual ::grpc::Status StreamIFFData(::grpc::ServerContext* context, const ::iff::IFFRequest* request, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* writer);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamIFFData(::grpc::ServerContext* context, ::iff::IFFRequest* request, ::grpc::ServerAsyncWriter< ::iff::IFFStreamResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_StreamIFFData<Service > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::iff::IFFRequest, ::iff::IFFStreamResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::iff::IFFRequest* request) { return this->StreamIFFData(context, request); }));
-    }
-    ~WithCallbackMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::iff::IFFStreamResponse>* StreamIFFData(
-      ::grpc::CallbackServerContext* /*context*/, const ::iff::IFFRequest* /*request*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_StreamIFFData<Service > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamIFFData(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamIFFData(context, request); }));
-    }
-    ~WithRawCallbackMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamIFFData(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
-  };
-  typedef Service StreamedUnaryService;
-  template <class BaseClass>
-  class WithSplitStreamingMethod_StreamIFFData : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithSplitStreamingMethod_StreamIFFData() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::SplitServerStreamingHandler<
-          ::iff::IFFRequest, ::iff::IFFStreamResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerSplitStreamer<
-                     ::iff::IFFRequest, ::iff::IFFStreamResponse>* streamer) {
-                       return this->StreamedStreamIFFData(context,
-                         streamer);
-                  }));
-    }
-    ~WithSplitStreamingMethod_StreamIFFData() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status StreamIFFData(::grpc::ServerContext* /*context*/, const ::iff::IFFRequest* /*request*/, ::grpc::ServerWriter< ::iff::IFFStreamResponse>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with split streamed
-    virtual ::grpc::Status StreamedStreamIFFData(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::iff::IFFRequest,::iff::IFFStreamResponse>* server_split_streamer) = 0;
-  };
-  typedef WithSplitStreamingMethod_StreamIFFData<Service > SplitStreamedService;
-  typedef WithSplitStreamingMethod_StreamIFFData<Service > StreamedService;
-};
-
-}  // namespace iff
-
-
-#endif  // GRPC_iff_2eproto__INCLUDED
@@ -1,982 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: iff.proto
-
-#include "iff.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/wire_format_lite.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-
-PROTOBUF_PRAGMA_INIT_SEG
-
-namespace _pb = ::PROTOBUF_NAMESPACE_ID;
-namespace _pbi = _pb::internal;
-
-namespace iff {
-PROTOBUF_CONSTEXPR IFFData::IFFData(
-    ::_pbi::ConstantInitialized)
-  : status_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , callsign_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , lat_(0)
-  , lon_(0){}
-struct IFFDataDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR IFFDataDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~IFFDataDefaultTypeInternal() {}
-  union {
-    IFFData _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IFFDataDefaultTypeInternal _IFFData_default_instance_;
-PROTOBUF_CONSTEXPR IFFRequest::IFFRequest(
-    ::_pbi::ConstantInitialized)
-  : lat_(0)
-  , lon_(0)
-  , radius_km_(0){}
-struct IFFRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR IFFRequestDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~IFFRequestDefaultTypeInternal() {}
-  union {
-    IFFRequest _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IFFRequestDefaultTypeInternal _IFFRequest_default_instance_;
-PROTOBUF_CONSTEXPR IFFStreamResponse::IFFStreamResponse(
-    ::_pbi::ConstantInitialized)
-  : data_(nullptr){}
-struct IFFStreamResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR IFFStreamResponseDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~IFFStreamResponseDefaultTypeInternal() {}
-  union {
-    IFFStreamResponse _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IFFStreamResponseDefaultTypeInternal _IFFStreamResponse_default_instance_;
-}  // namespace iff
-static ::_pb::Metadata file_level_metadata_iff_2eproto[3];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_iff_2eproto = nullptr;
-static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_iff_2eproto = nullptr;
-
-const uint32_t TableStruct_iff_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, status_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, lat_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, lon_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, callsign_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFData, id_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFRequest, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFRequest, lat_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFRequest, lon_),
-  PROTOBUF_FIELD_OFFSET(::iff::IFFRequest, radius_km_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFStreamResponse, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::iff::IFFStreamResponse, data_),
-};
-static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::iff::IFFData)},
-  { 11, -1, -1, sizeof(::iff::IFFRequest)},
-  { 20, -1, -1, sizeof(::iff::IFFStreamResponse)},
-};
-
-static const ::_pb::Message* const file_default_instances[] = {
-  &::iff::_IFFData_default_instance_._instance,
-  &::iff::_IFFRequest_default_instance_._instance,
-  &::iff::_IFFStreamResponse_default_instance_._instance,
-};
-
-const char descriptor_table_protodef_iff_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\tiff.proto\022\003iff\"Q\n\007IFFData\022\016\n\006status\030\001 "
-  "\001(\t\022\013\n\003lat\030\002 \001(\001\022\013\n\003lon\030\003 \001(\001\022\020\n\010callsig"
-  "n\030\004 \001(\t\022\n\n\002id\030\005 \001(\t\"9\n\nIFFRequest\022\013\n\003lat"
-  "\030\001 \001(\001\022\013\n\003lon\030\002 \001(\001\022\021\n\tradius_km\030\003 \001(\001\"/"
-  "\n\021IFFStreamResponse\022\032\n\004data\030\001 \001(\0132\014.iff."
-  "IFFData2H\n\nIFFService\022:\n\rStreamIFFData\022\017"
-  ".iff.IFFRequest\032\026.iff.IFFStreamResponse0"
-  "\001b\006proto3"
-  ;
-static ::_pbi::once_flag descriptor_table_iff_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_iff_2eproto = {
-    false, false, 289, descriptor_table_protodef_iff_2eproto,
-    "iff.proto",
-    &descriptor_table_iff_2eproto_once, nullptr, 0, 3,
-    schemas, file_default_instances, TableStruct_iff_2eproto::offsets,
-    file_level_metadata_iff_2eproto, file_level_enum_descriptors_iff_2eproto,
-    file_level_service_descriptors_iff_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_iff_2eproto_getter() {
-  return &descriptor_table_iff_2eproto;
-}
-
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_iff_2eproto(&descriptor_table_iff_2eproto);
-namespace iff {
-
-// ===================================================================
-
-class IFFData::_Internal {
- public:
-};
-
-IFFData::IFFData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:iff.IFFData)
-}
-IFFData::IFFData(const IFFData& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  status_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    status_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_status().empty()) {
-    status_.Set(from._internal_status(), 
-      GetArenaForAllocation());
-  }
-  callsign_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    callsign_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_callsign().empty()) {
-    callsign_.Set(from._internal_callsign(), 
-      GetArenaForAllocation());
-  }
-  id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    id_.Set(from._internal_id(), 
-      GetArenaForAllocation());
-  }
-  ::memcpy(&lat_, &from.lat_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lon_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
-  // @@protoc_insertion_point(copy_constructor:iff.IFFData)
-}
-
-inline void IFFData::SharedCtor() {
-status_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  status_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-callsign_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  callsign_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-id_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  id_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&lat_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&lon_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
-}
-
-IFFData::~IFFData() {
-  // @@protoc_insertion_point(destructor:iff.IFFData)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void IFFData::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  status_.Destroy();
-  callsign_.Destroy();
-  id_.Destroy();
-}
-
-void IFFData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void IFFData::Clear() {
-// @@protoc_insertion_point(message_clear_start:iff.IFFData)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  status_.ClearToEmpty();
-  callsign_.ClearToEmpty();
-  id_.ClearToEmpty();
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lon_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* IFFData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string status = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_status();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "iff.IFFData.status"));
-        } else
-          goto handle_unusual;
-        continue;
-      // double lat = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double lon = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
-          lon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // string callsign = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_callsign();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "iff.IFFData.callsign"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string id = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "iff.IFFData.id"));
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* IFFData::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:iff.IFFData)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string status = 1;
-  if (!this->_internal_status().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_status().data(), static_cast<int>(this->_internal_status().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "iff.IFFData.status");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_status(), target);
-  }
-
-  // double lat = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = this->_internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lat(), target);
-  }
-
-  // double lon = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = this->_internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_lon(), target);
-  }
-
-  // string callsign = 4;
-  if (!this->_internal_callsign().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_callsign().data(), static_cast<int>(this->_internal_callsign().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "iff.IFFData.callsign");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_callsign(), target);
-  }
-
-  // string id = 5;
-  if (!this->_internal_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "iff.IFFData.id");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_id(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:iff.IFFData)
-  return target;
-}
-
-size_t IFFData::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:iff.IFFData)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string status = 1;
-  if (!this->_internal_status().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_status());
-  }
-
-  // string callsign = 4;
-  if (!this->_internal_callsign().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_callsign());
-  }
-
-  // string id = 5;
-  if (!this->_internal_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
-  }
-
-  // double lat = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = this->_internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double lon = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = this->_internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    total_size += 1 + 8;
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IFFData::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    IFFData::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IFFData::GetClassData() const { return &_class_data_; }
-
-void IFFData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<IFFData *>(to)->MergeFrom(
-      static_cast<const IFFData &>(from));
-}
-
-
-void IFFData::MergeFrom(const IFFData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:iff.IFFData)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_status().empty()) {
-    _internal_set_status(from._internal_status());
-  }
-  if (!from._internal_callsign().empty()) {
-    _internal_set_callsign(from._internal_callsign());
-  }
-  if (!from._internal_id().empty()) {
-    _internal_set_id(from._internal_id());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = from._internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    _internal_set_lat(from._internal_lat());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = from._internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    _internal_set_lon(from._internal_lon());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void IFFData::CopyFrom(const IFFData& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:iff.IFFData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool IFFData::IsInitialized() const {
-  return true;
-}
-
-void IFFData::InternalSwap(IFFData* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &status_, lhs_arena,
-      &other->status_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &callsign_, lhs_arena,
-      &other->callsign_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &id_, lhs_arena,
-      &other->id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(IFFData, lon_)
-      + sizeof(IFFData::lon_)
-      - PROTOBUF_FIELD_OFFSET(IFFData, lat_)>(
-          reinterpret_cast<char*>(&lat_),
-          reinterpret_cast<char*>(&other->lat_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata IFFData::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_iff_2eproto_getter, &descriptor_table_iff_2eproto_once,
-      file_level_metadata_iff_2eproto[0]);
-}
-
-// ===================================================================
-
-class IFFRequest::_Internal {
- public:
-};
-
-IFFRequest::IFFRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:iff.IFFRequest)
-}
-IFFRequest::IFFRequest(const IFFRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&lat_, &from.lat_,
-    static_cast<size_t>(reinterpret_cast<char*>(&radius_km_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(radius_km_));
-  // @@protoc_insertion_point(copy_constructor:iff.IFFRequest)
-}
-
-inline void IFFRequest::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&lat_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&radius_km_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(radius_km_));
-}
-
-IFFRequest::~IFFRequest() {
-  // @@protoc_insertion_point(destructor:iff.IFFRequest)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void IFFRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-}
-
-void IFFRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void IFFRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:iff.IFFRequest)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&radius_km_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(radius_km_));
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* IFFRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // double lat = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double lon = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          lon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double radius_km = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
-          radius_km_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* IFFRequest::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:iff.IFFRequest)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double lat = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = this->_internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
-  }
-
-  // double lon = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = this->_internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lon(), target);
-  }
-
-  // double radius_km = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_radius_km = this->_internal_radius_km();
-  uint64_t raw_radius_km;
-  memcpy(&raw_radius_km, &tmp_radius_km, sizeof(tmp_radius_km));
-  if (raw_radius_km != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_radius_km(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:iff.IFFRequest)
-  return target;
-}
-
-size_t IFFRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:iff.IFFRequest)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // double lat = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = this->_internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double lon = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = this->_internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double radius_km = 3;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_radius_km = this->_internal_radius_km();
-  uint64_t raw_radius_km;
-  memcpy(&raw_radius_km, &tmp_radius_km, sizeof(tmp_radius_km));
-  if (raw_radius_km != 0) {
-    total_size += 1 + 8;
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IFFRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    IFFRequest::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IFFRequest::GetClassData() const { return &_class_data_; }
-
-void IFFRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<IFFRequest *>(to)->MergeFrom(
-      static_cast<const IFFRequest &>(from));
-}
-
-
-void IFFRequest::MergeFrom(const IFFRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:iff.IFFRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lat = from._internal_lat();
-  uint64_t raw_lat;
-  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
-  if (raw_lat != 0) {
-    _internal_set_lat(from._internal_lat());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_lon = from._internal_lon();
-  uint64_t raw_lon;
-  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
-  if (raw_lon != 0) {
-    _internal_set_lon(from._internal_lon());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_radius_km = from._internal_radius_km();
-  uint64_t raw_radius_km;
-  memcpy(&raw_radius_km, &tmp_radius_km, sizeof(tmp_radius_km));
-  if (raw_radius_km != 0) {
-    _internal_set_radius_km(from._internal_radius_km());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void IFFRequest::CopyFrom(const IFFRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:iff.IFFRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool IFFRequest::IsInitialized() const {
-  return true;
-}
-
-void IFFRequest::InternalSwap(IFFRequest* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(IFFRequest, radius_km_)
-      + sizeof(IFFRequest::radius_km_)
-      - PROTOBUF_FIELD_OFFSET(IFFRequest, lat_)>(
-          reinterpret_cast<char*>(&lat_),
-          reinterpret_cast<char*>(&other->lat_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata IFFRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_iff_2eproto_getter, &descriptor_table_iff_2eproto_once,
-      file_level_metadata_iff_2eproto[1]);
-}
-
-// ===================================================================
-
-class IFFStreamResponse::_Internal {
- public:
-  static const ::iff::IFFData& data(const IFFStreamResponse* msg);
-};
-
-const ::iff::IFFData&
-IFFStreamResponse::_Internal::data(const IFFStreamResponse* msg) {
-  return *msg->data_;
-}
-IFFStreamResponse::IFFStreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:iff.IFFStreamResponse)
-}
-IFFStreamResponse::IFFStreamResponse(const IFFStreamResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_data()) {
-    data_ = new ::iff::IFFData(*from.data_);
-  } else {
-    data_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:iff.IFFStreamResponse)
-}
-
-inline void IFFStreamResponse::SharedCtor() {
-data_ = nullptr;
-}
-
-IFFStreamResponse::~IFFStreamResponse() {
-  // @@protoc_insertion_point(destructor:iff.IFFStreamResponse)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void IFFStreamResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete data_;
-}
-
-void IFFStreamResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void IFFStreamResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:iff.IFFStreamResponse)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  if (GetArenaForAllocation() == nullptr && data_ != nullptr) {
-    delete data_;
-  }
-  data_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* IFFStreamResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // .iff.IFFData data = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* IFFStreamResponse::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:iff.IFFStreamResponse)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .iff.IFFData data = 1;
-  if (this->_internal_has_data()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::data(this),
-        _Internal::data(this).GetCachedSize(), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:iff.IFFStreamResponse)
-  return target;
-}
-
-size_t IFFStreamResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:iff.IFFStreamResponse)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // .iff.IFFData data = 1;
-  if (this->_internal_has_data()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *data_);
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IFFStreamResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    IFFStreamResponse::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IFFStreamResponse::GetClassData() const { return &_class_data_; }
-
-void IFFStreamResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<IFFStreamResponse *>(to)->MergeFrom(
-      static_cast<const IFFStreamResponse &>(from));
-}
-
-
-void IFFStreamResponse::MergeFrom(const IFFStreamResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:iff.IFFStreamResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_has_data()) {
-    _internal_mutable_data()->::iff::IFFData::MergeFrom(from._internal_data());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void IFFStreamResponse::CopyFrom(const IFFStreamResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:iff.IFFStreamResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool IFFStreamResponse::IsInitialized() const {
-  return true;
-}
-
-void IFFStreamResponse::InternalSwap(IFFStreamResponse* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(data_, other->data_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata IFFStreamResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_iff_2eproto_getter, &descriptor_table_iff_2eproto_once,
-      file_level_metadata_iff_2eproto[2]);
-}
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace iff
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::iff::IFFData*
-Arena::CreateMaybeMessage< ::iff::IFFData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::iff::IFFData >(arena);
-}
-template<> PROTOBUF_NOINLINE ::iff::IFFRequest*
-Arena::CreateMaybeMessage< ::iff::IFFRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::iff::IFFRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::iff::IFFStreamResponse*
-Arena::CreateMaybeMessage< ::iff::IFFStreamResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::iff::IFFStreamResponse >(arena);
-}
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
@@ -1,958 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: iff.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_iff_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_iff_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3020003 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata_lite.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_iff_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_iff_2eproto {
-  static const uint32_t offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_iff_2eproto;
-namespace iff {
-class IFFData;
-struct IFFDataDefaultTypeInternal;
-extern IFFDataDefaultTypeInternal _IFFData_default_instance_;
-class IFFRequest;
-struct IFFRequestDefaultTypeInternal;
-extern IFFRequestDefaultTypeInternal _IFFRequest_default_instance_;
-class IFFStreamResponse;
-struct IFFStreamResponseDefaultTypeInternal;
-extern IFFStreamResponseDefaultTypeInternal _IFFStreamResponse_default_instance_;
-}  // namespace iff
-PROTOBUF_NAMESPACE_OPEN
-template<> ::iff::IFFData* Arena::CreateMaybeMessage<::iff::IFFData>(Arena*);
-template<> ::iff::IFFRequest* Arena::CreateMaybeMessage<::iff::IFFRequest>(Arena*);
-template<> ::iff::IFFStreamResponse* Arena::CreateMaybeMessage<::iff::IFFStreamResponse>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-namespace iff {
-
-// ===================================================================
-
-class IFFData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:iff.IFFData) */ {
- public:
-  inline IFFData() : IFFData(nullptr) {}
-  ~IFFData() override;
-  explicit PROTOBUF_CONSTEXPR IFFData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  IFFData(const IFFData& from);
-  IFFData(IFFData&& from) noexcept
-    : IFFData() {
-    *this = ::std::move(from);
-  }
-
-  inline IFFData& operator=(const IFFData& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline IFFData& operator=(IFFData&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const IFFData& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const IFFData* internal_default_instance() {
-    return reinterpret_cast<const IFFData*>(
-               &_IFFData_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(IFFData& a, IFFData& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(IFFData* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(IFFData* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  IFFData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<IFFData>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const IFFData& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const IFFData& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(IFFData* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "iff.IFFData";
-  }
-  protected:
-  explicit IFFData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kStatusFieldNumber = 1,
-    kCallsignFieldNumber = 4,
-    kIdFieldNumber = 5,
-    kLatFieldNumber = 2,
-    kLonFieldNumber = 3,
-  };
-  // string status = 1;
-  void clear_status();
-  const std::string& status() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_status(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_status();
-  PROTOBUF_NODISCARD std::string* release_status();
-  void set_allocated_status(std::string* status);
-  private:
-  const std::string& _internal_status() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status(const std::string& value);
-  std::string* _internal_mutable_status();
-  public:
-
-  // string callsign = 4;
-  void clear_callsign();
-  const std::string& callsign() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_callsign(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_callsign();
-  PROTOBUF_NODISCARD std::string* release_callsign();
-  void set_allocated_callsign(std::string* callsign);
-  private:
-  const std::string& _internal_callsign() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_callsign(const std::string& value);
-  std::string* _internal_mutable_callsign();
-  public:
-
-  // string id = 5;
-  void clear_id();
-  const std::string& id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* id);
-  private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
-  public:
-
-  // double lat = 2;
-  void clear_lat();
-  double lat() const;
-  void set_lat(double value);
-  private:
-  double _internal_lat() const;
-  void _internal_set_lat(double value);
-  public:
-
-  // double lon = 3;
-  void clear_lon();
-  double lon() const;
-  void set_lon(double value);
-  private:
-  double _internal_lon() const;
-  void _internal_set_lon(double value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:iff.IFFData)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr callsign_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-  double lat_;
-  double lon_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_iff_2eproto;
-};
-// -------------------------------------------------------------------
-
-class IFFRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:iff.IFFRequest) */ {
- public:
-  inline IFFRequest() : IFFRequest(nullptr) {}
-  ~IFFRequest() override;
-  explicit PROTOBUF_CONSTEXPR IFFRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  IFFRequest(const IFFRequest& from);
-  IFFRequest(IFFRequest&& from) noexcept
-    : IFFRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline IFFRequest& operator=(const IFFRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline IFFRequest& operator=(IFFRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const IFFRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const IFFRequest* internal_default_instance() {
-    return reinterpret_cast<const IFFRequest*>(
-               &_IFFRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(IFFRequest& a, IFFRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(IFFRequest* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(IFFRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  IFFRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<IFFRequest>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const IFFRequest& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const IFFRequest& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(IFFRequest* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "iff.IFFRequest";
-  }
-  protected:
-  explicit IFFRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kLatFieldNumber = 1,
-    kLonFieldNumber = 2,
-    kRadiusKmFieldNumber = 3,
-  };
-  // double lat = 1;
-  void clear_lat();
-  double lat() const;
-  void set_lat(double value);
-  private:
-  double _internal_lat() const;
-  void _internal_set_lat(double value);
-  public:
-
-  // double lon = 2;
-  void clear_lon();
-  double lon() const;
-  void set_lon(double value);
-  private:
-  double _internal_lon() const;
-  void _internal_set_lon(double value);
-  public:
-
-  // double radius_km = 3;
-  void clear_radius_km();
-  double radius_km() const;
-  void set_radius_km(double value);
-  private:
-  double _internal_radius_km() const;
-  void _internal_set_radius_km(double value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:iff.IFFRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  double lat_;
-  double lon_;
-  double radius_km_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_iff_2eproto;
-};
-// -------------------------------------------------------------------
-
-class IFFStreamResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:iff.IFFStreamResponse) */ {
- public:
-  inline IFFStreamResponse() : IFFStreamResponse(nullptr) {}
-  ~IFFStreamResponse() override;
-  explicit PROTOBUF_CONSTEXPR IFFStreamResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  IFFStreamResponse(const IFFStreamResponse& from);
-  IFFStreamResponse(IFFStreamResponse&& from) noexcept
-    : IFFStreamResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline IFFStreamResponse& operator=(const IFFStreamResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline IFFStreamResponse& operator=(IFFStreamResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const IFFStreamResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const IFFStreamResponse* internal_default_instance() {
-    return reinterpret_cast<const IFFStreamResponse*>(
-               &_IFFStreamResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(IFFStreamResponse& a, IFFStreamResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(IFFStreamResponse* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(IFFStreamResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  IFFStreamResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<IFFStreamResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const IFFStreamResponse& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const IFFStreamResponse& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(IFFStreamResponse* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "iff.IFFStreamResponse";
-  }
-  protected:
-  explicit IFFStreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kDataFieldNumber = 1,
-  };
-  // .iff.IFFData data = 1;
-  bool has_data() const;
-  private:
-  bool _internal_has_data() const;
-  public:
-  void clear_data();
-  const ::iff::IFFData& data() const;
-  PROTOBUF_NODISCARD ::iff::IFFData* release_data();
-  ::iff::IFFData* mutable_data();
-  void set_allocated_data(::iff::IFFData* data);
-  private:
-  const ::iff::IFFData& _internal_data() const;
-  ::iff::IFFData* _internal_mutable_data();
-  public:
-  void unsafe_arena_set_allocated_data(
-      ::iff::IFFData* data);
-  ::iff::IFFData* unsafe_arena_release_data();
-
-  // @@protoc_insertion_point(class_scope:iff.IFFStreamResponse)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::iff::IFFData* data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_iff_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// IFFData
-
-// string status = 1;
-inline void IFFData::clear_status() {
-  status_.ClearToEmpty();
-}
-inline const std::string& IFFData::status() const {
-  // @@protoc_insertion_point(field_get:iff.IFFData.status)
-  return _internal_status();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void IFFData::set_status(ArgT0&& arg0, ArgT... args) {
- 
- status_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:iff.IFFData.status)
-}
-inline std::string* IFFData::mutable_status() {
-  std::string* _s = _internal_mutable_status();
-  // @@protoc_insertion_point(field_mutable:iff.IFFData.status)
-  return _s;
-}
-inline const std::string& IFFData::_internal_status() const {
-  return status_.Get();
-}
-inline void IFFData::_internal_set_status(const std::string& value) {
-  
-  status_.Set(value, GetArenaForAllocation());
-}
-inline std::string* IFFData::_internal_mutable_status() {
-  
-  return status_.Mutable(GetArenaForAllocation());
-}
-inline std::string* IFFData::release_status() {
-  // @@protoc_insertion_point(field_release:iff.IFFData.status)
-  return status_.Release();
-}
-inline void IFFData::set_allocated_status(std::string* status) {
-  if (status != nullptr) {
-    
-  } else {
-    
-  }
-  status_.SetAllocated(status, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (status_.IsDefault()) {
-    status_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:iff.IFFData.status)
-}
-
-// double lat = 2;
-inline void IFFData::clear_lat() {
-  lat_ = 0;
-}
-inline double IFFData::_internal_lat() const {
-  return lat_;
-}
-inline double IFFData::lat() const {
-  // @@protoc_insertion_point(field_get:iff.IFFData.lat)
-  return _internal_lat();
-}
-inline void IFFData::_internal_set_lat(double value) {
-  
-  lat_ = value;
-}
-inline void IFFData::set_lat(double value) {
-  _internal_set_lat(value);
-  // @@protoc_insertion_point(field_set:iff.IFFData.lat)
-}
-
-// double lon = 3;
-inline void IFFData::clear_lon() {
-  lon_ = 0;
-}
-inline double IFFData::_internal_lon() const {
-  return lon_;
-}
-inline double IFFData::lon() const {
-  // @@protoc_insertion_point(field_get:iff.IFFData.lon)
-  return _internal_lon();
-}
-inline void IFFData::_internal_set_lon(double value) {
-  
-  lon_ = value;
-}
-inline void IFFData::set_lon(double value) {
-  _internal_set_lon(value);
-  // @@protoc_insertion_point(field_set:iff.IFFData.lon)
-}
-
-// string callsign = 4;
-inline void IFFData::clear_callsign() {
-  callsign_.ClearToEmpty();
-}
-inline const std::string& IFFData::callsign() const {
-  // @@protoc_insertion_point(field_get:iff.IFFData.callsign)
-  return _internal_callsign();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void IFFData::set_callsign(ArgT0&& arg0, ArgT... args) {
- 
- callsign_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:iff.IFFData.callsign)
-}
-inline std::string* IFFData::mutable_callsign() {
-  std::string* _s = _internal_mutable_callsign();
-  // @@protoc_insertion_point(field_mutable:iff.IFFData.callsign)
-  return _s;
-}
-inline const std::string& IFFData::_internal_callsign() const {
-  return callsign_.Get();
-}
-inline void IFFData::_internal_set_callsign(const std::string& value) {
-  
-  callsign_.Set(value, GetArenaForAllocation());
-}
-inline std::string* IFFData::_internal_mutable_callsign() {
-  
-  return callsign_.Mutable(GetArenaForAllocation());
-}
-inline std::string* IFFData::release_callsign() {
-  // @@protoc_insertion_point(field_release:iff.IFFData.callsign)
-  return callsign_.Release();
-}
-inline void IFFData::set_allocated_callsign(std::string* callsign) {
-  if (callsign != nullptr) {
-    
-  } else {
-    
-  }
-  callsign_.SetAllocated(callsign, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (callsign_.IsDefault()) {
-    callsign_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:iff.IFFData.callsign)
-}
-
-// string id = 5;
-inline void IFFData::clear_id() {
-  id_.ClearToEmpty();
-}
-inline const std::string& IFFData::id() const {
-  // @@protoc_insertion_point(field_get:iff.IFFData.id)
-  return _internal_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void IFFData::set_id(ArgT0&& arg0, ArgT... args) {
- 
- id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:iff.IFFData.id)
-}
-inline std::string* IFFData::mutable_id() {
-  std::string* _s = _internal_mutable_id();
-  // @@protoc_insertion_point(field_mutable:iff.IFFData.id)
-  return _s;
-}
-inline const std::string& IFFData::_internal_id() const {
-  return id_.Get();
-}
-inline void IFFData::_internal_set_id(const std::string& value) {
-  
-  id_.Set(value, GetArenaForAllocation());
-}
-inline std::string* IFFData::_internal_mutable_id() {
-  
-  return id_.Mutable(GetArenaForAllocation());
-}
-inline std::string* IFFData::release_id() {
-  // @@protoc_insertion_point(field_release:iff.IFFData.id)
-  return id_.Release();
-}
-inline void IFFData::set_allocated_id(std::string* id) {
-  if (id != nullptr) {
-    
-  } else {
-    
-  }
-  id_.SetAllocated(id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (id_.IsDefault()) {
-    id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:iff.IFFData.id)
-}
-
-// -------------------------------------------------------------------
-
-// IFFRequest
-
-// double lat = 1;
-inline void IFFRequest::clear_lat() {
-  lat_ = 0;
-}
-inline double IFFRequest::_internal_lat() const {
-  return lat_;
-}
-inline double IFFRequest::lat() const {
-  // @@protoc_insertion_point(field_get:iff.IFFRequest.lat)
-  return _internal_lat();
-}
-inline void IFFRequest::_internal_set_lat(double value) {
-  
-  lat_ = value;
-}
-inline void IFFRequest::set_lat(double value) {
-  _internal_set_lat(value);
-  // @@protoc_insertion_point(field_set:iff.IFFRequest.lat)
-}
-
-// double lon = 2;
-inline void IFFRequest::clear_lon() {
-  lon_ = 0;
-}
-inline double IFFRequest::_internal_lon() const {
-  return lon_;
-}
-inline double IFFRequest::lon() const {
-  // @@protoc_insertion_point(field_get:iff.IFFRequest.lon)
-  return _internal_lon();
-}
-inline void IFFRequest::_internal_set_lon(double value) {
-  
-  lon_ = value;
-}
-inline void IFFRequest::set_lon(double value) {
-  _internal_set_lon(value);
-  // @@protoc_insertion_point(field_set:iff.IFFRequest.lon)
-}
-
-// double radius_km = 3;
-inline void IFFRequest::clear_radius_km() {
-  radius_km_ = 0;
-}
-inline double IFFRequest::_internal_radius_km() const {
-  return radius_km_;
-}
-inline double IFFRequest::radius_km() const {
-  // @@protoc_insertion_point(field_get:iff.IFFRequest.radius_km)
-  return _internal_radius_km();
-}
-inline void IFFRequest::_internal_set_radius_km(double value) {
-  
-  radius_km_ = value;
-}
-inline void IFFRequest::set_radius_km(double value) {
-  _internal_set_radius_km(value);
-  // @@protoc_insertion_point(field_set:iff.IFFRequest.radius_km)
-}
-
-// -------------------------------------------------------------------
-
-// IFFStreamResponse
-
-// .iff.IFFData data = 1;
-inline bool IFFStreamResponse::_internal_has_data() const {
-  return this != internal_default_instance() && data_ != nullptr;
-}
-inline bool IFFStreamResponse::has_data() const {
-  return _internal_has_data();
-}
-inline void IFFStreamResponse::clear_data() {
-  if (GetArenaForAllocation() == nullptr && data_ != nullptr) {
-    delete data_;
-  }
-  data_ = nullptr;
-}
-inline const ::iff::IFFData& IFFStreamResponse::_internal_data() const {
-  const ::iff::IFFData* p = data_;
-  return p != nullptr ? *p : reinterpret_cast<const ::iff::IFFData&>(
-      ::iff::_IFFData_default_instance_);
-}
-inline const ::iff::IFFData& IFFStreamResponse::data() const {
-  // @@protoc_insertion_point(field_get:iff.IFFStreamResponse.data)
-  return _internal_data();
-}
-inline void IFFStreamResponse::unsafe_arena_set_allocated_data(
-    ::iff::IFFData* data) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(data_);
-  }
-  data_ = data;
-  if (data) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:iff.IFFStreamResponse.data)
-}
-inline ::iff::IFFData* IFFStreamResponse::release_data() {
-  
-  ::iff::IFFData* temp = data_;
-  data_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::iff::IFFData* IFFStreamResponse::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_release:iff.IFFStreamResponse.data)
-  
-  ::iff::IFFData* temp = data_;
-  data_ = nullptr;
-  return temp;
-}
-inline ::iff::IFFData* IFFStreamResponse::_internal_mutable_data() {
-  
-  if (data_ == nullptr) {
-    auto* p = CreateMaybeMessage<::iff::IFFData>(GetArenaForAllocation());
-    data_ = p;
-  }
-  return data_;
-}
-inline ::iff::IFFData* IFFStreamResponse::mutable_data() {
-  ::iff::IFFData* _msg = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:iff.IFFStreamResponse.data)
-  return _msg;
-}
-inline void IFFStreamResponse::set_allocated_data(::iff::IFFData* data) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete data_;
-  }
-  if (data) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
-    if (message_arena != submessage_arena) {
-      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, data, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  data_ = data;
-  // @@protoc_insertion_point(field_set_allocated:iff.IFFStreamResponse.data)
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace iff
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_iff_2eproto
@@ -1,4 +1,9 @@
 #include "iffservice.h"
+#include "framearena.h"
+#include "idformat.h"
+#include "logger.h"
+#include "metrics.h"
+#include "timeutil.h"
 
 #include <grpcpp/grpcpp.h>
 #include "iff.grpc.pb.h"
@@ -10,58 +15,47 @@
 #include <cstdint>
 #include <vector>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 
-
-#include <bsoncxx/json.hpp>
-#include <bsoncxx/types.hpp>
-#include <mongocxx/client.hpp>
-#include <mongocxx/instance.hpp>
-#include <mongocxx/uri.hpp>
-
-
-static mongocxx::instance s_mongo_instance{};
+// Kayıt başına satırlar örneklenir.
+static LogRateLimiter s_iff_log_limiter(20);
+
+namespace {
+struct StreamMetrics {
+    MetricsRegistry& r = MetricsRegistry::instance();
+    Histogram& mongo_query = r.histogram("iff_mongo_query_duration_seconds", "TrackSource::load süresi (Mongo find + cursor okuma)");
+    Histogram& write = r.histogram("iff_stream_write_duration_seconds", "Tek bir ServerWriter::Write süresi");
+    Histogram& record_age = r.histogram("iff_record_age_at_write_seconds", "Kaydın Mongo'dan okunmasından (sim_time_us) Write tamamlanmasına kadar geçen süre");
+    Counter& messages_sent = r.counter("iff_messages_sent_total", "Gönderilen IFF mesajları");
+    Counter& frames_dropped = r.counter("iff_frames_dropped_total", "Yazma hatası yüzünden yarım kalan akışlar");
+    Gauge& active_streams = r.gauge("iff_active_streams", "Açık StreamIFFData çağrıları");
+};
+
+StreamMetrics& metrics() {
+    static StreamMetrics m;
+    return m;
+}
+} // namespace
 
 
 IFFServiceImpl::IFFServiceImpl(std::string mongo_uri,
                                std::string db_name,
                                std::string coll_name)
-    : mongo_uri_(std::move(mongo_uri)),
-      db_name_(std::move(db_name)),
-      coll_name_(std::move(coll_name))
+    : IFFServiceImpl(std::make_unique<MongoTrackSource>(std::move(mongo_uri), std::move(db_name),
+                                                        std::move(coll_name), TrackSchema::iff()))
 {
 }
 
-
-
-std::string IFFServiceImpl::get_string_utf8(const bsoncxx::document::view& v,
-                                            const char* key,
-                                            const std::string& def) {
-    auto elem = v[key];
-    if (!elem) return def;
-    if (elem.type() == bsoncxx::type::k_string) {
-        auto sv = elem.get_string().value;
-        return std::string(sv.data(), sv.size());
-    }
-    return def;
+IFFServiceImpl::IFFServiceImpl(std::unique_ptr<TrackSource> source)
+    : source_(std::move(source))
+{
 }
 
-bool IFFServiceImpl::get_double_safe(const bsoncxx::document::view& v,
-                                     const char* key,
-                                     double& out) {
-    auto elem = v[key];
-    if (!elem) return false;
-    switch (elem.type()) {
-        case bsoncxx::type::k_double: out = elem.get_double().value; return true;
-        case bsoncxx::type::k_int32:  out = static_cast<double>(elem.get_int32().value); return true;
-        case bsoncxx::type::k_int64:  out = static_cast<double>(elem.get_int64().value); return true;
-        default: return false;
-    }
-}
 
-bool IFFServiceImpl::is_in_tr_bbox(double lat, double lon) {
-    return (lat >= 36.0 && lat <= 42.0 && lon >= 26.0 && lon <= 45.0);
+
+void IFFServiceImpl::setOperatingArea(std::shared_ptr<const OperatingArea> area)
+{
+    std::lock_guard<std::mutex> lock(area_mutex_);
+    area_ = std::move(area);
 }
 
 
@@ -71,83 +65,97 @@ grpc::Status IFFServiceImpl::StreamIFFData(
     const iff::IFFRequest* request,
     grpc::ServerWriter<iff::IFFStreamResponse>* writer)
 {
-    try {
-        mongocxx::client conn{mongocxx::uri{mongo_uri_}};
-        auto db   = conn[db_name_];
-        auto coll = db[coll_name_];
-
-        struct IFFRecord {
-            std::string callsign;
-            std::string status;
-            double lat;
-            double lon;
-        };
-
-        std::vector<IFFRecord> records;
-
-        auto cursor = coll.find({});
-        for (auto&& doc : cursor) {
-            std::string callsign = get_string_utf8(doc, "callsign", "UNKNOWN");
-            std::string status   = get_string_utf8(doc, "status", "UNKNOWN");
+    GaugeGuard stream_guard(metrics().active_streams);
+    return sendRecords(context, request, writer);
+}
 
-            double lat = 0.0, lon = 0.0;
-            if (!get_double_safe(doc, "lat", lat)) continue;
-            if (!get_double_safe(doc, "lon", lon)) continue;
+grpc::Status IFFServiceImpl::sendRecords(
+    grpc::ServerContext* context,
+    const iff::IFFRequest* request,
+    grpc::ServerWriterInterface<iff::IFFStreamResponse>* writer)
+{
+    try {
+        std::vector<TrackRecord> records;
 
-            if (!is_in_tr_bbox(lat, lon)) continue;
+        const auto query_start = std::chrono::steady_clock::now();
+        const int64_t sim_time_us = unix_micros();
+        source_->load(records);
+        metrics().mongo_query.record(std::chrono::steady_clock::now() - query_start);
 
-            records.push_back({callsign, status, lat, lon});
+        std::shared_ptr<const OperatingArea> area;
+        {
+            std::lock_guard<std::mutex> lock(area_mutex_);
+            area = area_;
         }
+        records.erase(std::remove_if(records.begin(), records.end(),
+                                     [&area](const TrackRecord& r) { return !area->contains(r.lat, r.lon); }),
+                      records.end());
 
         // Lat → Lon → Callsign sırasına göre sırala
         std::sort(records.begin(), records.end(),
-            [](const IFFRecord& a, const IFFRecord& b) {
+            [](const TrackRecord& a, const TrackRecord& b) {
                 if (a.lat != b.lat) return a.lat < b.lat;
                 if (a.lon != b.lon) return a.lon < b.lon;
                 return a.callsign < b.callsign;
             });
 
         // ID üret ve gönder
-        std::ostringstream oss;
+        char id[kRankIdBufSize];
         int rank = 0;
+        uint64_t seq = 0;
+
+        // Her kayıt arenada kurulur ve Write'tan hemen sonra bırakılır; blok
+        // stream boyunca yeniden kullanılır.
+        FrameArena arena(4 * 1024);
 
         for (const auto& rec : records) {
             ++rank;
-            oss.str(std::string());
-            oss.clear();
-            oss << "ID" << std::setw(3) << std::setfill('0') << rank;
 
-            iff::IFFStreamResponse resp;
+            iff::IFFStreamResponse& resp = *arena.create<iff::IFFStreamResponse>();
             iff::IFFData* data = resp.mutable_data();
-            data->set_id(oss.str()); 
+            data->set_id(id, format_rank_id(id, "ID", rank)); 
             data->set_status(rec.status);
             data->set_lat(rec.lat);
             data->set_lon(rec.lon);
             data->set_callsign(rec.callsign);
+            resp.set_seq(++seq);
+            resp.set_sim_time_us(sim_time_us);
+
+            // Konsola log (örneklenmiş)
+            if (s_iff_log_limiter.allow(LogLevel::Info)) {
+                Logger::instance().log(LogLevel::Info, "IFF",
+                                       {{"id", data->id()},
+                                        {"callsign", data->callsign()},
+                                        {"status", data->status()},
+                                        {"lat", data->lat()},
+                                        {"lon", data->lon()}});
+            }
 
-            // Konsola log
-            std::cout << "[IFF] ID: " << data->id()
-                      << " | Callsign: " << data->callsign()
-                      << " | Status: " << data->status()
-                      << " | Lat: " << data->lat()
-                      << " | Lon: " << data->lon()
-                      << std::endl;
+            resp.set_enqueue_time_us(unix_micros());
+            const auto write_start = std::chrono::steady_clock::now();
+            const bool written = writer->Write(resp);
+            arena.reset();
+            metrics().write.record(std::chrono::steady_clock::now() - write_start);
+            metrics().record_age.record(micros_since(sim_time_us, unix_micros()));
 
-            if (!writer->Write(resp)) {
-                std::cerr << "[IFF] Client disconnected." << std::endl;
+            if (!written) {
+                metrics().frames_dropped.inc();
+                Logger::instance().log(LogLevel::Info, "IFF", {{"msg", "Client disconnected"}});
                 break;
             }
+            metrics().messages_sent.inc();
 
             if (context->IsCancelled()) {
-                std::cout << "[IFF] Stream cancelled by client." << std::endl;
+                Logger::instance().log(LogLevel::Info, "IFF", {{"msg", "Stream cancelled by client"}});
                 break;
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            if (!request->unpaced())
+                std::this_thread::sleep_for(std::chrono::milliseconds(pacing_ms_.load(std::memory_order_relaxed)));
         }
 
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] MongoDB IFF query failed: " << e.what() << std::endl;
+        Logger::instance().log(LogLevel::Error, "IFF", {{"msg", "IFF source query failed"}, {"what", e.what()}});
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
     }
 
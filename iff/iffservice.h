@@ -2,40 +2,49 @@
 #define IFFSERVICE_H
 
 #include "iff.grpc.pb.h"
+#include "operatingarea.h"
+#include "tracksource.h"
 #include <grpcpp/grpcpp.h>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
-
-#include <bsoncxx/document/view.hpp>
-#include <bsoncxx/types.hpp>
-
 class IFFServiceImpl final : public iff::IFFService::Service
 {
+    friend struct IFFBenchAccess;
+
 public:
     explicit IFFServiceImpl(std::string mongo_uri,
                             std::string db_name,
                             std::string coll_name);
+    explicit IFFServiceImpl(std::unique_ptr<TrackSource> source);
+
+    // Kayıtlar arası bekleme (config iff.pacing_ms); açık stream'lere de hemen uygulanır.
+    void setPacingMs(int ms) { pacing_ms_.store(ms < 0 ? 0 : ms, std::memory_order_relaxed); }
+
+    // Kayıt kabul alanı (config area.path); sonraki stream'den itibaren geçerli.
+    void setOperatingArea(std::shared_ptr<const OperatingArea> area);
 
     grpc::Status StreamIFFData(grpc::ServerContext* context,
                                const iff::IFFRequest* request,
                                grpc::ServerWriter<iff::IFFStreamResponse>* writer) override;
 
 private:
-   
-    static std::string get_string_utf8(const bsoncxx::document::view& v,
-                                       const char* key,
-                                       const std::string& def = {});
-    static bool        get_double_safe(const bsoncxx::document::view& v,
-                                       const char* key,
-                                       double& out);
-    static bool        is_in_tr_bbox(double lat, double lon);
-
- 
-    std::string mongo_uri_;
-    std::string db_name_;
-    std::string coll_name_;
+    // Kaynağı okuyup kayıtları sırayla yazar. ServerWriterInterface: iff_bench
+    // gRPC'siz sahte writer ile çağırır.
+    grpc::Status sendRecords(grpc::ServerContext* context,
+                             const iff::IFFRequest* request,
+                             grpc::ServerWriterInterface<iff::IFFStreamResponse>* writer);
+
+    std::unique_ptr<TrackSource> source_;
+
+    std::atomic<int> pacing_ms_{50};
+
+    std::shared_ptr<const OperatingArea> area_ = std::make_shared<OperatingArea>();
+    std::mutex area_mutex_;
 };
 
 #endif 
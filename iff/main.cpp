@@ -1,4 +1,9 @@
 #include "iffservice.h"
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "serverconfig.h"
+#include "tracksource.h"
 #include <grpcpp/grpcpp.h>
 #include <iostream>
 #include <memory>
@@ -36,35 +41,68 @@ void TestMongoIFF(const std::string& mongo_uri,
     }
 }
 
-void RunServer()
+void RunServer(Config& cfg)
 {
-    const std::string server_address = "0.0.0.0:50051";
-    const std::string mongo_uri      = "mongodb://localhost:27017";
-    const std::string db_name        = "aewc";
-    const std::string coll_name      = "iff";
+    const std::string server_address = cfg.getString("iff.address", "0.0.0.0:50051");
+    const std::string mongo_uri      = cfg.getString("mongo.uri", "mongodb://localhost:27017");
+    const std::string db_name        = cfg.getString("mongo.db", "aewc");
+    const std::string coll_name      = cfg.getString("iff.collection", "iff");
 
 
-    TestMongoIFF(mongo_uri, db_name, coll_name);
+    // source.spec=file:/data/{coll}.bson veya synthetic:N ile Mongo'suz çalışır.
+    const std::string source_spec = cfg.getString("source.spec", track_source_spec_from_env());
+    if (source_spec == "mongo")
+        TestMongoIFF(mongo_uri, db_name, coll_name);
 
+    auto source = make_track_source(source_spec, mongo_uri, db_name, coll_name, TrackSchema::iff(), nullptr,
+                                    static_cast<int32_t>(cfg.getInt("mongo.batch_size", 0)));
+    const std::string source_desc = source->describe();
+    IFFServiceImpl service(std::move(source));
+    service.setPacingMs(static_cast<int>(cfg.getInt("iff.pacing_ms", 50)));
+    if (auto area = load_operating_area(cfg.getString("area.path", "")))
+        service.setOperatingArea(std::move(area));
 
-    IFFServiceImpl service(mongo_uri, db_name, coll_name);
+    // SIGHUP: iff.pacing_ms, area.path ve log.level yeniden okunur.
+    ConfigWatcher watcher;
+    watcher.start(cfg, [&service](const Config& c) {
+        service.setPacingMs(static_cast<int>(c.getInt("iff.pacing_ms", 50)));
+        if (auto area = load_operating_area(c.getString("area.path", "")))
+            service.setOperatingArea(std::move(area));
+        Logger::instance().setLevel(logger_options(c).level);
+    });
 
     grpc::ServerBuilder builder;
+    apply_server_config(cfg, builder);
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
 
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
     std::cout << "[INFO] IFF Service listening on " << server_address << std::endl;
-    std::cout << "[INFO] MongoDB: " << mongo_uri << " / " << db_name << "." << coll_name << std::endl;
+    std::cout << "[INFO] Veri kaynağı: " << source_desc << std::endl;
     std::cout << "[INFO] CTRL+C ile durdurabilirsiniz." << std::endl;
 
     server->Wait();
 }
 
-int main()
+int main(int argc, char** argv)
 {
+    // --config iff.conf ve --anahtar=değer override'ları (bkz. config/aewc.conf).
+    Config cfg;
+    std::string cfg_error;
+    if (!cfg.load(argc, argv, &cfg_error)) {
+        std::cerr << "[ERROR] " << cfg_error << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Logger::instance().start(logger_options(cfg));
+
+    MetricsRegistry::instance().callbackGauge("aewc_log_records_dropped", "Kuyruk dolu olduğu için düşürülen log kayıtları",
+                                              [] { return static_cast<double>(Logger::instance().dropped()); });
+    MetricsServer metrics_server;
+    metrics_server.start(static_cast<uint16_t>(cfg.getInt("iff.metrics_port", MetricsServer::portFromEnv(9251))));
+
     try {
-        RunServer();
+        RunServer(cfg);
     }
     catch (const std::exception& ex) {
         std::cerr << "[ERROR] Exception in server: " << ex.what() << std::endl;
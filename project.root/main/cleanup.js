@@ -1,5 +1,7 @@
 import { stopActiveStream } from './radarStream.js';
+import { stopActiveFusionStream } from './fusionStream.js';
 
 export function cleanup() {
   stopActiveStream();
+  stopActiveFusionStream();
 }
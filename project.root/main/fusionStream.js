@@ -0,0 +1,48 @@
+import { ipcMain } from 'electron';
+import { fusionClient } from './grpcClient.js';
+
+let activeFusionStream = null;
+
+// Her mesaj bir tick'in parçasıdır (tracks + last); renderer'a olduğu gibi iletilir.
+ipcMain.on('fusion:startStream', (event) => {
+  if (activeFusionStream) {
+    try { activeFusionStream.cancel(); } catch {}
+    activeFusionStream = null;
+  }
+
+  const call = fusionClient.StreamFusedTracks({});
+  activeFusionStream = call;
+
+  call.on('data', (frame) => {
+    event.sender.send('fusion:streamData', frame);
+  });
+
+  call.on('end', () => {
+    console.log('[FUSION STREAM] End of stream');
+    event.sender.send('fusion:streamEnd');
+    activeFusionStream = null;
+  });
+
+  call.on('error', (err) => {
+    console.error('[FUSION STREAM] Error:', err?.message || String(err));
+    event.sender.send('fusion:streamError', err?.message || String(err));
+    activeFusionStream = null;
+  });
+});
+
+ipcMain.on('fusion:stopStream', (event) => {
+  if (activeFusionStream) {
+    try { activeFusionStream.cancel(); } catch {}
+    activeFusionStream = null;
+    console.log('[FUSION STREAM] Stopped by client');
+    event.sender.send('fusion:streamStopped');
+  }
+});
+
+export function stopActiveFusionStream() {
+  if (activeFusionStream) {
+    try { activeFusionStream.cancel(); } catch {}
+    activeFusionStream = null;
+    console.log('[FUSION STREAM] Stopped programmatically');
+  }
+}
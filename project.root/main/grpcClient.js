@@ -29,3 +29,16 @@ export const iffClient = new iffGrpcObj.iff.IFFService(
   'localhost:50051', 
   grpc.credentials.createInsecure()
 );
+
+
+const fusionPackageDef = protoLoader.loadSync(
+  path.join(__dirname, '../proto/fusion.proto'),
+  { keepCase: true, longs: String, enums: String, defaults: true, oneofs: true }
+);
+const fusionGrpcObj = grpc.loadPackageDefinition(fusionPackageDef);
+
+// Radar + IFF + DataLink'i sunucuda birleştiren servis.
+export const fusionClient = new fusionGrpcObj.fusion.FusionService(
+  'localhost:50054',
+  grpc.credentials.createInsecure()
+);
@@ -3,6 +3,7 @@ import { createWindow } from './window.js';
 import './grpcClient.js';
 import './radarStream.js';
 import './iffStream.js';
+import './fusionStream.js';
 import { cleanup } from './cleanup.js';
 import fs from 'fs';
 import path from 'path';
@@ -2,6 +2,24 @@ import { ipcMain } from 'electron';
 import { radarClient } from './grpcClient.js';
 
 let activeStream = null;
+let viewportMode = false;
+
+function toViewportMessage(viewport, refreshMs) {
+  return {
+    min_lat: viewport.minLat,
+    min_lon: viewport.minLon,
+    max_lat: viewport.maxLat,
+    max_lon: viewport.maxLon,
+    zoom: Math.round(viewport.zoom ?? 0),
+    refresh_interval_ms: refreshMs,
+    // CLUSTER_AUTO: düşük zoom'da sunucu hedefleri kümeler.
+    cluster: viewport.cluster ?? 'CLUSTER_AUTO',
+    // Harita EPSG:3857'deyse sunucu merc_x/merc_y'yi hesaplar.
+    web_mercator: viewport.webMercator ?? true,
+    // Konumlar sunucudaki Kalman filtresinden gelir (zıplama yok).
+    smoothed: viewport.smoothed ?? true
+  };
+}
 
 ipcMain.on('radar:startStream', (event, args) => {
   if (activeStream) {
@@ -11,13 +29,37 @@ ipcMain.on('radar:startStream', (event, args) => {
 
   const refreshMs = args?.refresh_interval_ms ?? 1000;
 
-  const call = radarClient.StreamRadarTargets({
-    refresh_interval_ms: refreshMs
-  });
+  // Görünüm verildiyse sadece o alan abone olunur (SubscribeViewport);
+  // pan/zoom sonrası radar:setViewport ile güncellenir.
+  viewportMode = !!args?.viewport;
+  const call = viewportMode
+    ? radarClient.SubscribeViewport()
+    : radarClient.StreamRadarTargets({
+        refresh_interval_ms: refreshMs,
+        web_mercator: args?.web_mercator ?? true,
+        smoothed: args?.smoothed ?? true
+      });
+  if (viewportMode) {
+    call.refreshMs = refreshMs;
+    call.write(toViewportMessage(args.viewport, refreshMs));
+  }
 
   activeStream = call;
 
-  call.on('data', (target) => {
+  call.on('data', (msg) => {
+  if (viewportMode && msg.kind === 'LEAVE') {
+    event.sender.send('radar:streamLeave', msg.target?.id);
+    return;
+  }
+  if (viewportMode && msg.kind === 'CLUSTER_UPDATE') {
+    event.sender.send('radar:clusterData', msg.cluster);
+    return;
+  }
+  if (viewportMode && msg.kind === 'CLUSTER_REMOVE') {
+    event.sender.send('radar:clusterRemove', msg.cluster?.id);
+    return;
+  }
+  const target = viewportMode ? msg.target : msg;
 
   console.log(
     `[STREAM] id=${target.id}, ` +
@@ -46,6 +88,15 @@ ipcMain.on('radar:startStream', (event, args) => {
   });
 });
 
+ipcMain.on('radar:setViewport', (_event, viewport) => {
+  if (!activeStream || !viewportMode || !viewport) return;
+  try {
+    activeStream.write(toViewportMessage(viewport, activeStream.refreshMs));
+  } catch (err) {
+    console.error('[STREAM] Viewport gönderilemedi:', err?.message || String(err));
+  }
+});
+
 ipcMain.on('radar:stopStream', (event) => {
   if (activeStream) {
     try { activeStream.cancel(); } catch {}
@@ -38,8 +38,41 @@ function createStreamAPI(prefix) {
   };
 }
 
-contextBridge.exposeInMainWorld('radar', createStreamAPI('radar'));
+contextBridge.exposeInMainWorld('radar', {
+  ...createStreamAPI('radar'),
+  /**
+   * Sadece verilen görünümdeki hedefleri akıtır (SubscribeViewport)
+   * @param {{minLat:number, minLon:number, maxLat:number, maxLon:number, zoom:number}} viewport
+   */
+  startViewportStream: (viewport, refreshMs = 1000) => {
+    ipcRenderer.send('radar:startStream', { refresh_interval_ms: refreshMs, viewport });
+  },
+  setViewport: (viewport) => {
+    ipcRenderer.send('radar:setViewport', viewport);
+  },
+  onStreamLeave: (callback) => {
+    const wrapped = (_, id) => callback?.(id);
+    ipcRenderer.on('radar:streamLeave', wrapped);
+    return () => ipcRenderer.removeListener('radar:streamLeave', wrapped);
+  },
+  /**
+   * Düşük zoom'da sunucunun gönderdiği kümeler
+   * @param {(cluster:{id:string, lat:number, lon:number, count:number, dominant_status:string, zoom:number}) => void} callback
+   */
+  onClusterData: (callback) => {
+    const wrapped = (_, cluster) => callback?.(cluster);
+    ipcRenderer.on('radar:clusterData', wrapped);
+    return () => ipcRenderer.removeListener('radar:clusterData', wrapped);
+  },
+  onClusterRemove: (callback) => {
+    const wrapped = (_, id) => callback?.(id);
+    ipcRenderer.on('radar:clusterRemove', wrapped);
+    return () => ipcRenderer.removeListener('radar:clusterRemove', wrapped);
+  }
+});
 contextBridge.exposeInMainWorld('iff', createStreamAPI('iff'));
+// Sunucuda birleştirilmiş radar + IFF + DataLink izleri (FusedFrame parçaları)
+contextBridge.exposeInMainWorld('fusion', createStreamAPI('fusion'));
 
 contextBridge.exposeInMainWorld('geo', {
   open: () => ipcRenderer.invoke('geo:open'),
@@ -5,7 +5,7 @@ import './map/initMap.js';
 import { setDrawInteraction, ensureModify, ensureTranslate } from './map/interactions.js';
 import { changeLayer } from './map/layerControl.js';
 import { loadGeoJsonFromFile, saveGeoJsonToFile, loadExampleGeoJson } from './map/geoJsonHandlers.js';
-import { startRadarStream, loadRadarTargets } from './map/radarIntegration.js';
+import { startRadarStream, startFusedStream, loadRadarTargets } from './map/radarIntegration.js';
 import { drawSource, map, radarLayer } from './map/initMap.js';
 import { setStatus } from './ui/status.js';
 import { initMergedPopup } from './map/radarPopup.js';
@@ -59,68 +59,81 @@ const iffTargets = new Map();
 const cleanId = (id) => (id || '').trim().toUpperCase();
 
 
-window.iff.startStream({
-  lat: 0,
-  lon: 0,
-  radius_km: 0
-});
+// Önce fusion servisi denenir (tek stream, sunucuda eşleştirme); yoksa
+// IFF yüklenip radar stream'i client tarafı eşleştirmeyle başlatılır.
+function startIffRadarStreams() {
+  window.iff.startStream({
+    lat: 0,
+    lon: 0,
+    radius_km: 0
+  });
 
 
-window.iff.onStreamData((data) => {
-  if (!data) return;
-  const id = cleanId(data.id);
-  console.log('[IFF STREAM]', data);
+  window.iff.onStreamData((data) => {
+    if (!data) return;
+    const id = cleanId(data.id);
+    console.log('[IFF STREAM]', data);
 
-  iffTargets.set(id, {
-    id,
-    status: data.status,
-    lat: data.lat,
-    lon: data.lon,
-    callsign: data.callsign
+    iffTargets.set(id, {
+      id,
+      status: data.status,
+      lat: data.lat,
+      lon: data.lon,
+      callsign: data.callsign
+    });
   });
-});
 
-window.iff.onStreamError((err) => {
-  console.error('[IFF STREAM] Error:', err);
-  setStatus('IFF stream hatası');
-});
+  window.iff.onStreamError((err) => {
+    console.error('[IFF STREAM] Error:', err);
+    setStatus('IFF stream hatası');
+  });
 
-let radarRendererListenerAttached = false;
+  let radarRendererListenerAttached = false;
 
-window.iff.onStreamEnd(() => {
-  console.log('[IFF STREAM] End of stream, starting radar stream...');
+  window.iff.onStreamEnd(() => {
+    console.log('[IFF STREAM] End of stream, starting radar stream...');
 
-  if (!radarRendererListenerAttached) {
-    radarRendererListenerAttached = true;
+    if (!radarRendererListenerAttached) {
+      radarRendererListenerAttached = true;
 
-    window.radar.onStreamData((t) => {
-      const id = cleanId(t.id);
-      console.log('[RADAR STREAM - Renderer]', t);
+      window.radar.onStreamData((t) => {
+        const id = cleanId(t.id);
+        console.log('[RADAR STREAM - Renderer]', t);
 
-      const iffMatch = iffTargets.get(id);
-      if (iffMatch) {
-        console.log('[MATCH FOUND]', { radar: t, iff: iffMatch });
-      } else {
-        console.log('[NO MATCH]', id);
-      }
-    });
+        const iffMatch = iffTargets.get(id);
+        if (iffMatch) {
+          console.log('[MATCH FOUND]', { radar: t, iff: iffMatch });
+        } else {
+          console.log('[NO MATCH]', id);
+        }
+      });
 
-    window.radar.onStreamError?.((err) => {
-      console.error('[RADAR STREAM - Renderer] Error:', err);
-    });
+      window.radar.onStreamError?.((err) => {
+        console.error('[RADAR STREAM - Renderer] Error:', err);
+      });
 
-    window.radar.onStreamEnd?.(() => {
-      console.log('[RADAR STREAM - Renderer] End of stream');
-    });
-  }
+      window.radar.onStreamEnd?.(() => {
+        console.log('[RADAR STREAM - Renderer] End of stream');
+      });
+    }
 
  
-  startRadarStream(iffTargets);
-});
+    startRadarStream(iffTargets);
+  });
 
-window.iff.onStreamStopped(() => {
-  console.log('[IFF STREAM] Stopped');
-});
+  window.iff.onStreamStopped(() => {
+    console.log('[IFF STREAM] Stopped');
+  });
+}
+
+if (window.fusion) {
+  startFusedStream((err) => {
+    console.warn('[FUSION STREAM] Kullanılamıyor, IFF + radar akışına geçiliyor:', err);
+    startIffRadarStreams();
+  });
+} else {
+  startIffRadarStreams();
+}
 
 
 initMergedPopup(map, radarLayer);
@@ -1,18 +1,81 @@
 import Feature from 'ol/Feature.js';
 import Point from 'ol/geom/Point.js';
-import { fromLonLat } from 'ol/proj.js';
-import { radarSource } from './initMap.js';
+import { fromLonLat, transformExtent } from 'ol/proj.js';
+import { map, radarSource } from './initMap.js';
 import { setStatus } from '../ui/status.js';
 
 const { logWrite } = window.electron || {};
 const { predict } = window.api || {};
 
 let targetTimers = new Map();
-let suspiciousTargets = [];
+const suspiciousTargets = new Map(); // radarId -> merged
 const manualOverrides = new Map(); // radarId -> { status: 'FOE' }
 
 const cleanId = (id) => (id || '').trim().toUpperCase();
 
+let viewportListenerKey = null;
+
+// Haritanın görünen alanı (WGS84) ve zoom seviyesi; radar servisi sadece
+// bu alandaki hedefleri gönderir.
+function currentViewport() {
+  const view = map.getView();
+  const [minLon, minLat, maxLon, maxLat] = transformExtent(
+    view.calculateExtent(map.getSize()), view.getProjection(), 'EPSG:4326');
+  return { minLat, minLon, maxLat, maxLon, zoom: view.getZoom(), webMercator: isWebMercatorView() };
+}
+
+function isWebMercatorView() {
+  return map.getView().getProjection().getCode() === 'EPSG:3857';
+}
+
+// Sunucu merc_x/merc_y gönderdiyse (web_mercator) projeksiyon tekrar yapılmaz.
+function mapCoordinate(msg, lon, lat) {
+  const x = Number(msg.merc_x);
+  const y = Number(msg.merc_y);
+  if ((x || y) && isWebMercatorView()) return [x, y];
+  return fromLonLat([lon, lat]);
+}
+
+function removeTarget(radarId) {
+  const f = radarSource.getFeatureById(radarId);
+  if (f) radarSource.removeFeature(f);
+  if (targetTimers.has(radarId)) clearTimeout(targetTimers.get(radarId));
+  targetTimers.delete(radarId);
+  if (suspiciousTargets.delete(radarId)) notifySuspicious();
+}
+
+function trackSuspicious(merged) {
+  if (merged.suspiciousProbability > 0) suspiciousTargets.set(merged.radarId, merged);
+  else suspiciousTargets.delete(merged.radarId);
+}
+
+function notifySuspicious() {
+  window.dispatchEvent(new CustomEvent('suspicious:update', { detail: [...suspiciousTargets.values()] }));
+}
+
+// Kümeler sunucu CLUSTER_REMOVE gönderene kadar kalır; zamanlayıcı yok.
+function updateCluster(c) {
+  const lat = Number(c.lat);
+  const lon = Number(c.lon);
+  if (!c.id || isNaN(lat) || isNaN(lon)) return;
+
+  const coord = mapCoordinate(c, lon, lat);
+  let feature = radarSource.getFeatureById(c.id);
+  if (!feature) {
+    feature = new Feature({ geometry: new Point(coord) });
+    feature.setId(c.id);
+    radarSource.addFeature(feature);
+  } else {
+    feature.getGeometry().setCoordinates(coord);
+  }
+  feature.setProperties({ cluster: true, count: c.count, status: c.dominant_status || 'UNKNOWN' });
+}
+
+function removeCluster(id) {
+  const f = id && radarSource.getFeatureById(id);
+  if (f) radarSource.removeFeature(f);
+}
+
 function logMergedCSV(merged) {
   const csvLine = [
     merged.radarId,
@@ -35,6 +98,63 @@ function logMergedCSV(merged) {
   }
 }
 
+// Birleştirilmiş hedefi (radar + kimlik) haritaya işler; radar ve fusion
+// stream'leri ortak kullanır.
+async function applyMerged(merged, coord) {
+  const { radarId } = merged;
+  const override = manualOverrides.get(radarId);
+  if (override) {
+    Object.assign(merged, override);
+  }
+
+  logMergedCSV(merged);
+
+  if (typeof merged.suspiciousProbability === 'number') {
+    // Fusion servisi skorladı; bildirim parça başına startFusedStream'de.
+    trackSuspicious(merged);
+  } else if (typeof predict === 'function') {
+    try {
+      const liveData = {
+        id1: merged.radarId,
+        id2: merged.id,
+        callsign: merged.callsign,
+        friend_foe: merged.status,
+        lat: merged.lat,
+        lon: merged.lon,
+        speed: merged.velocity,
+        baroAltitude: merged.baroAlt,
+        geoAltitude: merged.geoAlt,
+        heading: parseFloat(merged.heading)
+      };
+
+      const result = await predict(liveData);
+      merged.suspicious = result.prediction;
+      merged.suspiciousProbability = result.probability;
+      trackSuspicious(merged);
+      notifySuspicious();
+    } catch (err) {
+      console.error('[RadarStream] Tahmin API hatası:', err);
+    }
+  }
+
+  let feature = radarSource.getFeatureById(radarId);
+  if (!feature) {
+    feature = new Feature({
+      geometry: new Point(coord),
+      ...merged
+    });
+    feature.setId(radarId);
+    radarSource.addFeature(feature);
+  } else {
+    feature.getGeometry().setCoordinates(coord);
+    Object.keys(merged).forEach((key) => {
+      if (key !== 'geometry') feature.set(key, merged[key]);
+    });
+  }
+
+  setStatus(`Hedef güncellendi: ${radarId} (${merged.velocity ?? '-'} km/h)`);
+}
+
 export function startRadarStream(iffTargetsMap) {
   if (!(iffTargetsMap instanceof Map)) {
     console.error('startRadarStream: iffTargetsMap bir Map değil!', iffTargetsMap);
@@ -42,7 +162,17 @@ export function startRadarStream(iffTargetsMap) {
   }
 
   cleanupAllTargets();
-  window.radar.startStream();
+  if (typeof window.radar.startViewportStream === 'function') {
+    window.radar.startViewportStream(currentViewport());
+    if (!viewportListenerKey) {
+      viewportListenerKey = map.on('moveend', () => window.radar.setViewport(currentViewport()));
+    }
+    window.radar.onStreamLeave((id) => removeTarget(cleanId(id)));
+    window.radar.onClusterData(updateCluster);
+    window.radar.onClusterRemove(removeCluster);
+  } else {
+    window.radar.startStream();
+  }
 
   window.radar.onStreamData(async (t) => {
     const lat = parseFloat(t.lat ?? t.y_coordinate);
@@ -69,73 +199,13 @@ export function startRadarStream(iffTargetsMap) {
       heading: t.heading ?? "0"
     };
 
-    const override = manualOverrides.get(radarId);
-    if (override) {
-      Object.assign(merged, override);
-    }
-
-    logMergedCSV(merged);
-
-    if (typeof predict === 'function') {
-      try {
-        const liveData = {
-          id1: merged.radarId,
-          id2: merged.id,
-          callsign: merged.callsign,
-          friend_foe: merged.status,
-          lat: merged.lat,
-          lon: merged.lon,
-          speed: merged.velocity,
-          baroAltitude: merged.baroAlt,
-          geoAltitude: merged.geoAlt,
-          heading: parseFloat(merged.heading)
-        };
-
-        const result = await predict(liveData);
-        merged.suspicious = result.prediction;
-        merged.suspiciousProbability = result.probability;
-
-        if (result.probability > 0) {
-          const idx = suspiciousTargets.findIndex(t => t.radarId === merged.radarId);
-          if (idx >= 0) suspiciousTargets[idx] = merged;
-          else suspiciousTargets.push(merged);
-        } else {
-          suspiciousTargets = suspiciousTargets.filter(t => t.radarId !== merged.radarId);
-        }
-
-        window.dispatchEvent(new CustomEvent('suspicious:update', { detail: suspiciousTargets }));
-      } catch (err) {
-        console.error('[RadarStream] Tahmin API hatası:', err);
-      }
-    }
-
-    let feature = radarSource.getFeatureById(radarId);
-    if (!feature) {
-      feature = new Feature({
-        geometry: new Point(fromLonLat([lon, lat])),
-        ...merged
-      });
-      feature.setId(radarId);
-      radarSource.addFeature(feature);
-    } else {
-      feature.getGeometry().setCoordinates(fromLonLat([lon, lat]));
-      Object.keys(merged).forEach((key) => {
-        if (key !== 'geometry') feature.set(key, merged[key]);
-      });
-    }
+    await applyMerged(merged, mapCoordinate(t, lon, lat));
 
-    setStatus(`Hedef güncellendi: ${radarId} (${merged.velocity ?? '-'} km/h)`);
 
     if (targetTimers.has(radarId)) clearTimeout(targetTimers.get(radarId));
     const timer = setTimeout(() => {
-      const f = radarSource.getFeatureById(radarId);
-      if (f) {
-        radarSource.removeFeature(f);
-        setStatus(`Target kaldırıldı: ${radarId}`);
-      }
-      targetTimers.delete(radarId);
-      suspiciousTargets = suspiciousTargets.filter(t => t.radarId !== radarId);
-      window.dispatchEvent(new CustomEvent('suspicious:update', { detail: suspiciousTargets }));
+      removeTarget(radarId);
+      setStatus(`Target kaldırıldı: ${radarId}`);
     }, 2000);
     targetTimers.set(radarId, timer);
   });
@@ -151,13 +221,80 @@ export function startRadarStream(iffTargetsMap) {
   });
 }
 
+// Fusion servisinden birleştirilmiş izler: kimlik sunucuda konuma göre
+// eşleştirilir, IFF stream'i ve client tarafı eşleştirme gerekmez. Model
+// yüklüyse (part.scored) şüpheli hedef skoru da sunucudan gelir; hedef
+// başına predict çağrısı yapılmaz. Servise ulaşılamazsa (ilk frame gelmeden
+// hata) onUnavailable çağrılır.
+export function startFusedStream(onUnavailable) {
+  cleanupAllTargets();
+  let received = false;
+  let seen = new Set();
+
+  window.fusion.startStream();
+
+  window.fusion.onStreamData((part) => {
+    received = true;
+    const scored = Boolean(part?.scored);
+    for (const ft of part?.tracks ?? []) {
+      const lat = Number(ft.lat);
+      const lon = Number(ft.lon);
+      if (isNaN(lat) || isNaN(lon)) continue;
+
+      const radarId = cleanId(ft.radar_id);
+      seen.add(radarId);
+      applyMerged({
+        radarId,
+        id: radarId,
+        iffId: ft.iff_id || null,
+        datalinkId: ft.datalink_id || null,
+        lat,
+        lon,
+        velocity: ft.velocity ?? null,
+        baroAlt: ft.baro_altitude ?? null,
+        geoAlt: ft.geo_altitude ?? null,
+        status: ft.status || 'UNKNOWN',
+        callsign: ft.callsign || 'UNKNOWN',
+        heading: ft.heading ?? "0",
+        ...(scored && {
+          suspicious: ft.suspicious ? 1 : 0,
+          suspiciousProbability: Number(ft.suspicious_probability ?? 0)
+        })
+      }, mapCoordinate(ft, lon, lat));
+    }
+    if (scored) notifySuspicious();
+
+    // Tick'in son parçası: bu tick'te gelmeyen izler silinir.
+    if (part?.last) {
+      radarSource.getFeatures().forEach((f) => {
+        if (!seen.has(f.getId())) removeTarget(f.getId());
+      });
+      seen = new Set();
+    }
+  });
+
+  window.fusion.onStreamEnd(() => {
+    setStatus('Fusion stream kapandı (server)');
+    cleanupAllTargets();
+  });
+
+  window.fusion.onStreamError((err) => {
+    if (!received) {
+      onUnavailable?.(err);
+      return;
+    }
+    setStatus('Fusion stream hatası: ' + err);
+    cleanupAllTargets();
+  });
+}
+
 function cleanupAllTargets() {
   radarSource.clear();
   targetTimers.forEach((timer) => clearTimeout(timer));
   targetTimers.clear();
-  suspiciousTargets = [];
+  suspiciousTargets.clear();
   manualOverrides.clear();
-  window.dispatchEvent(new CustomEvent('suspicious:update', { detail: suspiciousTargets }));
+  notifySuspicious();
 }
 
 export async function loadRadarTargets() {
@@ -31,14 +31,39 @@ export const drawStyle = (feature) => {
 };
 
 
+function statusColor(status) {
+  if (status === 'FRIEND') return '#00ff00ff';
+  if (status === 'FOE') return '#ff0000ff';
+  if (status === 'UNKNOWN') return '#9B9B9BFF';
+  return '#000000ff'; // default siyah
+}
+
+// Sunucu kümesi: yarıçap hedef sayısının logaritmasıyla büyür, sayı ortada.
+function clusterStyle(feature) {
+  const count = feature.get('count') ?? 0;
+  const color = statusColor((feature.get('status') ?? 'UNKNOWN').toString());
+
+  return new Style({
+    image: new CircleStyle({
+      radius: 10 + 4 * Math.log10(Math.max(count, 1)),
+      fill: new Fill({ color }),
+      stroke: new Stroke({ color: '#ffffffff', width: 2 })
+    }),
+    text: new Text({
+      text: String(count),
+      font: 'bold 12px sans-serif',
+      fill: new Fill({ color: '#ffffff' }),
+      stroke: new Stroke({ color: '#000000', width: 3 })
+    })
+  });
+}
+
 export function radarStyle(feature) {
+  if (feature.get('cluster')) return clusterStyle(feature);
+
   const status = (feature.get('status') ?? 'UNKNOWN').toString();
   const callsign = (feature.get('callsign') ?? 'UNKNOWN').toString();
-
-  let color = '#000000ff'; // default siyah
-  if (status === 'FRIEND') color = '#00ff00ff';
-  else if (status === 'FOE') color = '#ff0000ff';
-  else if (status === 'UNKNOWN') color = '#9B9B9BFF';
+  const color = statusColor(status);
 
   return new Style({
     image: new CircleStyle({
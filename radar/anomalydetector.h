@@ -0,0 +1,361 @@
+#ifndef ANOMALYDETECTOR_H
+#define ANOMALYDETECTOR_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Hedef başına kısa pencereli, kural tabanlı anomali dedektörü (SoA).
+//
+// Her tick'te hedefin irtifa, hız, yön ve durum örneği kWindow'luk halka
+// tampona yazılır; halkanın başı tüm slotlar için ortaktır, kaydırma
+// gerekmez. evaluate() tüm slotlar üzerinde dalsız tek döngüdür (GCC -O3
+// ile vektörlenir) ve slot başına kural bit maskesi üretir. Alarm, kuralın
+// maskesi 0'dan 1'e geçtiği tick'te bir kez verilir; koşul kalkınca kural
+// yeniden kurulur.
+class AnomalyDetector
+{
+public:
+    static constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+    static constexpr std::size_t kWindow = 4;
+
+    // Bit sırası radar.proto'daki AnomalyRule ile aynıdır (enum = bit + 1).
+    enum Rule : uint8_t
+    {
+        kAltitudeJump = 1u << 0,     // ardışık iki örnek arası barometrik irtifa hızı
+        kAcceleration = 1u << 1,     // ardışık iki örnek arası hız değişimi
+        kHeadingReversal = 1u << 2,  // pencere boyunca yön değişimi
+        kAltitudeMismatch = 1u << 3, // transponder (baro) ile geometrik irtifa farkı
+        kStatusChange = 1u << 4,     // radar belgesindeki status'un reload'lar arasında değişmesi
+    };
+    static constexpr std::size_t kRuleCount = 5;
+    static constexpr uint8_t kAllRules = (1u << kRuleCount) - 1;
+    // Simülasyonda baro ve geo irtifa birbirinden bağımsız jitter'la kayar,
+    // |baro - geo| birkaç on tick içinde hedeflerin çoğunda 1000 m'yi aşar; bu yüzden
+    // irtifa uyuşmazlığı varsayılan kural setinde yoktur (gerçek veride açılır).
+    static constexpr uint8_t kDefaultRules = kAllRules & ~kAltitudeMismatch;
+
+    struct Params
+    {
+        uint8_t rules = kDefaultRules;
+        double max_climb_mps = 500.0;       // |Δbaro| / dt üst sınırı
+        double max_accel_mps2 = 50.0;       // |Δhız| / dt üst sınırı
+        double reversal_deg = 150.0;        // pencere başı ile son örnek arası yön farkı
+        double max_alt_mismatch_m = 1000.0; // |baro - geo| üst sınırı
+    };
+
+    // Yeni tick'te maskesi 0'dan 1'e geçen kurallar. tag, measure()'da
+    // verilen değerdir (radar'da hedefin tick'teki sırası).
+    struct Alert
+    {
+        uint32_t slot;
+        uint32_t tag;
+        uint8_t rules;
+    };
+
+    // "altitude_jump,acceleration,..." listesini maskeye çevirir; bilinmeyen
+    // adlar unknown'a eklenir. "all" tüm kurallar, "default" kDefaultRules,
+    // boş liste hiçbiri.
+    static uint8_t parseRules(const std::string &list, std::string *unknown)
+    {
+        uint8_t mask = 0;
+        std::size_t begin = 0;
+        while (begin <= list.size())
+        {
+            std::size_t end = list.find(',', begin);
+            if (end == std::string::npos)
+                end = list.size();
+            std::size_t a = begin, b = end;
+            while (a < b && (list[a] == ' ' || list[a] == '\t'))
+                ++a;
+            while (b > a && (list[b - 1] == ' ' || list[b - 1] == '\t'))
+                --b;
+            const std::string name = list.substr(a, b - a);
+            begin = end + 1;
+            if (name.empty())
+                continue;
+            if (name == "all")
+            {
+                mask |= kAllRules;
+                continue;
+            }
+            if (name == "default")
+            {
+                mask |= kDefaultRules;
+                continue;
+            }
+            bool found = false;
+            for (std::size_t i = 0; i < kRuleCount; ++i)
+            {
+                if (name == ruleName(static_cast<Rule>(1u << i)))
+                {
+                    mask |= static_cast<uint8_t>(1u << i);
+                    found = true;
+                }
+            }
+            if (!found && unknown)
+                *unknown += (unknown->empty() ? "" : ",") + name;
+        }
+        return mask;
+    }
+
+    static const char *ruleName(Rule rule)
+    {
+        switch (rule)
+        {
+        case kAltitudeJump:
+            return "altitude_jump";
+        case kAcceleration:
+            return "acceleration";
+        case kHeadingReversal:
+            return "heading_reversal";
+        case kAltitudeMismatch:
+            return "altitude_mismatch";
+        case kStatusChange:
+            return "status_change";
+        }
+        return "";
+    }
+
+    void reserve(std::size_t n)
+    {
+        for (std::vector<float> *v : floatArrays())
+            v->reserve(n);
+        for (std::vector<uint8_t> *v : byteArrays())
+            v->reserve(n);
+        tag_.reserve(n);
+    }
+
+    uint32_t add()
+    {
+        uint32_t slot;
+        if (!free_.empty())
+        {
+            slot = free_.back();
+            free_.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(alive_.size());
+            for (std::vector<float> *v : floatArrays())
+                v->push_back(0.0f);
+            for (std::vector<uint8_t> *v : byteArrays())
+                v->push_back(0);
+            tag_.push_back(0);
+        }
+        count_[slot] = 0;
+        last_mask_[slot] = 0;
+        alive_[slot] = 1;
+        ++active_;
+        return slot;
+    }
+
+    void remove(uint32_t slot)
+    {
+        if (slot == kNoSlot || slot >= alive_.size())
+            return;
+        alive_[slot] = 0;
+        count_[slot] = 0;
+        last_mask_[slot] = 0;
+        free_.push_back(slot);
+        --active_;
+    }
+
+    // Bu tick'in örneği; evaluate()'ten önce her canlı slot için çağrılır.
+    void measure(uint32_t slot, uint32_t tag, double baro_altitude, double geo_altitude, double speed,
+                 double heading, uint8_t status)
+    {
+        if (slot == kNoSlot)
+            return;
+        const std::size_t k = (head_ + 1) % kWindow;
+        baro_[k][slot] = static_cast<float>(baro_altitude);
+        speed_[k][slot] = static_cast<float>(speed);
+        heading_[k][slot] = static_cast<float>(heading);
+        status_[k][slot] = status;
+        geo_[slot] = static_cast<float>(geo_altitude);
+        tag_[slot] = tag;
+    }
+
+    // Halkayı ilerletir, tüm slotlarda kuralları değerlendirir ve yeni
+    // alarmları out'a ekler (out temizlenmez). Dönüş: eklenen alarm sayısı.
+    std::size_t evaluate(double dt, const Params &p, std::vector<Alert> &out)
+    {
+        head_ = (head_ + 1) % kWindow;
+        const std::size_t n = alive_.size();
+        const std::size_t prev = (head_ + kWindow - 1) % kWindow;
+        const std::size_t oldest = (head_ + 1) % kWindow;
+        Limits lim;
+        lim.alt_step = static_cast<float>(p.max_climb_mps * dt);
+        lim.speed_step = static_cast<float>(p.max_accel_mps2 * dt);
+        lim.reversal = static_cast<float>(p.reversal_deg);
+        lim.mismatch = static_cast<float>(p.max_alt_mismatch_m);
+        lim.rules = p.rules;
+
+        evaluateKernel(n, lim, baro_[head_].data(), baro_[prev].data(), speed_[head_].data(), speed_[prev].data(),
+                       heading_[head_].data(), heading_[oldest].data(), status_[head_].data(),
+                       status_[prev].data(), geo_.data(), alive_.data(), count_.data(), last_mask_.data(),
+                       raised_.data());
+
+        // Yeni alarm seyrek; bayt dizisi 8'er 8'er taranır.
+        const std::size_t before = out.size();
+        const uint8_t *raised = raised_.data();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, raised + i, 8);
+            if (word == 0)
+                continue;
+            for (std::size_t j = i; j < i + 8; ++j)
+                if (raised[j])
+                    out.push_back(Alert{static_cast<uint32_t>(j), tag_[j], raised[j]});
+        }
+        for (; i < n; ++i)
+            if (raised[i])
+                out.push_back(Alert{static_cast<uint32_t>(i), tag_[i], raised[i]});
+        return out.size() - before;
+    }
+
+    // Alarmın ölçülen değeri (son evaluate()'e göre): irtifa hızı m/s, ivme
+    // m/s^2, yön farkı derece, irtifa farkı metre, durum değişiminde yeni
+    // durum.
+    double value(uint32_t slot, Rule rule, double dt) const
+    {
+        const std::size_t prev = (head_ + kWindow - 1) % kWindow;
+        const std::size_t oldest = (head_ + 1) % kWindow;
+        const double inv_dt = dt > 0.0 ? 1.0 / dt : 0.0;
+        switch (rule)
+        {
+        case kAltitudeJump:
+            return std::fabs(baro_[head_][slot] - baro_[prev][slot]) * inv_dt;
+        case kAcceleration:
+            return std::fabs(speed_[head_][slot] - speed_[prev][slot]) * inv_dt;
+        case kHeadingReversal:
+            return headingDelta(heading_[head_][slot], heading_[oldest][slot]);
+        case kAltitudeMismatch:
+            return std::fabs(baro_[head_][slot] - geo_[slot]);
+        case kStatusChange:
+            return status_[head_][slot];
+        }
+        return 0.0;
+    }
+
+    // Kuralın limiti, value() ile aynı birimde.
+    static double limit(Rule rule, const Params &p)
+    {
+        switch (rule)
+        {
+        case kAltitudeJump:
+            return p.max_climb_mps;
+        case kAcceleration:
+            return p.max_accel_mps2;
+        case kHeadingReversal:
+            return p.reversal_deg;
+        case kAltitudeMismatch:
+            return p.max_alt_mismatch_m;
+        case kStatusChange:
+            return 0.0;
+        }
+        return 0.0;
+    }
+
+    std::size_t size() const { return active_; }
+    std::size_t capacity() const { return alive_.size(); }
+
+private:
+    struct Limits
+    {
+        float alt_step;
+        float speed_step;
+        float reversal;
+        float mismatch;
+        uint8_t rules;
+    };
+
+    // [0, 360) yönler arasındaki en kısa açı; fmod/floor olmadan, vektörlenir.
+    static float headingDelta(float a, float b)
+    {
+        const float d = std::fabs(a - b);
+        return d < 360.0f - d ? d : 360.0f - d;
+    }
+
+    // Diziler __restrict: üye vector'leri üzerinden yazılan döngü, alias
+    // kontrolü yüzünden vektörlenmiyordu (bkz. TrackFilterBank::stepKernel).
+    static void evaluateKernel(std::size_t n, const Limits &lim,
+                               const float *__restrict baro, const float *__restrict baro_prev,
+                               const float *__restrict speed, const float *__restrict speed_prev,
+                               const float *__restrict heading, const float *__restrict heading_oldest,
+                               const uint8_t *__restrict status, const uint8_t *__restrict status_prev,
+                               const float *__restrict geo, const uint8_t *__restrict alive,
+                               uint8_t *__restrict count, uint8_t *__restrict last_mask,
+                               uint8_t *__restrict raised)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // Canlı slotta örnek sayısı; boş slotta 0 kalır.
+            const uint8_t c = static_cast<uint8_t>(alive[i] * (count[i] + (count[i] < kWindow)));
+            const uint8_t has_prev = c >= 2;
+            const uint8_t has_window = c >= kWindow;
+
+            const uint8_t jump = std::fabs(baro[i] - baro_prev[i]) > lim.alt_step;
+            const uint8_t accel = std::fabs(speed[i] - speed_prev[i]) > lim.speed_step;
+            const uint8_t reversal = headingDelta(heading[i], heading_oldest[i]) >= lim.reversal;
+            const uint8_t mismatch = std::fabs(baro[i] - geo[i]) > lim.mismatch;
+            const uint8_t changed = status[i] != status_prev[i];
+
+            const uint8_t mask = static_cast<uint8_t>(
+                (((jump | accel << 1) & (0u - has_prev)) | ((reversal << 2) & (0u - has_window)) |
+                 (mismatch << 3) | ((changed << 4) & (0u - has_prev))) &
+                lim.rules & (0u - (c != 0)));
+            raised[i] = static_cast<uint8_t>(mask & ~last_mask[i]);
+            last_mask[i] = mask;
+            count[i] = c;
+        }
+    }
+
+    std::array<std::vector<float> *, 3 * kWindow + 1> floatArrays()
+    {
+        std::array<std::vector<float> *, 3 * kWindow + 1> a{};
+        for (std::size_t k = 0; k < kWindow; ++k)
+        {
+            a[3 * k] = &baro_[k];
+            a[3 * k + 1] = &speed_[k];
+            a[3 * k + 2] = &heading_[k];
+        }
+        a[3 * kWindow] = &geo_;
+        return a;
+    }
+
+    std::array<std::vector<uint8_t> *, kWindow + 4> byteArrays()
+    {
+        std::array<std::vector<uint8_t> *, kWindow + 4> a{};
+        for (std::size_t k = 0; k < kWindow; ++k)
+            a[k] = &status_[k];
+        a[kWindow] = &alive_;
+        a[kWindow + 1] = &count_;
+        a[kWindow + 2] = &last_mask_;
+        a[kWindow + 3] = &raised_;
+        return a;
+    }
+
+    // Halka: [k][slot]; head_ son evaluate()'in örneğidir.
+    std::array<std::vector<float>, kWindow> baro_, speed_, heading_;
+    std::array<std::vector<uint8_t>, kWindow> status_;
+    std::vector<float> geo_; // sadece son örnek gerekir
+    std::vector<uint32_t> tag_;
+
+    std::vector<uint8_t> alive_;
+    std::vector<uint8_t> count_;
+    std::vector<uint8_t> last_mask_;
+    std::vector<uint8_t> raised_;
+
+    std::vector<uint32_t> free_;
+    std::size_t active_ = 0;
+    std::size_t head_ = 0;
+};
+
+#endif
@@ -0,0 +1,950 @@
+// radar servisinin sıcak yolları için Google Benchmark ölçümleri.
+// Mongo veya gRPC bağlantısı gerekmez; hedefler bellekte sentetik üretilir.
+//
+//   cmake -DRADAR_BUILD_BENCH=ON ... && ./radar_bench --benchmark_filter=Advance
+
+#include "heapcounter.h"
+#include "radarservice.h"
+
+#include <benchmark/benchmark.h>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/oid.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+// gRPC'siz writer: mesajı yeniden kullanılan tampona serileştirir.
+class NullRadarWriter final : public grpc::ServerWriterInterface<radar::RadarTarget>
+{
+public:
+    void SendInitialMetadata() override {}
+    bool Write(const radar::RadarTarget &msg, grpc::WriteOptions) override
+    {
+        msg.SerializeToString(&wire_);
+        bytes_ += wire_.size();
+        return true;
+    }
+    using grpc::ServerWriterInterface<radar::RadarTarget>::Write;
+
+    uint64_t bytes() const { return bytes_; }
+
+private:
+    std::string wire_;
+    uint64_t bytes_ = 0;
+};
+
+// Görünüm aboneliği için aynı işi yapan writer; Read kullanılmaz.
+class NullViewportStream final : public grpc::ServerReaderWriterInterface<radar::TargetEvent, radar::Viewport>
+{
+public:
+    void SendInitialMetadata() override {}
+    bool NextMessageSize(uint32_t *sz) override
+    {
+        *sz = 0;
+        return false;
+    }
+    bool Read(radar::Viewport *) override { return false; }
+    bool Write(const radar::TargetEvent &msg, grpc::WriteOptions) override
+    {
+        msg.SerializeToString(&wire_);
+        bytes_ += wire_.size();
+        ++events_;
+        return true;
+    }
+    using grpc::ServerReaderWriterInterface<radar::TargetEvent, radar::Viewport>::Write;
+
+    uint64_t bytes() const { return bytes_; }
+    uint64_t events() const { return events_; }
+
+private:
+    std::string wire_;
+    uint64_t bytes_ = 0;
+    uint64_t events_ = 0;
+};
+
+// Tahmin stream'i için aynı işi yapan writer.
+class NullPredictionWriter final : public grpc::ServerWriterInterface<radar::TargetPrediction>
+{
+public:
+    void SendInitialMetadata() override {}
+    bool Write(const radar::TargetPrediction &msg, grpc::WriteOptions) override
+    {
+        msg.SerializeToString(&wire_);
+        bytes_ += wire_.size();
+        return true;
+    }
+    using grpc::ServerWriterInterface<radar::TargetPrediction>::Write;
+
+    uint64_t bytes() const { return bytes_; }
+
+private:
+    std::string wire_;
+    uint64_t bytes_ = 0;
+};
+
+struct RadarBenchAccess
+{
+    using MovingTarget = RadarServiceImpl::MovingTarget;
+    using ReloadRow = RadarServiceImpl::ReloadRow;
+    using StreamState = RadarServiceImpl::StreamState;
+    using ViewportState = RadarServiceImpl::ViewportState;
+
+    static ObjectId makeOid(uint32_t n)
+    {
+        ObjectId id;
+        const uint32_t ts = 0x65000000u;
+        std::memcpy(id.bytes, &ts, 4);
+        std::memcpy(id.bytes + 8, &n, 4);
+        return id;
+    }
+
+    // first_id'den başlayan n adet Türkiye içi sentetik satır.
+    static std::vector<ReloadRow> makeRows(std::size_t n, uint32_t first_id = 0)
+    {
+        std::mt19937 rng(42 + first_id);
+        std::uniform_real_distribution<double> lat(36.5, 41.5);
+        std::uniform_real_distribution<double> lon(26.5, 44.5);
+        std::uniform_int_distribution<int32_t> vel(150, 900);
+        std::uniform_int_distribution<int32_t> alt(1000, 12000);
+
+        std::vector<ReloadRow> rows(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ReloadRow &r = rows[i];
+            r.id = makeOid(first_id + static_cast<uint32_t>(i));
+            r.lat = lat(rng);
+            r.lon = lon(rng);
+            r.velocity = vel(rng);
+            r.baro_altitude = alt(rng);
+            r.geo_altitude = r.baro_altitude + 150;
+        }
+        return rows;
+    }
+
+    static void populate(RadarServiceImpl &svc, std::size_t n)
+    {
+        svc.reload_rows_ = makeRows(n);
+        svc.applyReloadRows();
+    }
+
+    static std::vector<ReloadRow> &rows(RadarServiceImpl &svc) { return svc.reload_rows_; }
+    static void applyReloadRows(RadarServiceImpl &svc) { svc.applyReloadRows(); }
+    static void advanceTargets(RadarServiceImpl &svc, double dt) { svc.advanceTargets(dt, 0); }
+    // Tick frame'inin kopyalanıp ızgarasıyla yayınlanması (frame yedekten yeniden kullanılır).
+    static const std::vector<MovingTarget> &snapshotTargets(RadarServiceImpl &svc)
+    {
+        std::shared_ptr<RadarServiceImpl::TickFrame> frame;
+        {
+            std::lock_guard<std::mutex> lock(svc.targets_mutex_);
+            frame = svc.snapshotTargets(0, 0);
+        }
+        const RadarServiceImpl::TickFrame *published = frame.get();
+        svc.publishFrame(std::move(frame));
+        return published->targets;
+    }
+    static void toRadarTarget(const MovingTarget &t, int rank, radar::RadarTarget &out)
+    {
+        RadarServiceImpl::toRadarTarget(t, rank, out);
+    }
+
+    // Sunucu tick'i + tek client'ın o tick'i göndermesi.
+    static void sendRadarFile(RadarServiceImpl &svc, NullRadarWriter &writer, const radar::StreamRequest &req,
+                              StreamState &state)
+    {
+        svc.tick(1.0);
+        svc.sendRadarFile(&writer, &req, state);
+    }
+
+    static void sendViewportFrame(RadarServiceImpl &svc, NullViewportStream &stream, const radar::Viewport &vp,
+                                  StreamState &state, ViewportState &view)
+    {
+        svc.tick(1.0);
+        svc.sendViewportFrame(&stream, vp, true, state, view);
+    }
+
+    // Abone varmış gibi tick'in izdüşümünü hesaplayıp yayınlar (frame yedekten yeniden kullanılır).
+    static void predictTrajectories(RadarServiceImpl &svc, const TrajectoryPredictor::Params &params)
+    {
+        std::shared_ptr<TrajectoryPredictor::Frame> frame;
+        {
+            std::lock_guard<std::mutex> lock(svc.targets_mutex_);
+            frame = svc.predictTrajectories(0, params);
+        }
+        svc.publishPredictions(std::move(frame));
+    }
+
+    static std::shared_ptr<const TrajectoryPredictor::Frame> predictions(RadarServiceImpl &svc)
+    {
+        return svc.predictions_;
+    }
+
+    static bool sendPredictions(RadarServiceImpl &svc, NullPredictionWriter &writer,
+                                const radar::PredictionRequest &req, FrameArena &arena, uint64_t &seq)
+    {
+        std::shared_ptr<const TrajectoryPredictor::Frame> frame = svc.predictions_;
+        return frame && RadarServiceImpl::sendPredictionFrame(&writer, req, {}, *frame, arena, seq);
+    }
+
+    static bool parseDoc(const bsoncxx::document::view &doc, TrackRecord &rec)
+    {
+        if (!parse_track_document(doc, TrackSchema::radar(), 0, rec))
+            return false;
+        static const OperatingArea area;
+        return area.contains(rec.lat, rec.lon);
+    }
+};
+
+using A = RadarBenchAccess;
+
+static void TargetCounts(benchmark::internal::Benchmark *b)
+{
+    b->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+}
+
+// Sunucu tick'inin hareket güncellemesi ve değerlendirmeleri (kilit ve frame kopyası dahil).
+static void BM_AdvanceTargets(benchmark::State &state)
+{
+    RadarServiceImpl svc;
+    A::populate(svc, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        A::advanceTargets(svc, 1.0);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AdvanceTargets)->Apply(TargetCounts);
+
+// Kalman iz filtresinin tek SoA adımı (tahmin + güncelleme), kilitsiz.
+static void BM_TrackFilterStep(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const TrackFilterBank::Params params;
+    TrackFilterBank bank;
+    bank.reserve(n);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> lat(36.5, 41.5), lon(26.5, 44.5), jitter(-0.001, 0.001);
+    std::vector<uint32_t> slots(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double la = lat(rng), lo = lon(rng);
+        slots[i] = bank.add(la, lo, params);
+        bank.measure(slots[i], la + jitter(rng), lo + jitter(rng));
+    }
+
+    for (auto _ : state)
+        bank.step(1.0, params);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TrackFilterStep)->Apply(TargetCounts);
+
+// Anomali kurallarının tek SoA değerlendirmesi + yeni alarm taraması,
+// kilitsiz. Hedeflerin ~%0.1'i her tick'te yön çevirir.
+static void BM_AnomalyEvaluate(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const AnomalyDetector::Params params;
+    AnomalyDetector detector;
+    detector.reserve(n);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<uint32_t> slots(n);
+    std::vector<double> heading(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        slots[i] = detector.add();
+        heading[i] = 360.0 * unit(rng);
+    }
+
+    std::vector<AnomalyDetector::Alert> alerts;
+    std::size_t total = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            heading[i] = std::fmod(heading[i] + (unit(rng) < 0.001 ? 180.0 : 4.0 * unit(rng) - 2.0) + 360.0, 360.0);
+            detector.measure(slots[i], static_cast<uint32_t>(i), 8000.0 + 100.0 * unit(rng), 8100.0,
+                             400.0 + 10.0 * unit(rng), heading[i], 1);
+        }
+        alerts.clear();
+        state.ResumeTiming();
+        total += detector.evaluate(1.0, params, alerts);
+    }
+    state.counters["alerts_per_tick"] = static_cast<double>(total) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AnomalyEvaluate)->Apply(TargetCounts);
+
+// Türkiye kutusuna dağılmış 1000 sentetik poligon (12 köşeli, ~0.1-0.5
+// derece) üzerinde tick başına üyelik + giriş/çıkış farkı. Hedefler her
+// tick küçük bir adım atar; poligon sınırını geçenler olay üretir.
+static void BM_GeofenceEvaluate(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<GeoPolygon> polygons(1000);
+    for (std::size_t p = 0; p < polygons.size(); ++p)
+    {
+        const double clat = 36.0 + 6.0 * unit(rng), clon = 26.0 + 19.0 * unit(rng);
+        std::vector<std::pair<double, double>> ring;
+        for (int k = 0; k <= 12; ++k)
+        {
+            const double a = 2.0 * M_PI * (k % 12) / 12.0, r = 0.1 + 0.4 * unit(rng);
+            ring.emplace_back(clon + r * std::cos(a), clat + r * std::sin(a));
+        }
+        polygons[p].id = "P" + std::to_string(p);
+        polygons[p].rings.push_back(std::move(ring));
+    }
+    GeofenceIndex index;
+    index.build(std::move(polygons));
+
+    GeofenceTracker tracker;
+    tracker.reserve(n);
+    std::vector<uint32_t> slots(n);
+    std::vector<double> lat(n), lon(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        slots[i] = tracker.add();
+        lat[i] = 36.0 + 6.0 * unit(rng);
+        lon[i] = 26.0 + 19.0 * unit(rng);
+    }
+
+    std::vector<GeofenceTracker::Event> events;
+    std::size_t total = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            lat[i] += 0.004 * unit(rng) - 0.002;
+            lon[i] += 0.004 * unit(rng) - 0.002;
+            tracker.measure(slots[i], static_cast<uint32_t>(i), lat[i], lon[i]);
+        }
+        events.clear();
+        state.ResumeTiming();
+        total += tracker.evaluate(index, events);
+    }
+    state.counters["polygons"] = static_cast<double>(index.size());
+    state.counters["memberships"] = static_cast<double>(tracker.memberships());
+    state.counters["events_per_tick"] = static_cast<double>(total) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GeofenceEvaluate)->Apply(TargetCounts)->Unit(benchmark::kMillisecond);
+
+// Kayıt başına işletim alanı testi: 0 = sabit kutu, 1 = kıyı şeridi gibi
+// girintili 2000 köşeli poligon + delik (raster maske + sınır hücresinde
+// kesin test). Noktalar kutunun biraz dışına taşan düzgün dağılım.
+// mismatched, ölçüm dışı 4M ayrı noktada contains() ile maskesiz exact()'in
+// farklı sonuç verdiği nokta sayısıdır; 0 değilse ölçüm hatayla biter.
+static void BM_OperatingAreaContains(benchmark::State &state)
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    OperatingArea area;
+    if (state.range(0) == 1)
+    {
+        GeoPolygon p;
+        std::vector<std::pair<double, double>> outer, hole;
+        for (int k = 0; k < 2000; ++k)
+        {
+            const double a = 2.0 * M_PI * k / 2000.0, r = 1.0 + 0.3 * std::sin(7.0 * a) + 0.05 * unit(rng);
+            outer.emplace_back(35.5 + 9.0 * r * std::cos(a), 39.0 + 3.0 * r * std::sin(a));
+        }
+        for (int k = 0; k < 50; ++k)
+        {
+            const double a = -2.0 * M_PI * k / 50.0;
+            hole.emplace_back(35.0 + std::cos(a), 39.0 + 0.5 * std::sin(a));
+        }
+        p.rings = {std::move(outer), std::move(hole)};
+        std::vector<GeoPolygon> polygons;
+        polygons.push_back(std::move(p));
+        area.build(std::move(polygons));
+    }
+
+    const std::size_t n = 1 << 20;
+    std::vector<double> lat(n), lon(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        lat[i] = 35.0 + 8.0 * unit(rng);
+        lon[i] = 25.0 + 21.0 * unit(rng);
+    }
+    std::size_t inside = 0;
+    for (auto _ : state)
+    {
+        inside = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            inside += area.contains(lat[i], lon[i]);
+        benchmark::DoNotOptimize(inside);
+    }
+
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < 4 * n; ++i)
+    {
+        const double la = 35.0 + 8.0 * unit(rng), lo = 25.0 + 21.0 * unit(rng);
+        mismatched += area.contains(la, lo) != area.exact(la, lo);
+    }
+    state.counters["mismatched"] = static_cast<double>(mismatched);
+    state.counters["inside_pct"] = 100.0 * static_cast<double>(inside) / static_cast<double>(n);
+    state.counters["border_cells"] = static_cast<double>(area.borderCells());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    if (mismatched != 0)
+        state.SkipWithError("contains() maskesiz exact() ile uyuşmuyor");
+}
+BENCHMARK(BM_OperatingAreaContains)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Kaba kuvvet referansı: dikey ayrımı sağlamayan tüm çiftlerin (irtifaya
+// göre sıralı süpürme) CPA'sı ConflictDetector'la aynı düzlem yaklaşımıyla
+// hesaplanır. Dönüş: (i << 32 | j), i < j, sıralı.
+static std::vector<uint64_t> brute_conflicts(const std::vector<double> &lat, const std::vector<double> &lon,
+                                             const std::vector<double> &alt, const std::vector<double> &ve,
+                                             const std::vector<double> &vn, const ConflictDetector::Params &p)
+{
+    const double m_per_deg = 111195.0;
+    std::vector<uint32_t> order(lat.size());
+    for (uint32_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&alt](uint32_t a, uint32_t b) { return alt[a] < alt[b]; });
+
+    std::vector<uint64_t> pairs;
+    for (std::size_t x = 0; x < order.size(); ++x)
+    {
+        const uint32_t a = order[x];
+        for (std::size_t y = x + 1; y < order.size() && alt[order[y]] - alt[a] < p.vertical_m; ++y)
+        {
+            const uint32_t b = order[y];
+            const double ca = std::max(1e-6, std::cos(lat[a] * (M_PI / 180.0)));
+            const double cb = std::max(1e-6, std::cos(lat[b] * (M_PI / 180.0)));
+            const double mx = m_per_deg * 0.5 * (ca + cb);
+            const double dx = (lon[b] - lon[a]) * mx, dy = (lat[b] - lat[a]) * m_per_deg;
+            const double wx = ve[b] - ve[a], wy = vn[b] - vn[a];
+            const double w2 = wx * wx + wy * wy;
+            const double t = w2 > 0.0 ? std::clamp(-(dx * wx + dy * wy) / w2, 0.0, p.lookahead_s) : 0.0;
+            const double cx = dx + wx * t, cy = dy + wy * t;
+            if (std::sqrt(cx * cx + cy * cy) < p.horizontal_m)
+                pairs.push_back(a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a);
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+// Tick başına çatışma tespiti: hedefler Türkiye kutusuna düzgün dağılmış,
+// 1-12 km irtifa, 150-400 m/s rastgele yön; varsayılan eşikler (5 NM,
+// 300 m, 120 s). İkinci argüman iş parçacığı sayısı. mismatched, olaylardan
+// kurulan çatışan çift kümesi ile son tick'in kaba kuvvet sonucu arasındaki
+// farklı çift sayısıdır; 0 değilse ölçüm hatayla biter.
+static void BM_ConflictEvaluate(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    ConflictDetector::Params params;
+    params.horizontal_m = 9260.0;
+    params.threads = static_cast<unsigned>(state.range(1));
+    ConflictDetector detector;
+    detector.reserve(n);
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<uint32_t> slots(n);
+    std::vector<double> lat(n), lon(n), alt(n), ve(n), vn(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        slots[i] = detector.add();
+        lat[i] = 36.0 + 6.0 * unit(rng);
+        lon[i] = 26.0 + 19.0 * unit(rng);
+        alt[i] = 1000.0 + 11000.0 * unit(rng);
+        const double v = 150.0 + 250.0 * unit(rng), h = 2.0 * M_PI * unit(rng);
+        ve[i] = v * std::cos(h);
+        vn[i] = v * std::sin(h);
+    }
+
+    std::vector<ConflictDetector::Conflict> events;
+    std::set<uint64_t> active;
+    auto apply = [&]
+    {
+        for (const ConflictDetector::Conflict &c : events)
+        {
+            const uint64_t key = c.tag_a < c.tag_b ? (static_cast<uint64_t>(c.tag_a) << 32) | c.tag_b
+                                                   : (static_cast<uint64_t>(c.tag_b) << 32) | c.tag_a;
+            if (c.start)
+                active.insert(key);
+            else
+                active.erase(key);
+        }
+    };
+    std::size_t total = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        apply();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            lat[i] += vn[i] / 111195.0;
+            lon[i] += ve[i] / 111195.0 / std::cos(lat[i] * M_PI / 180.0);
+            detector.measure(slots[i], static_cast<uint32_t>(i), lat[i], lon[i], alt[i], ve[i], vn[i]);
+        }
+        events.clear();
+        state.ResumeTiming();
+        total += detector.evaluate(params, events);
+    }
+    apply();
+    const std::vector<uint64_t> expected = brute_conflicts(lat, lon, alt, ve, vn, params);
+    std::vector<uint64_t> diff;
+    std::set_symmetric_difference(active.begin(), active.end(), expected.begin(), expected.end(),
+                                  std::back_inserter(diff));
+    state.counters["mismatched"] = static_cast<double>(diff.size());
+    state.counters["active"] = static_cast<double>(detector.active());
+    state.counters["pair_tests"] = static_cast<double>(detector.pairTests());
+    state.counters["events_per_tick"] = static_cast<double>(total) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    if (!diff.empty())
+        state.SkipWithError("çatışan çiftler kaba kuvvet sonucundan farklı");
+}
+BENCHMARK(BM_ConflictEvaluate)
+    ->Args({10000, 1})
+    ->Args({100000, 1})
+    ->Args({100000, 8})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Frame'deki noktaların ince adımlı (1 ms, orta nokta) sayısal
+// integrasyona göre en büyük konum hatası (metre). Aynı yerel düzlemde
+// (başlangıç enleminde derece/metre) hız vektörü omega ile döndürülür;
+// düz ve dönüş modelleri birlikte, hedeflerden eşit aralıklı samples tanesi.
+static double prediction_max_err_m(const TrajectoryPredictor::Frame &f, uint32_t samples)
+{
+    const double deg = M_PI / 180.0, m_per_deg = 6371008.8 * deg, h = 1e-3;
+    const int sub = static_cast<int>(f.step_s / h + 0.5);
+    double max_err = 0.0;
+    for (uint32_t s = 0; s < samples && f.count > 0; ++s)
+    {
+        const uint32_t i = static_cast<uint32_t>(static_cast<uint64_t>(s) * f.count / samples);
+        const double m_lon = m_per_deg * std::max(std::cos(f.lat[i] * deg), 0.01);
+        const double a = f.turn_rate_dps[i] * deg * h;
+        const double c = std::cos(a), sn = std::sin(a), ch = std::cos(a / 2), sh = std::sin(a / 2);
+        double x = 0.0, y = 0.0, vx = f.vel_east[i], vy = f.vel_north[i];
+        for (uint32_t k = 0; k < f.steps; ++k)
+        {
+            for (int j = 0; j < sub; ++j)
+            {
+                x += (ch * vx - sh * vy) * h;
+                y += (sh * vx + ch * vy) * h;
+                const double nx = c * vx - sn * vy;
+                vy = sn * vx + c * vy;
+                vx = nx;
+            }
+            const double ex = (f.turnLon(k, i) - f.lon[i]) * m_lon - x;
+            const double ey = (f.turnLat(k, i) - f.lat[i]) * m_per_deg - y;
+            const double lx = (f.lineLon(k, i) - f.lon[i]) * m_lon - f.vel_east[i] * f.offset(k);
+            const double ly = (f.lineLat(k, i) - f.lat[i]) * m_per_deg - f.vel_north[i] * f.offset(k);
+            max_err = std::max({max_err, std::sqrt(ex * ex + ey * ey), std::sqrt(lx * lx + ly * ly)});
+        }
+    }
+    return max_err;
+}
+
+// Tick başına izdüşüm: filtre tahminlerinin toplanması + düz/dönüş adım
+// döngüleri (varsayılan 10 s adım, 120 s ufuk: hedef başına 12 x 2 nokta).
+// max_err_m, 200 hedefin noktalarının sayısal integrasyona göre en büyük
+// hatasıdır; float saklama santimetre mertebesindedir, 0.1 m'yi aşarsa ölçüm
+// hatayla biter.
+static void BM_PredictTrajectories(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc;
+    A::populate(svc, n);
+    // Filtre hız ve dönüş tahminleri otursun.
+    for (int i = 0; i < 5; ++i)
+        A::advanceTargets(svc, 1.0);
+
+    const TrajectoryPredictor::Params params;
+    A::predictTrajectories(svc, params);
+    for (auto _ : state)
+        A::predictTrajectories(svc, params);
+    const double max_err = prediction_max_err_m(*A::predictions(svc), 200);
+    state.counters["max_err_m"] = max_err;
+    state.counters["points"] = static_cast<double>(n * 2 * TrajectoryPredictor::steps(params));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    if (max_err > 0.1)
+        state.SkipWithError("izdüşüm sayısal integrasyondan 0.1 m'den fazla sapıyor");
+}
+BENCHMARK(BM_PredictTrajectories)->Apply(TargetCounts);
+
+// Paylaşılan frame'den tek client'ın tüm hedefler için mesaj kurması +
+// serileştirme; frame hesabı ölçüme girmez.
+static void BM_SendPredictions(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc;
+    A::populate(svc, n);
+    for (int i = 0; i < 5; ++i)
+        A::advanceTargets(svc, 1.0);
+    A::predictTrajectories(svc, TrajectoryPredictor::Params());
+
+    radar::PredictionRequest req;
+    NullPredictionWriter writer;
+    FrameArena arena;
+    uint64_t seq = 0;
+    for (auto _ : state)
+        A::sendPredictions(svc, writer, req, arena, seq);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(writer.bytes()));
+}
+BENCHMARK(BM_SendPredictions)->Apply(TargetCounts);
+
+// Filtre doğruluğu: dönen (CT) gerçek yörünge + σ=50 m ölçüm gürültüsü;
+// ilk 20 adım ısınma sayılıp ham ölçüm ve tahmin RMS hatası raporlanır.
+static void BM_TrackFilterAccuracy(benchmark::State &state)
+{
+    constexpr std::size_t kTracks = 1000;
+    constexpr int kSteps = 120;
+    constexpr double kMetersPerDeg = 111195.08;
+    const TrackFilterBank::Params params;
+    double rms_raw = 0.0, rms_filtered = 0.0;
+
+    for (auto _ : state)
+    {
+        std::mt19937 rng(11);
+        std::normal_distribution<double> noise(0.0, params.meas_sigma_m);
+        std::uniform_real_distribution<double> heading(0.0, 2.0 * M_PI), turn(-3.0, 3.0), speed(150.0, 300.0);
+        TrackFilterBank bank;
+        std::vector<double> tx(kTracks, 0.0), ty(kTracks, 0.0), hd(kTracks), w(kTracks), v(kTracks);
+        std::vector<uint32_t> slots(kTracks);
+        const double lat0 = 39.0, lon0 = 35.0, cos0 = std::cos(lat0 * M_PI / 180.0);
+        for (std::size_t i = 0; i < kTracks; ++i)
+        {
+            hd[i] = heading(rng);
+            w[i] = turn(rng) * M_PI / 180.0;
+            v[i] = speed(rng);
+            slots[i] = bank.add(lat0, lon0, params);
+        }
+
+        double sum_raw = 0.0, sum_filtered = 0.0;
+        std::size_t samples = 0;
+        std::vector<double> zx(kTracks), zy(kTracks);
+        for (int k = 0; k < kSteps; ++k)
+        {
+            for (std::size_t i = 0; i < kTracks; ++i)
+            {
+                hd[i] += w[i];
+                tx[i] += v[i] * std::cos(hd[i]);
+                ty[i] += v[i] * std::sin(hd[i]);
+                zx[i] = tx[i] + noise(rng);
+                zy[i] = ty[i] + noise(rng);
+                bank.measure(slots[i], lat0 + zy[i] / kMetersPerDeg, lon0 + zx[i] / (kMetersPerDeg * cos0));
+            }
+            bank.step(1.0, params);
+            if (k < 20)
+                continue;
+            for (std::size_t i = 0; i < kTracks; ++i)
+            {
+                const TrackFilterBank::Estimate e = bank.estimate(slots[i]);
+                const double ex = (e.lon - lon0) * kMetersPerDeg * cos0 - tx[i];
+                const double ey = (e.lat - lat0) * kMetersPerDeg - ty[i];
+                sum_filtered += ex * ex + ey * ey;
+                sum_raw += (zx[i] - tx[i]) * (zx[i] - tx[i]) + (zy[i] - ty[i]) * (zy[i] - ty[i]);
+                ++samples;
+            }
+        }
+        rms_raw = std::sqrt(sum_raw / static_cast<double>(samples));
+        rms_filtered = std::sqrt(sum_filtered / static_cast<double>(samples));
+    }
+    state.counters["rms_raw_m"] = rms_raw;
+    state.counters["rms_filtered_m"] = rms_filtered;
+}
+BENCHMARK(BM_TrackFilterAccuracy)->Unit(benchmark::kMillisecond);
+
+// Her sunucu tick'inde bir kez alınan frame kopyası (hedefler + tahminler).
+static void BM_SnapshotTargets(benchmark::State &state)
+{
+    RadarServiceImpl svc;
+    A::populate(svc, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const std::vector<A::MovingTarget> &snapshot = A::snapshotTargets(svc);
+        benchmark::DoNotOptimize(snapshot.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(A::MovingTarget)));
+}
+BENCHMARK(BM_SnapshotTargets)->Apply(TargetCounts);
+
+// RadarTarget doldurma (ID biçimlendirme dahil) + wire serileştirme.
+static void BM_SerializeRadarTargets(benchmark::State &state)
+{
+    RadarServiceImpl svc;
+    A::populate(svc, static_cast<std::size_t>(state.range(0)));
+    const std::vector<A::MovingTarget> &snapshot = A::snapshotTargets(svc);
+
+    std::string wire;
+    int64_t bytes = 0;
+    for (auto _ : state)
+    {
+        int rank = 0;
+        for (const A::MovingTarget &t : snapshot)
+        {
+            radar::RadarTarget out;
+            A::toRadarTarget(t, ++rank, out);
+            out.SerializeToString(&wire);
+            bytes += static_cast<int64_t>(wire.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_SerializeRadarTargets)->Apply(TargetCounts);
+
+// EPSG:3857 projeksiyonu: client'taki fromLonLat'ın karşılığı olan tekil
+// std::log/std::tan ile toplu polinom geçişi. Noktalar tüm geçerli enlem
+// aralığına yayılır; max_err_m toplu geçişin referansa göre en büyük hatası.
+static void mercator_points(std::size_t n, std::vector<double> &lat, std::vector<double> &lon)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dlat(-kWebMercatorMaxLat, kWebMercatorMaxLat);
+    std::uniform_real_distribution<double> dlon(-180.0, 180.0);
+    lat.resize(n);
+    lon.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        lat[i] = dlat(rng);
+        lon[i] = dlon(rng);
+    }
+}
+
+static void BM_MercatorScalar(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::vector<double> lat, lon, x(n), y(n);
+    mercator_points(n, lat, lon);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            web_mercator_project(lat[i], lon[i], x[i], y[i]);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MercatorScalar)->Apply(TargetCounts);
+
+static void BM_MercatorBatch(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::vector<double> lat, lon, x(n), y(n);
+    mercator_points(n, lat, lon);
+    for (auto _ : state)
+    {
+        web_mercator_project_batch(lat.data(), lon.data(), n, x.data(), y.data());
+        benchmark::DoNotOptimize(y.data());
+    }
+
+    double max_err = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double rx, ry;
+        web_mercator_project(lat[i], lon[i], rx, ry);
+        max_err = std::max({max_err, std::fabs(rx - x[i]), std::fabs(ry - y[i])});
+    }
+    state.counters["max_err_m"] = max_err;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MercatorBatch)->Apply(TargetCounts);
+
+// MongoTrackSource / FileTrackSource'taki BSON ayrıştırması.
+static void BM_ParseBsonDocuments(benchmark::State &state)
+{
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    const auto rows = A::makeRows(static_cast<std::size_t>(state.range(0)));
+    std::vector<bsoncxx::document::value> docs;
+    docs.reserve(rows.size());
+    for (const auto &r : rows)
+    {
+        docs.push_back(make_document(
+            kvp("_id", bsoncxx::oid(reinterpret_cast<const char *>(r.id.bytes), sizeof(r.id.bytes))),
+            kvp("lat", r.lat),
+            kvp("lon", r.lon),
+            kvp("velocity", r.velocity),
+            kvp("baroAltitude", r.baro_altitude),
+            kvp("geoAltitude", r.geo_altitude)));
+    }
+
+    for (auto _ : state)
+    {
+        std::size_t accepted = 0;
+        TrackRecord rec;
+        for (const auto &doc : docs)
+            accepted += A::parseDoc(doc.view(), rec) ? 1 : 0;
+        benchmark::DoNotOptimize(accepted);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParseBsonDocuments)->Apply(TargetCounts);
+
+// loadRadarData uzlaştırması: her reload'da hedeflerin %1'i değişir.
+static void BM_ReloadReconcile(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    const std::size_t churn = n / 100 > 0 ? n / 100 : 1;
+
+    RadarServiceImpl svc;
+    A::populate(svc, n);
+
+    std::vector<A::ReloadRow> a = A::makeRows(n);
+    std::vector<A::ReloadRow> b = a;
+    const auto fresh = A::makeRows(churn, static_cast<uint32_t>(n));
+    std::copy(fresh.begin(), fresh.end(), b.begin());
+
+    bool flip = false;
+    for (auto _ : state)
+    {
+        A::rows(svc).swap(flip ? a : b);
+        A::applyReloadRows(svc);
+        A::rows(svc).swap(flip ? a : b);
+        flip = !flip;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReloadReconcile)->Apply(TargetCounts);
+
+// Mongo'suz tam reload yolu: MemoryTrackSource → bbox filtresi → uzlaştırma.
+static void BM_LoadFromMemorySource(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc(std::make_unique<MemoryTrackSource>(make_synthetic_tracks(n)));
+    for (auto _ : state)
+        svc.loadRadarData();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadFromMemorySource)->Apply(TargetCounts);
+
+// Tam tick (sunucu tick'i + tek client'ın arena'da mesaj kurması + serileştirme).
+// allocs_per_tick ısınmadan sonraki tick başına heap ayırma sayısıdır; bütçe
+// 0'dır, aşılırsa ölçüm hatayla biter.
+static void BM_SendTick(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc(std::make_unique<MemoryTrackSource>(make_synthetic_tracks(n)));
+    RadarSettings settings;
+    settings.reload_period_s = 3600; // reload ölçüme girmesin
+    svc.configure(settings);
+
+    radar::StreamRequest req;
+    req.set_refresh_interval_ms(1000);
+    NullRadarWriter writer;
+    A::StreamState stream;
+
+    // İlk tick'ler yükleme yapar ve arena/snapshot tamponlarını büyütür.
+    A::sendRadarFile(svc, writer, req, stream);
+    A::sendRadarFile(svc, writer, req, stream);
+
+    const uint64_t allocs_before = heap_allocs();
+    for (auto _ : state)
+        A::sendRadarFile(svc, writer, req, stream);
+    const uint64_t allocs = heap_allocs() - allocs_before;
+
+    state.counters["allocs_per_tick"] = benchmark::Counter(static_cast<double>(allocs), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(writer.bytes()));
+    if (allocs != 0)
+        state.SkipWithError("ısınmadan sonra tick başına heap ayırma bütçesi 0");
+}
+BENCHMARK(BM_SendTick)->Apply(TargetCounts);
+
+// Görünüm aboneliği tick'i. Arg 1: 0 = tüm Türkiye, 1 = tek şehir (Ankara,
+// ~0.5° x 0.7°). events_per_tick tam stream'in hedef sayısıyla karşılaştırılır.
+// allocs_per_tick bütçesi BM_SendTick'teki gibi 0'dır.
+static void BM_ViewportFrame(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc(std::make_unique<MemoryTrackSource>(make_synthetic_tracks(n)));
+    RadarSettings settings;
+    settings.reload_period_s = 3600;
+    svc.configure(settings);
+
+    radar::Viewport vp;
+    if (state.range(1) == 0)
+    {
+        vp.set_min_lat(36.0);
+        vp.set_max_lat(42.0);
+        vp.set_min_lon(26.0);
+        vp.set_max_lon(45.0);
+    }
+    else
+    {
+        vp.set_min_lat(39.65);
+        vp.set_max_lat(40.15);
+        vp.set_min_lon(32.45);
+        vp.set_max_lon(33.15);
+    }
+    vp.set_refresh_interval_ms(1000);
+    vp.set_cluster(radar::CLUSTER_OFF);
+
+    NullViewportStream stream;
+    A::StreamState st;
+    A::ViewportState view;
+    A::sendViewportFrame(svc, stream, vp, st, view);
+    A::sendViewportFrame(svc, stream, vp, st, view);
+
+    const uint64_t events_before = stream.events();
+    const uint64_t bytes_before = stream.bytes();
+    const uint64_t allocs_before = heap_allocs();
+    for (auto _ : state)
+        A::sendViewportFrame(svc, stream, vp, st, view);
+    const uint64_t allocs = heap_allocs() - allocs_before;
+
+    state.counters["events_per_tick"] =
+        benchmark::Counter(static_cast<double>(stream.events() - events_before), benchmark::Counter::kAvgIterations);
+    state.counters["allocs_per_tick"] = benchmark::Counter(static_cast<double>(allocs), benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(static_cast<int64_t>(stream.bytes() - bytes_before));
+    if (allocs != 0)
+        state.SkipWithError("ısınmadan sonra tick başına heap ayırma bütçesi 0");
+}
+BENCHMARK(BM_ViewportFrame)
+    ->ArgsProduct({{10000, 100000}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Tüm Türkiye görünümünün kümelenmiş tick'i; Arg 1 zoom seviyesidir.
+// events_per_tick BM_ViewportFrame/<n>/0 ile karşılaştırılır.
+static void BM_ClusterFrame(benchmark::State &state)
+{
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    RadarServiceImpl svc(std::make_unique<MemoryTrackSource>(make_synthetic_tracks(n)));
+    RadarSettings settings;
+    settings.reload_period_s = 3600;
+    svc.configure(settings);
+
+    radar::Viewport vp;
+    vp.set_min_lat(36.0);
+    vp.set_max_lat(42.0);
+    vp.set_min_lon(26.0);
+    vp.set_max_lon(45.0);
+    vp.set_zoom(static_cast<int32_t>(state.range(1)));
+    vp.set_refresh_interval_ms(1000);
+    vp.set_cluster(radar::CLUSTER_ON);
+
+    NullViewportStream stream;
+    A::StreamState st;
+    A::ViewportState view;
+    A::sendViewportFrame(svc, stream, vp, st, view);
+    A::sendViewportFrame(svc, stream, vp, st, view);
+
+    const uint64_t events_before = stream.events();
+    const uint64_t bytes_before = stream.bytes();
+    for (auto _ : state)
+        A::sendViewportFrame(svc, stream, vp, st, view);
+
+    state.counters["events_per_tick"] =
+        benchmark::Counter(static_cast<double>(stream.events() - events_before), benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(static_cast<int64_t>(stream.bytes() - bytes_before));
+}
+BENCHMARK(BM_ClusterFrame)
+    ->ArgsProduct({{10000, 100000}, {5, 7}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
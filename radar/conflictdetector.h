@@ -0,0 +1,456 @@
+#ifndef CONFLICTDETECTOR_H
+#define CONFLICTDETECTOR_H
+
+#include "workerpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Hedef çiftleri arası yakınlaşma (closest point of approach) çatışma
+// tespiti (SoA).
+//
+// Her hedef için bakış süresi (lookahead) boyunca süpürdüğü yatay kutu,
+// yatay ayrımın yarısı kadar genişletilerek düzgün bir ızgaraya (spatial
+// hash, CSR) yazılır; irtifası da [alt - V/2, alt + V/2] aralığının
+// düştüğü irtifa bantlarıyla ifade edilir. İki hedef ancak kutuları ve
+// bantları örtüşürse aday çifttir: her hücrenin kayıtları alt banda göre
+// sıralanıp süpürülür, çift sadece kutularının kesişiminin sol alt
+// köşesinin düştüğü hücrede bir kez sınanır. Aday çift için mevcut hız ve
+// yönden CPA zamanı ve mesafesi hesaplanır. Hücreler tick'ler arasında
+// yaşayan iş parçacıklarına (WorkerPool) dinamik olarak dağıtılır.
+//
+// Olaylar kenar tetiklidir: çift çatışmaya girdiği tick'te START, çıktığı
+// tick'te END verilir. Slotu boşalan (reload'da kaldırılan) hedefin açık
+// çiftleri için sonraki evaluate()'te, hedefin son bilinen tag ve
+// konumuyla END verilir.
+class ConflictDetector
+{
+public:
+    static constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+
+    struct Params
+    {
+        double horizontal_m = 0.0;    // yatay ayrım (5 NM = 9260); <= 0 kapalı
+        double vertical_m = 300.0;    // dikey ayrım (~1000 ft)
+        double lookahead_s = 120.0;   // CPA en fazla bu kadar ileride aranır
+        unsigned threads = 0;         // 0 = donanım, en fazla 8
+    };
+
+    struct Conflict
+    {
+        uint32_t slot_a, slot_b; // slot_a < slot_b
+        uint32_t tag_a, tag_b;   // measure()'da verilen değerler
+        bool start;              // false: çatışma bitti
+        double tcpa_s;           // [0, lookahead]
+        double dcpa_m;
+        double range_m; // şimdiki yatay mesafe
+        double vertical_m;
+        double lat_a, lon_a, lat_b, lon_b; // kaldırılan hedefte son bilinen konum
+    };
+
+    void reserve(std::size_t n)
+    {
+        for (std::vector<double> *v : {&lat_, &lon_, &alt_, &ve_, &vn_})
+            v->reserve(n);
+        tag_.reserve(n);
+        alive_.reserve(n);
+        dropped_.reserve(n);
+        gone_tag_.reserve(n);
+        gone_kin_.reserve(n);
+    }
+
+    uint32_t add()
+    {
+        uint32_t slot;
+        if (!free_.empty())
+        {
+            slot = free_.back();
+            free_.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(alive_.size());
+            for (std::vector<double> *v : {&lat_, &lon_, &alt_, &ve_, &vn_})
+                v->push_back(0.0);
+            tag_.push_back(0);
+            alive_.push_back(0);
+            dropped_.push_back(0);
+            gone_tag_.push_back(0);
+            gone_kin_.push_back(Kin{});
+        }
+        alive_[slot] = 1;
+        return slot;
+    }
+
+    void remove(uint32_t slot)
+    {
+        if (slot == kNoSlot || slot >= alive_.size())
+            return;
+        alive_[slot] = 0;
+        // Slot aynı reload'da yeni hedefe verilebilir; açık çiftlerin END
+        // olayı için kaldırılan hedefin son değerleri saklanır.
+        if (!dropped_[slot])
+        {
+            gone_tag_[slot] = tag_[slot];
+            gone_kin_[slot] = kinematics(slot);
+        }
+        dropped_[slot] = 1;
+        free_.push_back(slot);
+    }
+
+    // Hız bileşenleri m/s (doğu, kuzey); irtifa metre.
+    void measure(uint32_t slot, uint32_t tag, double lat, double lon, double alt, double v_east, double v_north)
+    {
+        if (slot == kNoSlot)
+            return;
+        lat_[slot] = lat;
+        lon_[slot] = lon;
+        alt_[slot] = alt;
+        ve_[slot] = v_east;
+        vn_[slot] = v_north;
+        tag_[slot] = tag;
+    }
+
+    // Çatışmaya giren / çıkan çiftleri out'a ekler (out temizlenmez).
+    // Dönüş: eklenen olay sayısı.
+    std::size_t evaluate(const Params &p, std::vector<Conflict> &out)
+    {
+        const std::size_t before = out.size();
+        pair_tests_ = 0;
+        for (std::vector<Hit> &hits : hits_)
+            hits.clear();
+        gather(p);
+        if (p.horizontal_m > 0.0 && p.vertical_m > 0.0 && !live_.empty())
+        {
+            buildGrid(p);
+            scanCells(p);
+        }
+
+        // İş parçacıklarının sıralı çiftleri birleştirilir, sonra öncekiyle
+        // karşılaştırılır.
+        cur_.clear();
+        for (const std::vector<Hit> &hits : hits_)
+        {
+            merged_.clear();
+            std::merge(cur_.begin(), cur_.end(), hits.begin(), hits.end(), std::back_inserter(merged_), byKey);
+            cur_.swap(merged_);
+        }
+
+        auto start = [&](const Hit &h)
+        {
+            const uint32_t a = static_cast<uint32_t>(h.key >> 32), b = static_cast<uint32_t>(h.key);
+            out.push_back(Conflict{a, b, tag_[a], tag_[b], true, h.tcpa, h.dcpa, h.range, std::abs(alt_[b] - alt_[a]),
+                                   lat_[a], lon_[a], lat_[b], lon_[b]});
+        };
+        // Kaldırılan taraf son bilinen tag / kinematikle bildirilir.
+        auto end = [&](uint64_t key)
+        {
+            const uint32_t a = static_cast<uint32_t>(key >> 32), b = static_cast<uint32_t>(key);
+            const Kin &ka = dropped_[a] ? gone_kin_[a] : kin_[a];
+            const Kin &kb = dropped_[b] ? gone_kin_[b] : kin_[b];
+            double tcpa, dcpa, range;
+            cpa(ka, kb, p.lookahead_s, tcpa, dcpa, range);
+            out.push_back(Conflict{a, b, dropped_[a] ? gone_tag_[a] : tag_[a], dropped_[b] ? gone_tag_[b] : tag_[b],
+                                   false, tcpa, dcpa, range, std::abs(kb.alt - ka.alt), ka.lat, ka.lon, kb.lat,
+                                   kb.lon});
+        };
+        std::size_t i = 0, j = 0;
+        while (i < cur_.size() || j < prev_.size())
+        {
+            if (j == prev_.size() || (i < cur_.size() && cur_[i].key < prev_[j]))
+            {
+                start(cur_[i]);
+                ++i;
+            }
+            else if (i == cur_.size() || prev_[j] < cur_[i].key)
+            {
+                end(prev_[j]);
+                ++j;
+            }
+            else
+            {
+                // Aynı anahtar, ama slotlardan biri kaldırılıp yeni hedefe
+                // verildiyse bu başka bir çifttir: eskisi biter, yenisi başlar.
+                const uint32_t a = static_cast<uint32_t>(prev_[j] >> 32), b = static_cast<uint32_t>(prev_[j]);
+                if (dropped_[a] || dropped_[b])
+                {
+                    end(prev_[j]);
+                    start(cur_[i]);
+                }
+                ++i;
+                ++j;
+            }
+        }
+        prev_.clear();
+        for (const Hit &h : cur_)
+            prev_.push_back(h.key);
+        std::fill(dropped_.begin(), dropped_.end(), 0);
+        return out.size() - before;
+    }
+
+    std::size_t active() const { return prev_.size(); }   // son evaluate()'te çatışan çiftler
+    uint64_t pairTests() const { return pair_tests_; }     // son evaluate()'te sınanan aday çiftler
+
+private:
+    static constexpr double kMetersPerDeg = 111195.0; // küresel dünya, R = 6371 km
+    static constexpr int kMaxSide = 1024;
+    static constexpr std::size_t kParallelMin = 8192; // bunun altında tek iş parçacığı
+    static constexpr uint32_t kChunk = 64;            // iş parçacığı başına alınan hücre grubu
+
+    // float: kutular yatay ayrımın %2'si kadar pay içerir, yuvarlama
+    // bunun yanında ihmal edilir. Hücre aralıkları da aynı float
+    // değerlerden hesaplandığından çift sahipliği tutarlıdır.
+    struct Box
+    {
+        float x0, y0, x1, y1; // boylam / enlem derece
+    };
+
+    // CPA için gereken her şey tek kayıtta (tek cache satırı).
+    struct Kin
+    {
+        double lat, lon, alt, ve, vn;
+        double cos_lat;
+    };
+
+    // Hücre taraması için sıralı, bitişik kopya: iç döngü ve CPA slot
+    // dizilerine rastgele erişmez.
+    struct Cand
+    {
+        Box box;
+        int64_t top; // üst bant - min_band_
+        uint32_t slot;
+        int32_t row0, col0; // kutunun sol alt hücresi
+        Kin kin;
+    };
+
+    struct Hit
+    {
+        uint64_t key; // slot_a << 32 | slot_b
+        double tcpa, dcpa, range;
+    };
+    static bool byKey(const Hit &a, const Hit &b) { return a.key < b.key; }
+
+    // Canlı slotların kutuları ve bantları.
+    void gather(const Params &p)
+    {
+        live_.clear();
+        for (uint32_t s = 0; s < alive_.size(); ++s)
+            if (alive_[s])
+                live_.push_back(s);
+        if (box_.size() < alive_.size())
+        {
+            box_.resize(alive_.size());
+            kin_.resize(alive_.size());
+            band0_.resize(alive_.size());
+            band1_.resize(alive_.size());
+        }
+        for (uint32_t s : live_)
+            kin_[s] = kinematics(s);
+        if (p.horizontal_m <= 0.0 || p.vertical_m <= 0.0)
+            return;
+
+        // Kutu kesişimi yatay ayrımdan biraz geniş tutulur: kutular hedefin
+        // kendi enleminde, CPA çiftin orta enleminde ölçülür.
+        const double half = 0.51 * p.horizontal_m / kMetersPerDeg;
+        const double T = p.lookahead_s;
+        const double half_v = 0.5 * p.vertical_m, inv_v = 1.0 / p.vertical_m;
+        for (uint32_t s : live_)
+        {
+            const double c = kin_[s].cos_lat;
+            const double dx = ve_[s] * T / kMetersPerDeg / c, dy = vn_[s] * T / kMetersPerDeg;
+            box_[s] = Box{static_cast<float>(lon_[s] + std::min(0.0, dx) - half / c),
+                          static_cast<float>(lat_[s] + std::min(0.0, dy) - half),
+                          static_cast<float>(lon_[s] + std::max(0.0, dx) + half / c),
+                          static_cast<float>(lat_[s] + std::max(0.0, dy) + half)};
+            band0_[s] = static_cast<int32_t>(std::floor((alt_[s] - half_v) * inv_v));
+            band1_[s] = static_cast<int32_t>(std::floor((alt_[s] + half_v) * inv_v));
+        }
+    }
+
+    // Hücre boyu ortalama süpürme boyu kadardır: tipik kutu 2x2 hücreye düşer.
+    void buildGrid(const Params &p)
+    {
+        double min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+        double speed = 0.0, lat = 0.0;
+        int32_t min_band = INT32_MAX;
+        for (uint32_t s : live_)
+        {
+            const Box &b = box_[s];
+            min_x = std::min<double>(min_x, b.x0);
+            min_y = std::min<double>(min_y, b.y0);
+            max_x = std::max<double>(max_x, b.x1);
+            max_y = std::max<double>(max_y, b.y1);
+            speed += std::sqrt(ve_[s] * ve_[s] + vn_[s] * vn_[s]);
+            lat += lat_[s];
+            min_band = std::min(min_band, band0_[s]);
+        }
+        const double n = static_cast<double>(live_.size());
+        const double cell_m = p.horizontal_m + speed / n * p.lookahead_s;
+        const double c = std::max(0.1, std::cos(lat / n * (M_PI / 180.0)));
+        cell_y_ = std::max(cell_m / kMetersPerDeg, (max_y - min_y) / kMaxSide);
+        cell_x_ = std::max(cell_m / kMetersPerDeg / c, (max_x - min_x) / kMaxSide);
+        origin_x_ = min_x;
+        origin_y_ = min_y;
+        rows_ = std::min(kMaxSide, static_cast<int>((max_y - min_y) / cell_y_) + 1);
+        cols_ = std::min(kMaxSide, static_cast<int>((max_x - min_x) / cell_x_) + 1);
+
+        const std::size_t cells = static_cast<std::size_t>(rows_) * cols_;
+        cell_start_.assign(cells + 1, 0);
+        for (uint32_t s : live_)
+        {
+            const Box &b = box_[s];
+            const int r0 = row(b.y0), r1 = row(b.y1), c0 = col(b.x0), c1 = col(b.x1);
+            for (int r = r0; r <= r1; ++r)
+                for (int k = c0; k <= c1; ++k)
+                    ++cell_start_[static_cast<std::size_t>(r) * cols_ + k + 1];
+        }
+        for (std::size_t k = 0; k < cells; ++k)
+            cell_start_[k + 1] += cell_start_[k];
+
+        // Kayıt: (alt bant << 32) | slot; hücre içi sıralama tek uint64 karşılaştırması.
+        entries_.resize(cell_start_[cells]);
+        cursor_.assign(cell_start_.begin(), cell_start_.end() - 1);
+        for (uint32_t s : live_)
+        {
+            const Box &b = box_[s];
+            const uint64_t band = static_cast<uint64_t>(static_cast<int64_t>(band0_[s]) - min_band) << 32;
+            const int r0 = row(b.y0), r1 = row(b.y1), c0 = col(b.x0), c1 = col(b.x1);
+            for (int r = r0; r <= r1; ++r)
+                for (int k = c0; k <= c1; ++k)
+                    entries_[cursor_[static_cast<std::size_t>(r) * cols_ + k]++] = band | s;
+        }
+        min_band_ = min_band;
+    }
+
+    void scanCells(const Params &p)
+    {
+        unsigned threads = p.threads ? p.threads : std::thread::hardware_concurrency();
+        threads = std::clamp(threads, 1u, 8u);
+        if (live_.size() < kParallelMin)
+            threads = 1;
+        hits_.resize(threads);
+        scratch_.resize(threads);
+        tests_.assign(threads, 0);
+        std::atomic<uint32_t> next{0};
+        auto work = [&](unsigned t)
+        {
+            uint64_t tests = 0;
+            const uint32_t cells = static_cast<uint32_t>(rows_) * cols_;
+            for (uint32_t first; (first = next.fetch_add(kChunk, std::memory_order_relaxed)) < cells;)
+                for (uint32_t cell = first; cell < std::min(cells, first + kChunk); ++cell)
+                    scanCell(cell, p, scratch_[t], hits_[t], tests);
+            std::sort(hits_[t].begin(), hits_[t].end(), byKey);
+            tests_[t] = tests;
+        };
+        // İşçiler ilk paralel taramada (ya da sayı değişince) bir kez açılır.
+        if (threads > 1 && (!pool_ || pool_->workers() != threads - 1))
+            pool_ = std::make_unique<WorkerPool>(threads - 1);
+        if (threads == 1)
+            work(0);
+        else
+            pool_->run(threads, work);
+        for (uint64_t n : tests_)
+            pair_tests_ += n;
+    }
+
+    void scanCell(uint32_t cell, const Params &p, std::vector<Cand> &cands, std::vector<Hit> &hits, uint64_t &tests)
+    {
+        uint64_t *begin = entries_.data() + cell_start_[cell];
+        uint64_t *end = entries_.data() + cell_start_[cell + 1];
+        if (end - begin < 2)
+            return;
+        std::sort(begin, end);
+        cands.clear();
+        for (const uint64_t *e = begin; e != end; ++e)
+        {
+            const uint32_t s = static_cast<uint32_t>(*e);
+            const Box &b = box_[s];
+            cands.push_back(Cand{b, static_cast<int64_t>(band1_[s]) - min_band_, s, row(b.y0), col(b.x0), kin_[s]});
+        }
+
+        const int r = static_cast<int>(cell / cols_), c = static_cast<int>(cell % cols_);
+        const std::size_t n = cands.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const Cand &ca = cands[i];
+            for (std::size_t j = i + 1; j < n && static_cast<int64_t>(begin[j] >> 32) <= ca.top; ++j)
+            {
+                const Box &bb = cands[j].box;
+                if (ca.box.x0 > bb.x1 || bb.x0 > ca.box.x1 || ca.box.y0 > bb.y1 || bb.y0 > ca.box.y1)
+                    continue;
+                // Çift kesişim köşesinin hücresinde bir kez sınanır; row/col
+                // monoton olduğundan köşenin hücresi sol alt hücrelerin maksimumudur.
+                if (std::max(ca.row0, cands[j].row0) != r || std::max(ca.col0, cands[j].col0) != c)
+                    continue;
+                ++tests;
+                if (std::abs(ca.kin.alt - cands[j].kin.alt) >= p.vertical_m)
+                    continue;
+                double tcpa, dcpa, range;
+                cpa(ca.kin, cands[j].kin, p.lookahead_s, tcpa, dcpa, range);
+                if (dcpa < p.horizontal_m)
+                {
+                    const uint32_t a = ca.slot, b = cands[j].slot;
+                    const uint64_t key = a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+                    hits.push_back(Hit{key, tcpa, dcpa, range});
+                }
+            }
+        }
+    }
+
+    // Çiftin orta enleminde yerel düzlem; göreli hız sabit kabul edilir.
+    static void cpa(const Kin &a, const Kin &b, double lookahead_s, double &tcpa, double &dcpa, double &range)
+    {
+        const double mx = kMetersPerDeg * 0.5 * (a.cos_lat + b.cos_lat);
+        const double dx = (b.lon - a.lon) * mx, dy = (b.lat - a.lat) * kMetersPerDeg;
+        const double wx = b.ve - a.ve, wy = b.vn - a.vn;
+        const double w2 = wx * wx + wy * wy;
+        tcpa = w2 > 0.0 ? std::clamp(-(dx * wx + dy * wy) / w2, 0.0, lookahead_s) : 0.0;
+        const double cx = dx + wx * tcpa, cy = dy + wy * tcpa;
+        dcpa = std::sqrt(cx * cx + cy * cy);
+        range = std::sqrt(dx * dx + dy * dy);
+    }
+
+    Kin kinematics(uint32_t s) const
+    {
+        return Kin{lat_[s], lon_[s], alt_[s], ve_[s], vn_[s], std::max(1e-6, std::cos(lat_[s] * (M_PI / 180.0)))};
+    }
+
+    int row(double y) const { return std::clamp(static_cast<int>((y - origin_y_) / cell_y_), 0, rows_ - 1); }
+    int col(double x) const { return std::clamp(static_cast<int>((x - origin_x_) / cell_x_), 0, cols_ - 1); }
+
+    std::vector<double> lat_, lon_, alt_, ve_, vn_;
+    std::vector<uint32_t> tag_;
+    std::vector<uint8_t> alive_;
+    std::vector<uint8_t> dropped_; // son evaluate()'ten beri boşaltıldı
+    std::vector<uint32_t> gone_tag_; // dropped_ slotların kaldırılmadan önceki değerleri
+    std::vector<Kin> gone_kin_;
+    std::vector<uint32_t> free_;
+
+    std::vector<uint32_t> live_;
+    std::vector<Box> box_;
+    std::vector<Kin> kin_;
+    std::vector<int32_t> band0_, band1_;
+
+    double origin_x_ = 0.0, origin_y_ = 0.0, cell_x_ = 1.0, cell_y_ = 1.0;
+    int rows_ = 0, cols_ = 0;
+    int64_t min_band_ = 0;
+    std::vector<uint32_t> cell_start_, cursor_;
+    std::vector<uint64_t> entries_;
+
+    std::vector<std::vector<Hit>> hits_; // iş parçacığı başına
+    std::vector<std::vector<Cand>> scratch_;
+    std::vector<uint64_t> tests_;
+    std::vector<Hit> cur_, merged_;
+    std::vector<uint64_t> prev_; // önceki tick'in çatışan çift anahtarları, sıralı
+    uint64_t pair_tests_ = 0;
+    std::unique_ptr<WorkerPool> pool_;
+};
+
+#endif
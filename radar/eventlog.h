@@ -0,0 +1,84 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Hareket adımında üretilen olayların (anomali alarmı, geofence olayı)
+// stream'lere yayını. Batch'ler bir kez kurulur ve paylaşılır; son
+// kBacklog batch tutulur, yavaş stream bunları sırayla yetiştirir. Daha
+// geride kalan stream atladığı batch'leri seq boşluğundan anlar. Abone
+// yokken üretici batch kurmayı atlayabilir (hasSubscribers).
+template <typename Msg>
+class EventLog
+{
+public:
+    static constexpr std::size_t kBacklog = 64;
+
+    struct Batch
+    {
+        uint64_t seq = 0; // publish() sırası
+        uint64_t tick = 0;
+        int64_t sim_time_us = 0;
+        std::vector<Msg> events;
+    };
+
+    void publish(std::shared_ptr<Batch> batch)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch->seq = ++seq_;
+            log_.push_back(std::move(batch));
+            if (log_.size() > kBacklog)
+                log_.pop_front();
+        }
+        cv_.notify_all();
+    }
+
+    // Okuyan stream'ler Subscription ile sayılır.
+    class Subscription
+    {
+    public:
+        explicit Subscription(EventLog &log) : log_(log) { ++log_.subscribers_; }
+        ~Subscription() { --log_.subscribers_; }
+        Subscription(const Subscription &) = delete;
+        Subscription &operator=(const Subscription &) = delete;
+
+    private:
+        EventLog &log_;
+    };
+
+    bool hasSubscribers() const { return subscribers_.load(std::memory_order_relaxed) > 0; }
+
+    // Son yayınlanan batch'in seq'i; yeni abone buradan başlar.
+    uint64_t last() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return seq_;
+    }
+
+    // after'dan sonraki batch'leri out'a ekler; yoksa en fazla wait kadar bekler.
+    void collect(uint64_t after, std::chrono::milliseconds wait, std::vector<std::shared_ptr<const Batch>> &out)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, wait, [&] { return seq_ != after; });
+        for (const auto &batch : log_)
+            if (batch->seq > after)
+                out.push_back(batch);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<const Batch>> log_;
+    uint64_t seq_ = 0;
+    std::atomic<int> subscribers_{0};
+};
+
+#endif
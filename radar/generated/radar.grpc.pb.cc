@@ -1,79 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: radar.proto
-
-#include "radar.pb.h"
-#include "radar.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-namespace radar {
-
-static const char* RadarService_method_names[] = {
-  "/radar.RadarService/StreamRadarTargets",
-};
-
-std::unique_ptr< RadarService::Stub> RadarService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< RadarService::Stub> stub(new RadarService::Stub(channel, options));
-  return stub;
-}
-
-RadarService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_StreamRadarTargets_(RadarService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
-  {}
-
-::grpc::ClientReader< ::radar::RadarTarget>* RadarService::Stub::StreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request) {
-  return ::grpc::internal::ClientReaderFactory< ::radar::RadarTarget>::Create(channel_.get(), rpcmethod_StreamRadarTargets_, context, request);
-}
-
-void RadarService::Stub::async::StreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest* request, ::grpc::ClientReadReactor< ::radar::RadarTarget>* reactor) {
-  ::grpc::internal::ClientCallbackReaderFactory< ::radar::RadarTarget>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamRadarTargets_, context, request, reactor);
-}
-
-::grpc::ClientAsyncReader< ::radar::RadarTarget>* RadarService::Stub::AsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::radar::RadarTarget>::Create(channel_.get(), cq, rpcmethod_StreamRadarTargets_, context, request, true, tag);
-}
-
-::grpc::ClientAsyncReader< ::radar::RadarTarget>* RadarService::Stub::PrepareAsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncReaderFactory< ::radar::RadarTarget>::Create(channel_.get(), cq, rpcmethod_StreamRadarTargets_, context, request, false, nullptr);
-}
-
-RadarService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      RadarService_method_names[0],
-      ::grpc::internal::RpcMethod::SERVER_STREAMING,
-      new ::grpc::internal::ServerStreamingHandler< RadarService::Service, ::radar::StreamRequest, ::radar::RadarTarget>(
-          [](RadarService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::radar::StreamRequest* req,
-             ::grpc::ServerWriter<::radar::RadarTarget>* writer) {
-               return service->StreamRadarTargets(ctx, req, writer);
-             }, this)));
-}
-
-RadarService::Service::~Service() {
-}
-
-::grpc::Status RadarService::Service::StreamRadarTargets(::grpc::ServerContext* context, const ::radar::StreamRequest* request, ::grpc::ServerWriter< ::radar::RadarTarget>* writer) {
-  (void) context;
-  (void) request;
-  (void) writer;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace radar
-
@@ -1,239 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: radar.proto
-#ifndef GRPC_radar_2eproto__INCLUDED
-#define GRPC_radar_2eproto__INCLUDED
-
-#include "radar.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-
-namespace radar {
-
-class RadarService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "radar.RadarService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    std::unique_ptr< ::grpc::ClientReaderInterface< ::radar::RadarTarget>> StreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReaderInterface< ::radar::RadarTarget>>(StreamRadarTargetsRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>> AsyncStreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>>(AsyncStreamRadarTargetsRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>> PrepareAsyncStreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>>(PrepareAsyncStreamRadarTargetsRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void StreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest* request, ::grpc::ClientReadReactor< ::radar::RadarTarget>* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientReaderInterface< ::radar::RadarTarget>* StreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>* AsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncReaderInterface< ::radar::RadarTarget>* PrepareAsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    std::unique_ptr< ::grpc::ClientReader< ::radar::RadarTarget>> StreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request) {
-      return std::unique_ptr< ::grpc::ClientReader< ::radar::RadarTarget>>(StreamRadarTargetsRaw(context, request));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::radar::RadarTarget>> AsyncStreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::radar::RadarTarget>>(AsyncStreamRadarTargetsRaw(context, request, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncReader< ::radar::RadarTarget>> PrepareAsyncStreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncReader< ::radar::RadarTarget>>(PrepareAsyncStreamRadarTargetsRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void StreamRadarTargets(::grpc::ClientContext* context, const ::radar::StreamRequest* request, ::grpc::ClientReadReactor< ::radar::RadarTarget>* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientReader< ::radar::RadarTarget>* StreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request) override;
-    ::grpc::ClientAsyncReader< ::radar::RadarTarget>* AsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncReader< ::radar::RadarTarget>* PrepareAsyncStreamRadarTargetsRaw(::grpc::ClientContext* context, const ::radar::StreamRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_StreamRadarTargets_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status StreamRadarTargets(::grpc::ServerContext* context, const ::radar::StreamRequest* request, ::grpc::ServerWriter< ::radar::RadarTarget>* writer);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamRadarTargets(::grpc::ServerContext* context, ::radar::StreamRequest* request, ::grpc::ServerAsyncWriter< ::radar::RadarTarget>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_StreamRadarTargets<Service > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::radar::StreamRequest, ::radar::RadarTarget>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::radar::StreamRequest* request) { return this->StreamRadarTargets(context, request); }));
-    }
-    ~WithCallbackMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::radar::RadarTarget>* StreamRadarTargets(
-      ::grpc::CallbackServerContext* /*context*/, const ::radar::StreamRequest* /*request*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_StreamRadarTargets<Service > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestStreamRadarTargets(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(0, context, request, writer, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamRadarTargets(context, request); }));
-    }
-    ~WithRawCallbackMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamRadarTargets(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
-  };
-  typedef Service StreamedUnaryService;
-  template <class BaseClass>
-  class WithSplitStreamingMethod_StreamRadarTargets : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithSplitStreamingMethod_StreamRadarTargets() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::SplitServerStreamingHandler<
-          ::radar::StreamRequest, ::radar::RadarTarget>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerSplitStreamer<
-                     ::radar::StreamRequest, ::radar::RadarTarget>* streamer) {
-                       return this->StreamedStreamRadarTargets(context,
-                         streamer);
-                  }));
-    }
-    ~WithSplitStreamingMethod_StreamRadarTargets() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status StreamRadarTargets(::grpc::ServerContext* /*context*/, const ::radar::StreamRequest* /*request*/, ::grpc::ServerWriter< ::radar::RadarTarget>* /*writer*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with split streamed
-    virtual ::grpc::Status StreamedStreamRadarTargets(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::radar::StreamRequest,::radar::RadarTarget>* server_split_streamer) = 0;
-  };
-  typedef WithSplitStreamingMethod_StreamRadarTargets<Service > SplitStreamedService;
-  typedef WithSplitStreamingMethod_StreamRadarTargets<Service > StreamedService;
-};
-
-}  // namespace radar
-
-
-#endif  // GRPC_radar_2eproto__INCLUDED
@@ -1,22 +1,63 @@
 #include "radarservice.h"
+#include "config.h"
+#include "logger.h"
+#include "metrics.h"
+#include "serverconfig.h"
+#include "tracksource.h"
 #include <grpcpp/grpcpp.h>
 #include <iostream>
 #include <memory>
 #include <string>
 
-int main() {
+int main(int argc, char** argv) {
 
-    const std::string server_address = "0.0.0.0:50053";
-    const std::string mongo_uri      = "mongodb://localhost:27017";
-    const std::string db_name        = "aewc";
-    const std::string coll_name      = "radar";
+    // --config radar.conf ve --anahtar=değer override'ları (bkz. config/aewc.conf).
+    Config cfg;
+    std::string cfg_error;
+    if (!cfg.load(argc, argv, &cfg_error)) {
+        std::cerr << "[ERROR] " << cfg_error << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string server_address = cfg.getString("radar.address", "0.0.0.0:50053");
+    const std::string mongo_uri      = cfg.getString("mongo.uri", "mongodb://localhost:27017");
+    const std::string db_name        = cfg.getString("mongo.db", "aewc");
+    const std::string coll_name      = cfg.getString("radar.collection", "radar");
+
+    Logger::instance().start(logger_options(cfg));
+
+    MetricsRegistry::instance().callbackGauge("aewc_log_records_dropped", "Kuyruk dolu olduğu için düşürülen log kayıtları",
+                                              [] { return static_cast<double>(Logger::instance().dropped()); });
+    MetricsServer metrics_server;
+    metrics_server.start(static_cast<uint16_t>(cfg.getInt("radar.metrics_port", MetricsServer::portFromEnv(9253))));
 
     try {
-    
-        RadarServiceImpl service(mongo_uri, db_name, coll_name);
 
- 
+        // source.spec=file:/data/{coll}.bson veya synthetic:1000000 ile Mongo'suz çalışır.
+        auto source = make_track_source(cfg.getString("source.spec", track_source_spec_from_env()),
+                                        mongo_uri, db_name, coll_name, TrackSchema::radar(), nullptr,
+                                        static_cast<int32_t>(cfg.getInt("mongo.batch_size", 0)));
+        const std::string source_desc = source->describe();
+        RadarServiceImpl service(std::move(source));
+        const RadarSettings settings = RadarSettings::fromConfig(cfg);
+        service.configure(settings);
+        service.loadGeofences(settings.geofence_path);
+        if (auto area = load_operating_area(cfg.getString("area.path", "")))
+            service.setOperatingArea(std::move(area));
+
+        // SIGHUP: radar.* simülasyon ayarları, geofence poligonları, area.path ve log.level yeniden okunur.
+        ConfigWatcher watcher;
+        watcher.start(cfg, [&service](const Config& c) {
+            const RadarSettings s = RadarSettings::fromConfig(c);
+            service.configure(s);
+            service.loadGeofences(s.geofence_path);
+            if (auto area = load_operating_area(c.getString("area.path", "")))
+                service.setOperatingArea(std::move(area));
+            Logger::instance().setLevel(logger_options(c).level);
+        });
+
         grpc::ServerBuilder builder;
+        apply_server_config(cfg, builder);
         builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
         builder.RegisterService(&service);
 
@@ -25,13 +66,18 @@ int main() {
             std::cerr << "[ERROR] gRPC server başlatılamadı." << std::endl;
             return EXIT_FAILURE;
         }
+        // Hedef hareketi ve değerlendirmeler client'lardan bağımsız tek tick thread'inde.
+        service.start();
 
         std::cout << "[INFO] Radar Service listening on " << server_address << std::endl;
-        std::cout << "[INFO] MongoDB: " << mongo_uri << " / " << db_name << "." << coll_name << std::endl;
+        std::cout << "[INFO] Veri kaynağı: " << source_desc << std::endl;
+        if (!cfg.path().empty())
+            std::cout << "[INFO] Yapılandırma: " << cfg.path() << " (SIGHUP ile yeniden yüklenir)" << std::endl;
         std::cout << "[INFO] CTRL+C ile durdurabilirsiniz." << std::endl;
 
 
         server->Wait();
+        service.stop();
     } catch (const std::exception& e) {
         std::cerr << "[ERROR] Sunucu başlatılamadı: " << e.what() << std::endl;
         return EXIT_FAILURE;
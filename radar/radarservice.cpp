@@ -1,4 +1,9 @@
 #include "radarservice.h"
+#include "config.h"
+#include "idformat.h"
+#include "logger.h"
+#include "metrics.h"
+#include "timeutil.h"
 
 #include <grpcpp/grpcpp.h>
 #include "radar.grpc.pb.h"
@@ -9,29 +14,67 @@
 #include <thread>
 #include <chrono>
 #include <cstdint>
-#include <unordered_map>
-#include <unordered_set>
 #include <mutex>
+#include <condition_variable>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
+#include <bitset>
 #include <cmath>
 
 
-#include <bsoncxx/json.hpp>
-#include <bsoncxx/types.hpp>
-#include <bsoncxx/builder/basic/document.hpp>
-#include <bsoncxx/builder/basic/kvp.hpp>
-#include <mongocxx/client.hpp>
-#include <mongocxx/instance.hpp>
-#include <mongocxx/uri.hpp>
-#include <mongocxx/options/find.hpp>
 
+// Hedef başına satırlar örneklenir; her tick'te her hedef için konsola yazmak
+// servisin en pahalı kısmıydı.
+static LogRateLimiter s_send_log_limiter(20);
+static LogRateLimiter s_reload_log_limiter(50);
 
-static mongocxx::instance s_mongo_instance{};
+namespace
+{
+struct RadarMetrics
+{
+    MetricsRegistry &r = MetricsRegistry::instance();
+    Histogram &tick = r.histogram("radar_tick_duration_seconds", "sendRadarFile gönderim süresi (stream başına)");
+    Histogram &server_tick = r.histogram("radar_server_tick_seconds", "Sunucu tick'i: reload + hareket + değerlendirmeler + snapshot");
+    Counter &server_tick_overruns = r.counter("radar_server_tick_overruns_total", "radar.default_interval_ms içinde bitmeyen sunucu tick'leri");
+    Histogram &reload = r.histogram("radar_reload_duration_seconds", "loadRadarData toplam süresi");
+    Histogram &mongo_query = r.histogram("radar_mongo_query_duration_seconds", "TrackSource::load süresi (Mongo find + cursor okuma)");
+    Histogram &write = r.histogram("radar_stream_write_duration_seconds", "Tek bir ServerWriter::Write süresi");
+    Histogram &tick_to_write = r.histogram("radar_tick_to_write_seconds", "Tick başlangıcından (sim_time_us) Write tamamlanmasına kadar geçen süre");
+    Counter &messages_sent = r.counter("radar_messages_sent_total", "Gönderilen RadarTarget mesajları");
+    Counter &frames_dropped = r.counter("radar_frames_dropped_total", "Yazma hatası yüzünden yarım kalan frame'ler");
+    Gauge &active_streams = r.gauge("radar_active_streams", "Açık StreamRadarTargets çağrıları");
+    Gauge &active_targets = r.gauge("radar_active_targets", "Bellekteki hedef sayısı");
+    Gauge &viewport_streams = r.gauge("radar_viewport_streams", "Açık SubscribeViewport çağrıları");
+    Counter &viewport_events = r.counter("radar_viewport_events_total", "Gönderilen ENTER/UPDATE/LEAVE olayları");
+    Counter &cluster_events = r.counter("radar_cluster_events_total", "Gönderilen CLUSTER_UPDATE/CLUSTER_REMOVE olayları");
+    Histogram &track_filter = r.histogram("radar_track_filter_seconds", "Tüm izler için Kalman tahmin + güncelleme adımı");
+    Histogram &viewport_frame = r.histogram("radar_viewport_frame_seconds", "Görünüm frame'i: ızgara + sorgu + gönderim");
+    Histogram &anomaly_eval = r.histogram("radar_anomaly_eval_seconds", "Tüm hedefler için anomali kuralları + alarm mesajları");
+    Counter &anomaly_alerts = r.counter("radar_anomaly_alerts_total", "Üretilen anomali alarmları");
+    Histogram &geofence_eval = r.histogram("radar_geofence_eval_seconds", "Tüm hedefler için geofence üyeliği + giriş/çıkış olayları");
+    Counter &geofence_events = r.counter("radar_geofence_events_total", "Üretilen geofence giriş/çıkış olayları");
+    Gauge &geofence_memberships = r.gauge("radar_geofence_memberships", "Son adımda poligon içindeki (hedef, poligon) çifti");
+    Counter &event_batches_skipped = r.counter("radar_event_batches_skipped_total", "Yavaş StreamAlerts / StreamGeofenceEvents client'ının kaçırdığı olay batch'leri");
+    Gauge &alert_streams = r.gauge("radar_alert_streams", "Açık StreamAlerts çağrıları");
+    Gauge &geofence_streams = r.gauge("radar_geofence_streams", "Açık StreamGeofenceEvents çağrıları");
+    Histogram &conflict_eval = r.histogram("radar_conflict_eval_seconds", "Tüm hedef çiftleri için aday arama + CPA + çatışma olayları");
+    Counter &conflict_events = r.counter("radar_conflict_events_total", "Üretilen çatışma START/END olayları");
+    Gauge &conflicts_active = r.gauge("radar_conflicts_active", "Son adımda çatışan hedef çiftleri");
+    Gauge &conflict_pair_tests = r.gauge("radar_conflict_pair_tests", "Son adımda CPA'sı sınanan aday çiftler");
+    Gauge &conflict_streams = r.gauge("radar_conflict_streams", "Açık StreamConflicts çağrıları");
+    Histogram &prediction = r.histogram("radar_prediction_seconds", "Tüm hedefler için düz + dönüş izdüşümü (tick başına bir kez)");
+    Counter &prediction_frames_skipped = r.counter("radar_prediction_frames_skipped_total", "Yavaş StreamPredictions client'ının atladığı tahmin frame'leri");
+    Gauge &prediction_streams = r.gauge("radar_prediction_streams", "Açık StreamPredictions çağrıları");
+};
 
+RadarMetrics &metrics()
+{
+    static RadarMetrics m;
+    return m;
+}
+} // namespace
 
 static bool __seeded = ([]()
                         {
@@ -39,96 +82,203 @@ static bool __seeded = ([]()
     return true; })();
 
 
-std::string RadarServiceImpl::get_string_utf8(const bsoncxx::document::view &v, const char *key, const std::string &def)
+// Hareket mantığı 1 birim ötede aynı ID'ye sahip cisim oluşturuyor.. 
+int RadarServiceImpl::sign_rand() { return (std::rand() % 2) ? 1 : -1; }
+
+
+RadarServiceImpl::RadarServiceImpl(std::string mongo_uri,
+                                   std::string db_name,
+                                   std::string coll_name)
+    : RadarServiceImpl(std::make_unique<MongoTrackSource>(std::move(mongo_uri), std::move(db_name),
+                                                          std::move(coll_name), TrackSchema::radar())) {}
+
+RadarServiceImpl::RadarServiceImpl(std::unique_ptr<TrackSource> source)
+    : source_(std::move(source)) {}
+
+RadarServiceImpl::~RadarServiceImpl()
 {
-    auto elem = v[key];
-    if (!elem)
-        return def;
-    if (elem.type() == bsoncxx::type::k_string)
-    {
-        auto sv = elem.get_string().value;
-        return std::string(sv.data(), sv.size());
-    }
-    return def;
+    stop();
 }
 
-bool RadarServiceImpl::get_double_safe(const bsoncxx::document::view &v, const char *key, double &out)
+void RadarServiceImpl::start()
 {
-    auto elem = v[key];
-    if (!elem)
-        return false;
-    switch (elem.type())
-    {
-    case bsoncxx::type::k_double:
-        out = elem.get_double().value;
-        return true;
-    case bsoncxx::type::k_int32:
-        out = static_cast<double>(elem.get_int32().value);
-        return true;
-    case bsoncxx::type::k_int64:
-        out = static_cast<double>(elem.get_int64().value);
-        return true;
-    default:
-        return false;
-    }
+    if (tick_thread_.joinable())
+        return;
+    stopping_ = false;
+    tick_thread_ = std::thread(&RadarServiceImpl::runTicks, this);
 }
 
-int32_t RadarServiceImpl::get_int32_safe(const bsoncxx::document::view &v, const char *key, int32_t def)
+void RadarServiceImpl::stop()
 {
-    auto elem = v[key];
-    if (!elem)
-        return def;
-    switch (elem.type())
+    if (!tick_thread_.joinable())
+        return;
     {
-    case bsoncxx::type::k_int32:
-        return elem.get_int32().value;
-    case bsoncxx::type::k_int64:
-        return static_cast<int32_t>(elem.get_int64().value);
-    case bsoncxx::type::k_double:
-        return static_cast<int32_t>(elem.get_double().value);
-    default:
-        return def;
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stopping_ = true;
     }
+    stop_cv_.notify_all();
+    tick_thread_.join();
 }
 
-std::string RadarServiceImpl::get_oid_string(const bsoncxx::document::view &v)
+void RadarServiceImpl::runTicks()
 {
-    auto elem = v["_id"];
-    if (!elem)
-        return {};
-    if (elem.type() == bsoncxx::type::k_oid)
+    // Simülasyon adımı nominal aralıktır; geciken tick sonrakini kaydırır,
+    // kaçırılan tick'ler art arda yetiştirilmez.
+    auto next = std::chrono::steady_clock::now();
+    for (;;)
     {
-        return elem.get_oid().value.to_string();
+        const int interval_ms = setting(&RadarSettings::default_interval_ms);
+        {
+            ScopedTimer tick_timer(metrics().server_tick);
+            tick(interval_ms / 1000.0);
+        }
+
+        next += std::chrono::milliseconds(interval_ms);
+        const auto now = std::chrono::steady_clock::now();
+        if (next < now)
+        {
+            metrics().server_tick_overruns.inc();
+            next = now;
+        }
+        std::unique_lock<std::mutex> lock(stop_mutex_);
+        if (stop_cv_.wait_until(lock, next, [this] { return stopping_; }))
+            return;
     }
-    if (elem.type() == bsoncxx::type::k_string)
+}
+
+void RadarServiceImpl::tick(double delta_s)
+{
+    if (targets_.empty() || checkAndReloadData())
     {
-        auto sv = elem.get_string().value;
-        return std::string(sv.data(), sv.size());
+        if (targets_.empty())
+            loadRadarData();
     }
-    return {};
+
+    // Bu tick'te yayınlanan tüm hedefler aynı simülasyon anını taşır.
+    advanceTargets(delta_s, unix_micros());
 }
 
-// Türkiye sınır kontrolü
-bool RadarServiceImpl::is_in_tr_bbox(double lat, double lon)
+RadarSettings RadarSettings::fromConfig(const Config &cfg)
 {
-    return (lat >= 36.0 && lat <= 42.0 && lon >= 26.0 && lon <= 45.0);
+    RadarSettings s;
+    s.reload_period_s = static_cast<int>(cfg.getInt("radar.reload_period_s", s.reload_period_s));
+    s.default_interval_ms = static_cast<int>(cfg.getInt("radar.default_interval_ms", s.default_interval_ms));
+    s.velocity_jitter_pct = static_cast<int>(cfg.getInt("radar.velocity_jitter_pct", s.velocity_jitter_pct));
+    s.altitude_jitter_pct = static_cast<int>(cfg.getInt("radar.altitude_jitter_pct", s.altitude_jitter_pct));
+    s.step_lat = cfg.getDouble("radar.step_lat", s.step_lat);
+    s.step_lon = cfg.getDouble("radar.step_lon", s.step_lon);
+    s.cluster_max_zoom = static_cast<int>(cfg.getInt("radar.cluster_max_zoom", s.cluster_max_zoom));
+    s.track_meas_sigma_m = cfg.getDouble("radar.track_meas_sigma_m", s.track_meas_sigma_m);
+    s.track_accel_sigma = cfg.getDouble("radar.track_accel_sigma", s.track_accel_sigma);
+
+    std::string unknown_rules;
+    s.anomaly.rules = AnomalyDetector::parseRules(cfg.getString("radar.anomaly_rules", "default"), &unknown_rules);
+    if (!unknown_rules.empty())
+        Logger::instance().log(LogLevel::Warn, "CONFIG", {{"msg", "bilinmeyen radar.anomaly_rules"}, {"rules", unknown_rules}});
+    s.anomaly.max_climb_mps = cfg.getDouble("radar.anomaly_max_climb_mps", s.anomaly.max_climb_mps);
+    s.anomaly.max_accel_mps2 = cfg.getDouble("radar.anomaly_max_accel_mps2", s.anomaly.max_accel_mps2);
+    s.anomaly.reversal_deg = cfg.getDouble("radar.anomaly_reversal_deg", s.anomaly.reversal_deg);
+    s.anomaly.max_alt_mismatch_m = cfg.getDouble("radar.anomaly_max_alt_mismatch_m", s.anomaly.max_alt_mismatch_m);
+    s.geofence_path = cfg.getString("radar.geofence_path", s.geofence_path);
+    s.conflict.horizontal_m = cfg.getDouble("radar.conflict_horizontal_m", s.conflict.horizontal_m);
+    s.conflict.vertical_m = cfg.getDouble("radar.conflict_vertical_m", s.conflict.vertical_m);
+    s.conflict.lookahead_s = cfg.getDouble("radar.conflict_lookahead_s", s.conflict.lookahead_s);
+    s.conflict.threads = static_cast<unsigned>(std::max<int64_t>(0, cfg.getInt("radar.conflict_threads", 0)));
+    s.prediction.step_s = cfg.getDouble("radar.prediction_step_s", s.prediction.step_s);
+    s.prediction.horizon_s = cfg.getDouble("radar.prediction_horizon_s", s.prediction.horizon_s);
+
+    if (s.reload_period_s < 1)
+        s.reload_period_s = 1;
+    if (s.default_interval_ms < 1)
+        s.default_interval_ms = 1;
+    if (s.velocity_jitter_pct < 0)
+        s.velocity_jitter_pct = 0;
+    if (s.altitude_jitter_pct < 0)
+        s.altitude_jitter_pct = 0;
+    if (s.track_meas_sigma_m <= 0.0)
+        s.track_meas_sigma_m = 1.0;
+    if (s.track_accel_sigma <= 0.0)
+        s.track_accel_sigma = 0.1;
+    if (s.anomaly.max_climb_mps <= 0.0)
+        s.anomaly.max_climb_mps = 1.0;
+    if (s.anomaly.max_accel_mps2 <= 0.0)
+        s.anomaly.max_accel_mps2 = 1.0;
+    s.anomaly.reversal_deg = std::clamp(s.anomaly.reversal_deg, 1.0, 180.0);
+    if (s.anomaly.max_alt_mismatch_m <= 0.0)
+        s.anomaly.max_alt_mismatch_m = 1.0;
+    if (s.conflict.vertical_m <= 0.0)
+        s.conflict.vertical_m = 1.0;
+    if (s.conflict.lookahead_s < 0.0)
+        s.conflict.lookahead_s = 0.0;
+    // Hedef başına en fazla 120 nokta.
+    s.prediction.step_s = std::clamp(s.prediction.step_s, 1.0, 600.0);
+    s.prediction.horizon_s = std::clamp(s.prediction.horizon_s, s.prediction.step_s, 120.0 * s.prediction.step_s);
+    return s;
 }
 
-// Hareket mantığı 1 birim ötede aynı ID'ye sahip cisim oluşturuyor.. 
-int RadarServiceImpl::sign_rand() { return (std::rand() % 2) ? 1 : -1; }
+TrackFilterBank::Params RadarSettings::trackParams() const
+{
+    TrackFilterBank::Params p;
+    p.meas_sigma_m = track_meas_sigma_m;
+    p.accel_sigma = track_accel_sigma;
+    return p;
+}
 
+void RadarServiceImpl::configure(const RadarSettings &settings)
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    settings_ = settings;
+}
 
-RadarServiceImpl::RadarServiceImpl(std::string mongo_uri,
-                                   std::string db_name,
-                                   std::string coll_name)
-    : mongo_uri_(std::move(mongo_uri)),
-      db_name_(std::move(db_name)),
-      coll_name_(std::move(coll_name)) {}
+RadarSettings RadarServiceImpl::settings() const
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    return settings_;
+}
+
+void RadarServiceImpl::setOperatingArea(std::shared_ptr<const OperatingArea> area)
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    area_ = std::move(area);
+}
+
+std::shared_ptr<const OperatingArea> RadarServiceImpl::operatingArea() const
+{
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    return area_;
+}
+
+bool RadarServiceImpl::loadGeofences(const std::string &path)
+{
+    std::shared_ptr<GeofenceIndex> index;
+    if (!path.empty())
+    {
+        std::vector<GeoPolygon> polygons;
+        std::string error;
+        std::size_t skipped = 0;
+        if (!load_geojson_polygons(path, polygons, &error, &skipped))
+        {
+            Logger::instance().log(LogLevel::Warn, "GEOFENCE", {{"msg", "poligonlar yüklenemedi"}, {"what", error}});
+            return false;
+        }
+        index = std::make_shared<GeofenceIndex>();
+        index->build(std::move(polygons));
+        Logger::instance().log(LogLevel::Info, "GEOFENCE",
+                               {{"msg", "poligonlar yüklendi"},
+                                {"path", path},
+                                {"polygons", index->size()},
+                                {"edges", index->edges()},
+                                {"skipped", skipped}});
+    }
+    std::lock_guard<std::mutex> lock(settings_mutex_);
+    geofence_index_ = std::move(index);
+    return true;
+}
 
 bool RadarServiceImpl::checkAndReloadData()
 {
     std::time_t now = std::time(nullptr);
-    if (now - last_reload_check_ < 5)
+    if (now - last_reload_check_ < setting(&RadarSettings::reload_period_s))
         return false;
     last_reload_check_ = now;
 
@@ -138,287 +288,1183 @@ bool RadarServiceImpl::checkAndReloadData()
 
 void RadarServiceImpl::loadRadarData()
 {
-    mongocxx::client conn{mongocxx::uri{mongo_uri_}};
-    auto db = conn[db_name_];
-    auto coll = db[coll_name_];
+    std::lock_guard<std::mutex> reload_lock(reload_mutex_);
+    ScopedTimer reload_timer(metrics().reload);
 
-    std::unordered_map<std::string, MovingTarget> parsed;
-    std::unordered_set<std::string> seen_ids;
+    reload_rows_.clear();
 
     try
     {
-        mongocxx::options::find find_opts;
-        find_opts.sort(bsoncxx::builder::basic::make_document(
-            bsoncxx::builder::basic::kvp("_id", 1)));
+        ScopedTimer query_timer(metrics().mongo_query);
+        source_->load(source_rows_);
+    }
+    catch (const std::exception &e)
+    {
+        Logger::instance().log(LogLevel::Error, "SOURCE", {{"msg", "bağlantı/sorgu hatası"}, {"what", e.what()}});
+        return;
+    }
+
+    const std::shared_ptr<const OperatingArea> area = operatingArea();
+    for (const TrackRecord &rec : source_rows_)
+    {
+        if (!area->contains(rec.lat, rec.lon))
+            continue;
+
+        ReloadRow row;
+        row.id = rec.id;
+        row.lat = rec.lat;
+        row.lon = rec.lon;
+        row.velocity = static_cast<int32_t>(rec.velocity);
+        row.baro_altitude = static_cast<int32_t>(rec.baro_altitude);
+        row.geo_altitude = static_cast<int32_t>(rec.geo_altitude);
+        row.status = track_status_from_string(rec.status);
+        reload_rows_.push_back(row);
+    }
+
+    applyReloadRows();
+}
 
-        auto cursor = coll.find({}, find_opts);
-        for (auto &&doc : cursor)
+// reload_rows_'u targets_ ile uzlaştırır; reload_mutex_ tutulurken çağrılır.
+void RadarServiceImpl::applyReloadRows()
+{
+    const TrackFilterBank::Params track_params = settings().trackParams();
+    std::lock_guard<std::mutex> lock(targets_mutex_);
+    targets_.reserve(reload_rows_.size());
+    tracks_.reserve(reload_rows_.size());
+    anomalies_.reserve(reload_rows_.size());
+    geofences_.reserve(reload_rows_.size());
+    conflicts_.reserve(reload_rows_.size());
+    // Hedef başına tick'te en fazla bir Alert; tamponun tick içinde büyümesi
+    // (alarm sayısının yeni tepe yaptığı tick'lerde heap ayırma) önlenir.
+    anomaly_scratch_.reserve(reload_rows_.size());
+    targets_.beginGeneration();
+
+    for (const ReloadRow &row : reload_rows_)
+    {
+        auto acquired = targets_.acquire(row.id);
+        MovingTarget &mt = *acquired.first;
+
+        mt.velocity = row.velocity;
+        mt.baro_altitude = row.baro_altitude;
+        mt.geo_altitude = row.geo_altitude;
+        mt.status = row.status;
+
+        if (!acquired.second)
+            continue;
+
+        mt.lat = row.lat;
+        mt.lon = row.lon;
+        mt.track = tracks_.add(row.lat, row.lon, track_params);
+        mt.anomaly = anomalies_.add();
+        mt.geofence = geofences_.add();
+        mt.conflict = conflicts_.add();
+
+        // Hıza bağlı başlangıç drift miktarı
+        double deg_per_sec = (mt.velocity / 100.0) * 0.001;
+        mt.dlat = deg_per_sec * sign_rand();
+        mt.dlon = deg_per_sec * sign_rand();
+
+        // heading
+        mt.heading = std::atan2(mt.dlat, mt.dlon) * 180.0 / M_PI;
+        if (mt.heading < 0)
+            mt.heading += 360.0;
+
+        // %30 ihtimalle manevra modu
+        mt.maneuvering = (std::rand() % 100) < 30;
+
+        if (s_reload_log_limiter.allow(LogLevel::Debug))
+            Logger::instance().log(LogLevel::Debug, "TARGET_ADD", {{"oid", row.id.to_string()}});
+    }
+
+    std::size_t removed = targets_.sweep(
+        [this](const ObjectId &id, const MovingTarget &mt)
         {
-            try
-            {
-                std::string key = get_oid_string(doc);
-                if (key.empty())
-                    continue;
+            tracks_.remove(mt.track);
+            anomalies_.remove(mt.anomaly);
+            geofences_.remove(mt.geofence);
+            conflicts_.remove(mt.conflict);
+            if (s_reload_log_limiter.allow(LogLevel::Debug))
+                Logger::instance().log(LogLevel::Debug, "TARGET_DEL", {{"oid", id.to_string()}});
+        });
 
-                double lat = 0.0, lon = 0.0;
-                if (!get_double_safe(doc, "lat", lat))
-                    continue;
-                if (!get_double_safe(doc, "lon", lon))
-                    continue;
+    metrics().active_targets.set(static_cast<int64_t>(targets_.size()));
+    Logger::instance().log(LogLevel::Info, "RELOAD",
+                           {{"rows", reload_rows_.size()}, {"removed", removed}, {"active", targets_.size()}});
+}
 
-                int32_t velocity = get_int32_safe(doc, "velocity", 0);
-                int32_t baroAltitude = get_int32_safe(doc, "baroAltitude", 0);
-                int32_t geoAltitude = get_int32_safe(doc, "geoAltitude", 0);
+void RadarServiceImpl::smartLoadRadarData()
+{
+    loadRadarData();
+}
 
-                if (!is_in_tr_bbox(lat, lon))
-                    continue;
+grpc::Status RadarServiceImpl::StreamRadarTargets(
+    grpc::ServerContext *context,
+    const radar::StreamRequest *request,
+    grpc::ServerWriter<radar::RadarTarget> *writer)
+{
+    GaugeGuard stream_guard(metrics().active_streams);
 
-                MovingTarget mt;
-                mt.id = key;
-                mt.lat = lat;
-                mt.lon = lon;
-                mt.velocity = velocity;
-                mt.baro_altitude = baroAltitude;
-                mt.geo_altitude = geoAltitude;
-
-                // Hıza bağlı başlangıç drift miktarı
-                double deg_per_sec = (mt.velocity / 100.0) * 0.001;
-                mt.dlat = deg_per_sec * sign_rand();
-                mt.dlon = deg_per_sec * sign_rand();
-
-                // heading
-                mt.heading = std::atan2(mt.dlat, mt.dlon) * 180.0 / M_PI;
-                if (mt.heading < 0)
-                    mt.heading += 360.0;
-
-                // %30 ihtimalle manevra modu
-                mt.maneuvering = (std::rand() % 100) < 30;
-
-                auto it = targets_.find(key);
-                if (it != targets_.end())
-                {
-                    mt.dlat = it->second.dlat;
-                    mt.dlon = it->second.dlon;
-                    mt.move_accumulator = it->second.move_accumulator;
-                    mt.heading = it->second.heading;
-                    mt.maneuvering = it->second.maneuvering;
-                }
+    // Client aralığı dolunca sunucunun yayınladığı son tick gönderilir; aynı
+    // tick iki kez gönderilmez. İptal kontrolü için bekleme en fazla 250 ms sürer.
+    StreamState state;
+    auto next_send = std::chrono::steady_clock::now();
+    while (!context->IsCancelled())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now < next_send)
+        {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                next_send - now, std::chrono::milliseconds(250)));
+            continue;
+        }
+        {
+            std::unique_lock<std::mutex> lock(frame_mutex_);
+            if (!frame_cv_.wait_for(lock, std::chrono::milliseconds(250),
+                                    [&] { return frame_ && frame_->tick > state.tick(); }))
+                continue;
+        }
 
-                parsed.emplace(key, std::move(mt));
-                seen_ids.insert(key);
-            }
-            catch (const std::exception &e)
-            {
-                std::cerr << "Mongo parse hata: " << e.what() << std::endl;
-            }
+        sendRadarFile(writer, request, state);
+        const int interval_ms = request->refresh_interval_ms() > 0 ? request->refresh_interval_ms()
+                                                                   : setting(&RadarSettings::default_interval_ms);
+        next_send = now + std::chrono::milliseconds(interval_ms);
+    }
+    return grpc::Status::OK;
+}
+
+// ±pct yüzde aralığında rastgele oran (pct = 3 → -0.03 .. 0.03).
+static double jitter_ratio(int pct)
+{
+    return (std::rand() % (2 * pct + 1) - pct) / 100.0;
+}
+
+// Tek bir hedefi delta_s saniye ilerletir (hız/irtifa jitter'ı, manevra, heading).
+void RadarServiceImpl::advanceTarget(MovingTarget &t, double delta_s, const RadarSettings &s, const OperatingArea &area)
+{
+    t.velocity += (std::rand() % 3 - 1);
+    t.velocity += static_cast<int32_t>(t.velocity * jitter_ratio(s.velocity_jitter_pct));
+    if (t.velocity < 0)
+        t.velocity = 0;
+
+    t.baro_altitude += (std::rand() % 11 - 5);                                                  // ±5 yerine ±10
+    t.baro_altitude += static_cast<int32_t>(t.baro_altitude * jitter_ratio(s.altitude_jitter_pct));
+
+    t.geo_altitude += (std::rand() % 11 - 5);                                                 // ±5 yerine ±10
+    t.geo_altitude += static_cast<int32_t>(t.geo_altitude * jitter_ratio(s.altitude_jitter_pct));
+
+    if ((std::rand() % 100) < 20)
+    {
+        t.maneuvering = true;
+
+        if ((std::rand() % 100) < 5)
+        {
+            t.velocity += (std::rand() % 31 - 15);
+            if (t.velocity < 0)
+                t.velocity = 0;
+
+            double factor = 1.0 + ((std::rand() % 2 == 0) ? 0.007 : -0.007);
+            t.baro_altitude = static_cast<int32_t>(t.baro_altitude * factor);
+            t.geo_altitude = static_cast<int32_t>(t.geo_altitude * factor);
         }
+
+        double delta_heading = (std::rand() % 11 - 5);
+        t.heading += delta_heading;
+        if (t.heading < 0)
+            t.heading += 360.0;
+        if (t.heading >= 360.0)
+            t.heading -= 360.0;
     }
-    catch (const std::exception &e)
+    else
     {
-        std::cerr << "MongoDB bağlantı/sorgu hatası: " << e.what() << std::endl;
-        return;
+        t.maneuvering = false;
+
+        if ((std::rand() % 100) < 10)
+        {
+            double tiny_heading_change = (std::rand() % 5 - 2);
+            t.heading += tiny_heading_change;
+            if (t.heading < 0)
+                t.heading += 360.0;
+            if (t.heading >= 360.0)
+                t.heading -= 360.0;
+        }
+    }
+
+    double rad = t.heading * M_PI / 180.0;
+    t.dlat = std::sin(rad);
+    t.dlon = std::cos(rad);
+
+    if (t.velocity > 0)
+    {
+        const double k_lat = s.step_lat;
+        const double k_lon = s.step_lon;
+
+        double step_lat = t.velocity * delta_s * k_lat * t.dlat;
+        double step_lon = t.velocity * delta_s * k_lon * t.dlon;
+
+        t.lat += step_lat;
+        t.lon += step_lon;
+
+        if (!area.contains(t.lat, t.lon))
+        {
+            t.dlat = -t.dlat;
+            t.dlon = -t.dlon;
+            t.lat -= step_lat;
+            t.lon -= step_lon;
+            t.heading += 180.0;
+            if (t.heading >= 360.0)
+                t.heading -= 360.0;
+        }
+    }
+}
+
+void RadarServiceImpl::advanceTargets(double delta_s, int64_t sim_time_us)
+{
+    std::shared_ptr<const GeofenceIndex> fences;
+    std::shared_ptr<const OperatingArea> area;
+    {
+        std::lock_guard<std::mutex> lock(settings_mutex_);
+        tick_settings_ = settings_;
+        fences = geofence_index_;
+        area = area_;
     }
+    const RadarSettings &s = tick_settings_;
 
+    std::shared_ptr<AlertLog::Batch> alerts;
+    std::shared_ptr<GeofenceLog::Batch> crossings;
+    std::shared_ptr<ConflictLog::Batch> conflicts;
+    std::shared_ptr<TrajectoryPredictor::Frame> predictions;
+    std::shared_ptr<TickFrame> frame;
     {
         std::lock_guard<std::mutex> lock(targets_mutex_);
-        for (auto &kv : parsed)
+        ++motion_tick_;
+        // Anomali penceresine ve geofence üyeliğine hedefin bu tick'teki
+        // sırası (stream'deki ID<sıra>) ile birlikte yazılır.
+        uint32_t rank = 0;
+        for (auto &entry : targets_)
         {
-            const std::string &id = kv.first;
-            auto it = targets_.find(id);
-            if (it != targets_.end())
-            {
-                it->second.velocity = kv.second.velocity;
-                it->second.baro_altitude = kv.second.baro_altitude;
-                it->second.geo_altitude = kv.second.geo_altitude;
-            }
-            else
-            {
-                targets_.emplace(id, std::move(kv.second));
-                std::cout << "Target eklendi: " << id << std::endl;
-            }
+            MovingTarget &t = entry.value;
+            advanceTarget(t, delta_s, s, *area);
+            tracks_.measure(t.track, t.lat, t.lon);
+            anomalies_.measure(t.anomaly, rank, t.baro_altitude, t.geo_altitude, t.velocity, t.heading,
+                               static_cast<uint8_t>(t.status));
+            geofences_.measure(t.geofence, rank, t.lat, t.lon);
+            ++rank;
         }
-        for (auto it = targets_.begin(); it != targets_.end();)
+
+        // Ölçümler toplandıktan sonra tüm izler tek SoA geçişinde filtrelenir.
         {
-            if (seen_ids.find(it->first) == seen_ids.end())
-            {
-                std::cout << "Target silindi: " << it->first << std::endl;
-                it = targets_.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            ScopedTimer filter_timer(metrics().track_filter);
+            tracks_.step(delta_s, s.trackParams());
         }
-        std::cout << "Reloaded from MongoDB. Active targets: " << targets_.size() << std::endl;
+        // CPA, filtrenin bu tick'teki hız tahminiyle (m/s doğu / kuzey)
+        // hesaplanır; simülasyonun hız alanı ve derece adımı metre cinsinden değildir.
+        rank = 0;
+        for (const auto &entry : targets_)
+        {
+            const MovingTarget &t = entry.value;
+            const TrackFilterBank::Estimate e = tracks_.estimate(t.track);
+            conflicts_.measure(t.conflict, rank++, t.lat, t.lon, t.baro_altitude, e.vel_east, e.vel_north);
+        }
+        alerts = evaluateAnomalies(delta_s, sim_time_us, s.anomaly);
+
+        // Poligonlar değiştiyse eski üyelikler olaysız unutulur.
+        if (fences != geofence_evaluated_)
+        {
+            geofences_.reset();
+            geofence_evaluated_ = fences;
+        }
+        if (fences)
+            crossings = evaluateGeofences(sim_time_us);
+        conflicts = evaluateConflicts(sim_time_us, s.conflict);
+        // İzdüşüm filtre adımından sonraki hız / dönüş tahminini kullanır.
+        if (prediction_subscribers_.load(std::memory_order_relaxed) > 0)
+            predictions = predictTrajectories(sim_time_us, s.prediction);
+        frame = snapshotTargets(sim_time_us, static_cast<int>(std::lround(delta_s * 1000.0)));
     }
+    publishFrame(std::move(frame));
+    if (alerts)
+        alert_log_.publish(std::move(alerts));
+    if (crossings)
+        geofence_log_.publish(std::move(crossings));
+    if (conflicts)
+        conflict_log_.publish(std::move(conflicts));
+    if (predictions)
+        publishPredictions(std::move(predictions));
 }
 
-void RadarServiceImpl::smartLoadRadarData()
+std::shared_ptr<RadarServiceImpl::AlertLog::Batch> RadarServiceImpl::evaluateAnomalies(
+    double delta_s, int64_t sim_time_us, const AnomalyDetector::Params &params)
 {
-    loadRadarData();
+    ScopedTimer timer(metrics().anomaly_eval);
+    anomaly_scratch_.clear();
+    if (anomalies_.evaluate(delta_s, params, anomaly_scratch_) == 0)
+        return nullptr;
+    std::size_t fired = 0;
+    for (const AnomalyDetector::Alert &a : anomaly_scratch_)
+        fired += static_cast<std::size_t>(std::bitset<8>(a.rules).count());
+    metrics().anomaly_alerts.inc(fired);
+    // Pencereler her tick güncellenir; StreamAlerts abonesi yoksa mesajlar kurulmaz.
+    if (!alert_log_.hasSubscribers())
+        return nullptr;
+
+    auto batch = std::make_shared<AlertLog::Batch>();
+    batch->tick = motion_tick_;
+    batch->sim_time_us = sim_time_us;
+    for (const AnomalyDetector::Alert &a : anomaly_scratch_)
+    {
+        const MovingTarget &t = (targets_.begin() + a.tag)->value;
+        for (std::size_t bit = 0; bit < AnomalyDetector::kRuleCount; ++bit)
+        {
+            const auto rule = static_cast<AnomalyDetector::Rule>(1u << bit);
+            if (!(a.rules & rule))
+                continue;
+            radar::AnomalyAlert &out = batch->events.emplace_back();
+            char id[kRankIdBufSize];
+            out.set_id(id, format_rank_id(id, "ID", static_cast<int>(a.tag) + 1));
+            out.set_rule(static_cast<radar::AnomalyRule>(bit + 1));
+            out.set_value(anomalies_.value(a.slot, rule, delta_s));
+            out.set_limit(AnomalyDetector::limit(rule, params));
+            out.set_lat(t.lat);
+            out.set_lon(t.lon);
+            out.set_baro_altitude(t.baro_altitude);
+            out.set_velocity(t.velocity);
+            out.set_heading(t.heading);
+            out.set_tick(batch->tick);
+            out.set_sim_time_us(sim_time_us);
+        }
+    }
+    return batch;
 }
 
-grpc::Status RadarServiceImpl::StreamRadarTargets(
-    grpc::ServerContext *context,
-    const radar::StreamRequest *request,
-    grpc::ServerWriter<radar::RadarTarget> *writer)
+std::shared_ptr<RadarServiceImpl::GeofenceLog::Batch> RadarServiceImpl::evaluateGeofences(int64_t sim_time_us)
 {
-    int interval_ms = request->refresh_interval_ms() > 0 ? request->refresh_interval_ms() : 1000;
+    ScopedTimer timer(metrics().geofence_eval);
+    const GeofenceIndex &index = *geofence_evaluated_;
+    geofence_scratch_.clear();
+    geofences_.evaluate(index, geofence_scratch_);
+    metrics().geofence_memberships.set(static_cast<int64_t>(geofences_.memberships()));
+    metrics().geofence_events.inc(geofence_scratch_.size());
+    // Üyelikler her tick izlenir; StreamGeofenceEvents abonesi yoksa mesajlar kurulmaz.
+    if (geofence_scratch_.empty() || !geofence_log_.hasSubscribers())
+        return nullptr;
 
-    while (!context->IsCancelled())
+    auto batch = std::make_shared<GeofenceLog::Batch>();
+    batch->tick = motion_tick_;
+    batch->sim_time_us = sim_time_us;
+    batch->events.reserve(geofence_scratch_.size());
+    // Konum olaydan okunur: reload'da kaldırılan hedefin EXIT olayındaki tag'i
+    // artık targets_ içinde geçerli bir sıra değildir.
+    for (const GeofenceTracker::Event &e : geofence_scratch_)
     {
-        sendRadarFile(writer, request);
-        if (context->IsCancelled())
-            break;
-        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+        radar::GeofenceEvent &out = batch->events.emplace_back();
+        out.set_kind(e.enter ? radar::GeofenceEvent::ENTER : radar::GeofenceEvent::EXIT);
+        char id[kRankIdBufSize];
+        out.set_target_id(id, format_rank_id(id, "ID", static_cast<int>(e.tag) + 1));
+        out.set_fence_id(index.id(e.poly));
+        out.set_fence_name(index.name(e.poly));
+        out.set_lat(e.lat);
+        out.set_lon(e.lon);
+        out.set_tick(batch->tick);
+        out.set_sim_time_us(sim_time_us);
     }
-    return grpc::Status::OK;
+    return batch;
 }
 
-void RadarServiceImpl::sendRadarFile(
-    grpc::ServerWriter<radar::RadarTarget> *writer,
-    const radar::StreamRequest *request)
+std::shared_ptr<RadarServiceImpl::ConflictLog::Batch> RadarServiceImpl::evaluateConflicts(
+    int64_t sim_time_us, const ConflictDetector::Params &params)
 {
-    if (targets_.empty() || checkAndReloadData())
+    // Kapalıyken tarama yapılmaz; kapatıldığı tick'te açık çiftler için END üretilir.
+    if (params.horizontal_m <= 0.0 && conflicts_.active() == 0)
+        return nullptr;
+
+    ScopedTimer timer(metrics().conflict_eval);
+    conflict_scratch_.clear();
+    conflicts_.evaluate(params, conflict_scratch_);
+    metrics().conflicts_active.set(static_cast<int64_t>(conflicts_.active()));
+    metrics().conflict_pair_tests.set(static_cast<int64_t>(conflicts_.pairTests()));
+    metrics().conflict_events.inc(conflict_scratch_.size());
+    // Çiftler her tick izlenir; StreamConflicts abonesi yoksa mesajlar kurulmaz.
+    if (conflict_scratch_.empty() || !conflict_log_.hasSubscribers())
+        return nullptr;
+
+    auto batch = std::make_shared<ConflictLog::Batch>();
+    batch->tick = motion_tick_;
+    batch->sim_time_us = sim_time_us;
+    batch->events.reserve(conflict_scratch_.size());
+    // Konumlar olaydan okunur: reload'da kaldırılan hedefin END olayındaki
+    // tag'i artık targets_ içinde geçerli bir sıra değildir.
+    for (const ConflictDetector::Conflict &c : conflict_scratch_)
     {
-        if (targets_.empty())
-            loadRadarData();
+        radar::ConflictEvent &out = batch->events.emplace_back();
+        out.set_kind(c.start ? radar::ConflictEvent::START : radar::ConflictEvent::END);
+        char id[kRankIdBufSize];
+        out.set_target_a(id, format_rank_id(id, "ID", static_cast<int>(c.tag_a) + 1));
+        out.set_target_b(id, format_rank_id(id, "ID", static_cast<int>(c.tag_b) + 1));
+        out.set_tcpa_s(c.tcpa_s);
+        out.set_dcpa_m(c.dcpa_m);
+        out.set_range_m(c.range_m);
+        out.set_vertical_m(c.vertical_m);
+        out.set_lat_a(c.lat_a);
+        out.set_lon_a(c.lon_a);
+        out.set_lat_b(c.lat_b);
+        out.set_lon_b(c.lon_b);
+        out.set_tick(batch->tick);
+        out.set_sim_time_us(sim_time_us);
     }
+    return batch;
+}
 
-    const int interval_ms = request->refresh_interval_ms() > 0 ? request->refresh_interval_ms() : 1000;
-    const double delta_s = interval_ms / 1000.0;
+std::shared_ptr<TrajectoryPredictor::Frame> RadarServiceImpl::predictTrajectories(
+    int64_t sim_time_us, const TrajectoryPredictor::Params &params)
+{
+    ScopedTimer timer(metrics().prediction);
+    predictor_.clear();
+    predictor_.reserve(targets_.size());
+    for (const auto &entry : targets_)
+    {
+        const MovingTarget &t = entry.value;
+        const TrackFilterBank::Estimate e = tracks_.estimate(t.track);
+        predictor_.add(t.lat, t.lon, e.vel_east, e.vel_north, e.turn_rate_dps);
+    }
 
- 
+    // Yedekteki frame'i tutan stream kalmadıysa onun dizileri kullanılır;
+    // yoksa (yavaş client eski frame'i yazıyor) yeni frame ayrılır.
+    std::shared_ptr<TrajectoryPredictor::Frame> frame;
     {
-        std::lock_guard<std::mutex> lock(targets_mutex_);
-        for (auto &kv : targets_)
+        std::lock_guard<std::mutex> lock(prediction_mutex_);
+        if (prediction_spare_ && prediction_spare_.use_count() == 1)
+            frame = std::move(prediction_spare_);
+    }
+    if (!frame)
+        frame = std::make_shared<TrajectoryPredictor::Frame>();
+    frame->tick = motion_tick_;
+    frame->sim_time_us = sim_time_us;
+    predictor_.predict(params, *frame);
+    return frame;
+}
+
+void RadarServiceImpl::publishPredictions(std::shared_ptr<TrajectoryPredictor::Frame> frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(prediction_mutex_);
+        // Eşzamanlı iki tick'ten geç kalanı yayınlanmaz.
+        if (predictions_ && predictions_->tick > frame->tick)
+            return;
+        prediction_spare_ = std::move(predictions_);
+        predictions_ = std::move(frame);
+    }
+    prediction_cv_.notify_all();
+}
+
+std::shared_ptr<RadarServiceImpl::TickFrame> RadarServiceImpl::snapshotTargets(int64_t sim_time_us, int interval_ms)
+{
+    // Yedekteki frame'i tutan stream kalmadıysa onun dizileri kullanılır;
+    // yoksa (yavaş client eski frame'i yazıyor) yeni frame ayrılır.
+    std::shared_ptr<TickFrame> frame;
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex_);
+        if (frame_spare_ && frame_spare_.use_count() == 1)
+            frame = std::move(frame_spare_);
+    }
+    if (!frame)
+        frame = std::make_shared<TickFrame>();
+    frame->tick = motion_tick_;
+    frame->sim_time_us = sim_time_us;
+    frame->interval_ms = interval_ms;
+
+    std::vector<MovingTarget> &out = frame->targets;
+    out.clear();
+    out.reserve(targets_.size());
+    for (const auto &entry : targets_)
+        out.push_back(entry.value);
+
+    frame->estimates.resize(out.size());
+    for (std::size_t i = 0; i < out.size(); ++i)
+        frame->estimates[i] = tracks_.estimate(out[i].track);
+    return frame;
+}
+
+void RadarServiceImpl::publishFrame(std::shared_ptr<TickFrame> frame)
+{
+    // Izgaralar kilit dışında kurulur; yayından sonra frame salt okunurdur.
+    const std::vector<MovingTarget> &targets = frame->targets;
+    frame->grid.build(targets.size(), [&targets](std::size_t i)
+                      { return std::make_pair(targets[i].lat, targets[i].lon); });
+    frame->has_smoothed_grid = smoothed_viewports_.load(std::memory_order_relaxed) > 0;
+    if (frame->has_smoothed_grid)
+    {
+        const std::vector<TrackFilterBank::Estimate> &estimates = frame->estimates;
+        frame->smoothed_grid.build(estimates.size(), [&estimates](std::size_t i)
+                                   { return std::make_pair(estimates[i].lat, estimates[i].lon); });
+    }
+
+    frame->published = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex_);
+        // Eşzamanlı iki tick'ten (radar_bench) geç kalanı yayınlanmaz.
+        if (frame_ && frame_->tick > frame->tick)
+            return;
+        frame_spare_ = std::move(frame_);
+        frame_ = std::move(frame);
+    }
+    frame_cv_.notify_all();
+}
+
+std::shared_ptr<const RadarServiceImpl::TickFrame> RadarServiceImpl::latestFrame() const
+{
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    return frame_;
+}
+
+// Snapshot'un EPSG:3857 koordinatları tek toplu geçişte hesaplanır;
+// client'lar fromLonLat'ı hedef başına tekrar yapmaz.
+void RadarServiceImpl::projectSnapshot(StreamState &state)
+{
+    const std::vector<MovingTarget> &snapshot = state.targets();
+    state.mercator.project(snapshot.size(), [&snapshot](std::size_t i)
+                           { return std::make_pair(snapshot[i].lat, snapshot[i].lon); });
+}
+
+void RadarServiceImpl::toRadarTarget(const MovingTarget &t, int rank, radar::RadarTarget &out)
+{
+    char id[kRankIdBufSize];
+    out.set_id(id, format_rank_id(id, "ID", rank));
+    out.set_lat(t.lat);
+    out.set_lon(t.lon);
+    out.set_velocity(t.velocity);
+    out.set_baro_altitude(t.baro_altitude);
+    out.set_geo_altitude(t.geo_altitude);
+    out.set_heading(t.heading);
+}
+
+void RadarServiceImpl::toTrackState(const TrackFilterBank::Estimate &e, radar::TrackState &out)
+{
+    out.set_vel_east_mps(e.vel_east);
+    out.set_vel_north_mps(e.vel_north);
+    out.set_turn_rate_dps(e.turn_rate_dps);
+    out.set_pos_var_m2(e.pos_var);
+    out.set_pos_vel_cov(e.pos_vel_cov);
+    out.set_vel_var_m2s2(e.vel_var);
+}
+
+int64_t RadarServiceImpl::takeFrame(bool smoothed, StreamState &state)
+{
+    // Önce eski frame bırakılır ki tick thread'i onu yedekten yeniden kullanabilsin.
+    state.frame.reset();
+    state.frame = latestFrame();
+    state.smoothed = smoothed;
+    if (!state.frame)
+        return unix_micros();
+    if (!smoothed)
+        return state.frame->sim_time_us;
+
+    // Izgara, kümeler ve projeksiyon da filtrelenmiş konumu görsün diye
+    // konum stream'e özel kopyada tahminle değiştirilir.
+    const TickFrame &frame = *state.frame;
+    state.smoothed_targets = frame.targets;
+    for (std::size_t i = 0; i < frame.targets.size(); ++i)
+    {
+        state.smoothed_targets[i].lat = frame.estimates[i].lat;
+        state.smoothed_targets[i].lon = frame.estimates[i].lon;
+    }
+    return frame.sim_time_us;
+}
+
+void RadarServiceImpl::sendRadarFile(
+    grpc::ServerWriterInterface<radar::RadarTarget> *writer,
+    const radar::StreamRequest *request,
+    StreamState &state)
+{
+    ScopedTimer tick_timer(metrics().tick);
+
+    const bool smoothed = request->smoothed();
+    const int64_t sim_time_us = takeFrame(smoothed, state);
+    const uint64_t tick = state.tick();
+    const bool mercator = request->web_mercator();
+    if (mercator)
+        projectSnapshot(state);
+
+    // Tick'in mesajları stream'in arenasında kurulur ve tick sonunda topluca
+    // bırakılır; string alanlar dahil mesaj başına heap ayırması yapılmaz.
+    int rank = 0;
+    for (const MovingTarget &t : state.targets())
+    {
+        ++rank;
+        radar::RadarTarget &out = *state.arena.create<radar::RadarTarget>();
+        toRadarTarget(t, rank, out);
+        if (mercator)
         {
-            MovingTarget &t = kv.second;
+            out.set_merc_x(state.mercator.x(rank - 1));
+            out.set_merc_y(state.mercator.y(rank - 1));
+        }
+        if (smoothed)
+            toTrackState(state.frame->estimates[rank - 1], *out.mutable_track());
+        out.set_seq(++state.seq);
+        out.set_tick(tick);
+        out.set_sim_time_us(sim_time_us);
 
-          
-            t.velocity += (std::rand() % 3 - 1);
-            t.velocity += static_cast<int32_t>(t.velocity * ((std::rand() % 7 - 3) / 100.0)); // ±3% yerine ±7%
-            if (t.velocity < 0)
-                t.velocity = 0;
+        if (s_send_log_limiter.allow(LogLevel::Info))
+        {
+            Logger::instance().log(LogLevel::Info, "SEND",
+                                   {{"id", out.id()},
+                                    {"lat", out.lat()},
+                                    {"lon", out.lon()},
+                                    {"vel", out.velocity()},
+                                    {"heading", out.heading()},
+                                    {"baro_alt", out.baro_altitude()},
+                                    {"geo_alt", out.geo_altitude()},
+                                    {"maneuver", t.maneuvering}});
+        }
+
+        out.set_enqueue_time_us(unix_micros());
+        const auto write_start = std::chrono::steady_clock::now();
+        const bool written = writer->Write(out);
+        metrics().write.record(std::chrono::steady_clock::now() - write_start);
+        metrics().tick_to_write.record(micros_since(sim_time_us, unix_micros()));
 
-           
-            t.baro_altitude += (std::rand() % 11 - 5);                                                  // ±5 yerine ±10
-            t.baro_altitude += static_cast<int32_t>(t.baro_altitude * ((std::rand() % 7 - 3) / 100.0)); // ±3%
+        if (!written)
+        {
+            metrics().frames_dropped.inc();
+            Logger::instance().log(LogLevel::Info, "SEND", {{"msg", "Writer kapandı, client ayrıldı"}});
+            break;
+        }
+        metrics().messages_sent.inc();
+    }
 
-            t.geo_altitude += (std::rand() % 11 - 5);                                                 // ±5 yerine ±10
-            t.geo_altitude += static_cast<int32_t>(t.geo_altitude * ((std::rand() % 7 - 3) / 100.0)); // ±3%
+    state.arena.reset();
+}
 
-          
-            if ((std::rand() % 100) < 20)
-            {
-                t.maneuvering = true;
+bool RadarServiceImpl::sendViewportFrame(ViewportStream *stream, const radar::Viewport &viewport, bool advance,
+                                         StreamState &state, ViewportState &view)
+{
+    ScopedTimer frame_timer(metrics().viewport_frame);
 
-                if ((std::rand() % 100) < 5)
-                {
-                    t.velocity += (std::rand() % 31 - 15); 
-                    if (t.velocity < 0)
-                        t.velocity = 0;
+    int64_t sim_time_us;
+    if (advance)
+        sim_time_us = takeFrame(viewport.smoothed(), state);
+    else
+        sim_time_us = unix_micros();
 
-                    double factor = 1.0 + ((std::rand() % 2 == 0) ? 0.007 : -0.007); 
-                    t.baro_altitude = static_cast<int32_t>(t.baro_altitude * factor);
-                    t.geo_altitude = static_cast<int32_t>(t.geo_altitude * factor);
-                }
+    const std::vector<MovingTarget> &snapshot = state.targets();
+    bool ok = true;
+    auto write = [&](const radar::TargetEvent &ev)
+    {
+        const auto write_start = std::chrono::steady_clock::now();
+        ok = stream->Write(ev);
+        metrics().write.record(std::chrono::steady_clock::now() - write_start);
+        if (ok)
+        {
+            metrics().messages_sent.inc();
+            metrics().viewport_events.inc();
+        }
+        return ok;
+    };
 
-                
-                double delta_heading = (std::rand() % 11 - 5);
-                t.heading += delta_heading;
-                if (t.heading < 0)
-                    t.heading += 360.0;
-                if (t.heading >= 360.0)
-                    t.heading -= 360.0;
-            }
-            else
+    // Hedef kimliği tam stream'deki gibi snapshot sırasıdır (rank = indeks + 1).
+    auto emit = [&](radar::TargetEvent::Kind kind, uint32_t index)
+    {
+        radar::TargetEvent &ev = *state.arena.create<radar::TargetEvent>();
+        ev.set_kind(kind);
+        radar::RadarTarget &out = *ev.mutable_target();
+        if (kind == radar::TargetEvent::LEAVE)
+        {
+            char id[kRankIdBufSize];
+            out.set_id(id, format_rank_id(id, "ID", static_cast<int>(index) + 1));
+        }
+        else
+        {
+            toRadarTarget(snapshot[index], static_cast<int>(index) + 1, out);
+            if (viewport.web_mercator())
             {
-                t.maneuvering = false;
+                out.set_merc_x(state.mercator.x(index));
+                out.set_merc_y(state.mercator.y(index));
+            }
+            if (viewport.smoothed())
+                toTrackState(state.frame->estimates[index], *out.mutable_track());
+        }
+        out.set_seq(++state.seq);
+        out.set_tick(state.tick());
+        out.set_sim_time_us(sim_time_us);
+        out.set_enqueue_time_us(unix_micros());
+        return write(ev);
+    };
+
+    const int zoom = std::clamp(viewport.zoom(), 0, ClusterGrid::kMaxZoom);
+    auto emit_cluster_remove = [&](uint64_t key)
+    {
+        if (!ok)
+            return;
+        radar::TargetEvent &ev = *state.arena.create<radar::TargetEvent>();
+        ev.set_kind(radar::TargetEvent::CLUSTER_REMOVE);
+        char id[32];
+        ev.mutable_cluster()->set_id(id, ClusterGrid::formatId(id, key));
+        if (write(ev))
+            metrics().cluster_events.inc();
+    };
+
+    const bool clustered = viewport.cluster() == radar::CLUSTER_ON ||
+                           (viewport.cluster() == radar::CLUSTER_AUTO && zoom <= setting(&RadarSettings::cluster_max_zoom));
+    if (clustered)
+    {
+        // Hedef modundan geçişte client'taki tekil hedefler silinir.
+        for (std::size_t i = 0; ok && i < view.previous.size(); ++i)
+            emit(radar::TargetEvent::LEAVE, view.previous[i]);
+        view.previous.clear();
+
+        auto point = [&snapshot](std::size_t i)
+        { return ClusterGrid::Point{snapshot[i].lat, snapshot[i].lon, snapshot[i].status}; };
+        // Reload'da hedef eklenip çıkınca indeksler kayar; update() bunu hücre
+        // değişimi gibi işlediğinden sadece sayı değişiminde baştan kurulur.
+        if (view.clusters.zoom() != zoom || view.clusters.points() != snapshot.size())
+            view.clusters.rebuild(zoom, snapshot.size(), point);
+        else
+            view.clusters.update(point);
 
-               
-                if ((std::rand() % 100) < 10)
+        view.clusters.collect(
+            viewport.min_lat(), viewport.min_lon(), viewport.max_lat(), viewport.max_lon(),
+            [&](uint64_t key, const ClusterGrid::Cluster &c)
+            {
+                if (!ok)
+                    return;
+                radar::TargetEvent &ev = *state.arena.create<radar::TargetEvent>();
+                ev.set_kind(radar::TargetEvent::CLUSTER_UPDATE);
+                radar::Cluster &out = *ev.mutable_cluster();
+                char id[32];
+                out.set_id(id, ClusterGrid::formatId(id, key));
+                out.set_lat(c.lat());
+                out.set_lon(c.lon());
+                out.set_count(c.count);
+                out.set_dominant_status(track_status_name(c.dominant()));
+                out.set_zoom(zoom);
+                if (viewport.web_mercator())
                 {
-                    double tiny_heading_change = (std::rand() % 5 - 2); 
-                    t.heading += tiny_heading_change;
-                    if (t.heading < 0)
-                        t.heading += 360.0;
-                    if (t.heading >= 360.0)
-                        t.heading -= 360.0;
+                    double x, y;
+                    web_mercator_project(c.lat(), c.lon(), x, y);
+                    out.set_merc_x(x);
+                    out.set_merc_y(y);
                 }
+                if (write(ev))
+                    metrics().cluster_events.inc();
+            },
+            emit_cluster_remove);
+
+        state.arena.reset();
+        if (!ok)
+        {
+            metrics().frames_dropped.inc();
+            return false;
+        }
+        return true;
+    }
+
+    // Kümelenmiş moddan çıkışta client'taki kümeler silinir.
+    view.clusters.clear(emit_cluster_remove);
+
+    // Izgara tick frame'inde tüm görünüm stream'leri için bir kez kurulur.
+    // Frame snapshot'la aynı konumları (ham ya da smoothed) görmelidir.
+    view.visible.clear();
+    if (state.frame)
+    {
+        const SpatialGrid *grid = &state.frame->grid;
+        if (state.smoothed)
+        {
+            grid = &state.frame->smoothed_grid;
+            if (!state.frame->has_smoothed_grid)
+            {
+                view.grid.build(snapshot.size(), [&snapshot](std::size_t i)
+                                { return std::make_pair(snapshot[i].lat, snapshot[i].lon); });
+                grid = &view.grid;
+            }
+        }
+        grid->query(viewport.min_lat(), viewport.min_lon(), viewport.max_lat(), viewport.max_lon(),
+                    [&view](uint32_t i) { view.visible.push_back(i); });
+    }
+    std::sort(view.visible.begin(), view.visible.end());
+    if (viewport.web_mercator())
+        projectSnapshot(state);
+
+    // İki sıralı listenin birleşimi ENTER/UPDATE/LEAVE ayrımını verir.
+    std::size_t a = 0;
+    std::size_t b = 0;
+    while (ok && (a < view.previous.size() || b < view.visible.size()))
+    {
+        if (b == view.visible.size() || (a < view.previous.size() && view.previous[a] < view.visible[b]))
+            emit(radar::TargetEvent::LEAVE, view.previous[a++]);
+        else if (a == view.previous.size() || view.visible[b] < view.previous[a])
+            emit(radar::TargetEvent::ENTER, view.visible[b++]);
+        else
+        {
+            emit(radar::TargetEvent::UPDATE, view.visible[b++]);
+            ++a;
+        }
+    }
+
+    state.arena.reset();
+    if (!ok)
+    {
+        metrics().frames_dropped.inc();
+        return false;
+    }
+
+    view.previous.swap(view.visible);
+    return true;
+}
+
+grpc::Status RadarServiceImpl::SubscribeViewport(
+    grpc::ServerContext *context,
+    grpc::ServerReaderWriter<radar::TargetEvent, radar::Viewport> *stream)
+{
+    GaugeGuard stream_guard(metrics().viewport_streams);
+
+    // Client pan/zoom yaptıkça yeni Viewport yazar. Okuma ayrı thread'de
+    // yapılır; tick döngüsü her turda en son görünümü kullanır ve görünüm
+    // değişince interval'i beklemeden yeni görünümü gönderir.
+    std::mutex vp_mutex;
+    std::condition_variable vp_cv;
+    radar::Viewport viewport;
+    uint64_t vp_version = 0;
+    bool reader_done = false;
+
+    std::thread reader([&]()
+                       {
+        radar::Viewport next;
+        while (stream->Read(&next))
+        {
+            if (next.min_lat() > next.max_lat())
+            {
+                const double t = next.min_lat();
+                next.set_min_lat(next.max_lat());
+                next.set_max_lat(t);
+            }
+            if (next.min_lon() > next.max_lon())
+            {
+                const double t = next.min_lon();
+                next.set_min_lon(next.max_lon());
+                next.set_max_lon(t);
             }
+            Logger::instance().log(LogLevel::Debug, "VIEWPORT",
+                                   {{"min_lat", next.min_lat()},
+                                    {"min_lon", next.min_lon()},
+                                    {"max_lat", next.max_lat()},
+                                    {"max_lon", next.max_lon()},
+                                    {"zoom", next.zoom()}});
+            std::lock_guard<std::mutex> lock(vp_mutex);
+            viewport = next;
+            ++vp_version;
+            vp_cv.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(vp_mutex);
+        reader_done = true;
+        vp_cv.notify_one(); });
 
-          
-            double rad = t.heading * M_PI / 180.0;
-            t.dlat = std::sin(rad);
-            t.dlon = std::cos(rad);
+    StreamState state;
+    ViewportState view;
+    uint64_t sent_version = 0;
+    bool counted_smoothed = false;
+    auto next_tick = std::chrono::steady_clock::now();
 
-           
-            if (t.velocity > 0)
+    while (!context->IsCancelled())
+    {
+        // Client aralığı dolduğunda sunucu henüz yeni tick yayınlamadıysa
+        // sıradaki tick'in beklenen anına kadar uyunur. Frame beklerken
+        // tutulmaz; tick thread'i yedeği yeniden kullanabilsin.
+        const auto now = std::chrono::steady_clock::now();
+        bool fresh = false;
+        auto due = next_tick;
+        {
+            const std::shared_ptr<const TickFrame> latest = latestFrame();
+            fresh = latest && latest->tick > state.tick();
+            if (!fresh && due <= now)
+                due = latest ? std::max(latest->published + std::chrono::milliseconds(latest->interval_ms),
+                                        now + std::chrono::milliseconds(5))
+                             : now + std::chrono::milliseconds(250);
+        }
+
+        radar::Viewport current;
+        bool advance = false;
+        {
+            std::unique_lock<std::mutex> lock(vp_mutex);
+            // İptal kontrolü için bekleme en fazla 250 ms sürer.
+            const auto wake = std::min(due, now + std::chrono::milliseconds(250));
+            vp_cv.wait_until(lock, wake, [&]
+                             { return vp_version != sent_version || reader_done; });
+
+            // Client görünüm göndermeden yazma ucunu kapattıysa yayın yapılmaz.
+            if (vp_version == 0)
             {
-                const double k_lat = 0.00002;
-                const double k_lon = 0.00002;
+                if (reader_done)
+                    break;
+                continue;
+            }
 
-                double step_lat = t.velocity * delta_s * k_lat * t.dlat;
-                double step_lon = t.velocity * delta_s * k_lon * t.dlon;
+            advance = fresh && std::chrono::steady_clock::now() >= next_tick;
+            if (!advance && vp_version == sent_version)
+                continue;
+            current = viewport;
+            sent_version = vp_version;
+        }
 
-                t.lat += step_lat;
-                t.lon += step_lon;
+        // Smoothed ızgara, abone sayılınca sonraki tick'ten itibaren frame'de kurulur.
+        if (current.smoothed() != counted_smoothed)
+        {
+            counted_smoothed = current.smoothed();
+            if (counted_smoothed)
+                ++smoothed_viewports_;
+            else
+                --smoothed_viewports_;
+        }
 
-              
-                if (!is_in_tr_bbox(t.lat, t.lon))
+        if (!sendViewportFrame(stream, current, advance, state, view))
+        {
+            Logger::instance().log(LogLevel::Info, "VIEWPORT", {{"msg", "Writer kapandı, client ayrıldı"}});
+            break;
+        }
+        if (advance)
+        {
+            const int interval_ms = current.refresh_interval_ms() > 0 ? current.refresh_interval_ms()
+                                                                      : setting(&RadarSettings::default_interval_ms);
+            next_tick = std::chrono::steady_clock::now() + std::chrono::milliseconds(interval_ms);
+        }
+    }
+
+    // Okuyucu hâlâ Read'de bekliyorsa çağrıyı iptal ederek serbest bırakılır.
+    {
+        std::lock_guard<std::mutex> lock(vp_mutex);
+        if (!reader_done)
+            context->TryCancel();
+    }
+    reader.join();
+    if (counted_smoothed)
+        --smoothed_viewports_;
+    return grpc::Status::OK;
+}
+
+template <typename Msg, typename KeepFn>
+void RadarServiceImpl::streamEvents(grpc::ServerContext *context, grpc::ServerWriter<Msg> *writer,
+                                    EventLog<Msg> &log, KeepFn &&keep, const char *tag)
+{
+    // Sadece abone olunduktan sonraki olaylar gönderilir.
+    const typename EventLog<Msg>::Subscription subscription(log);
+    uint64_t sent = log.last();
+    uint64_t seq = 0;
+    std::vector<std::shared_ptr<const typename EventLog<Msg>::Batch>> pending;
+    while (!context->IsCancelled())
+    {
+        pending.clear();
+        // İptal kontrolü için bekleme en fazla 250 ms sürer.
+        log.collect(sent, std::chrono::milliseconds(250), pending);
+        if (pending.empty())
+            continue;
+        if (pending.front()->seq > sent + 1)
+            metrics().event_batches_skipped.inc(pending.front()->seq - sent - 1);
+
+        for (const auto &batch : pending)
+        {
+            for (const Msg &event : batch->events)
+            {
+                if (!keep(event))
+                    continue;
+                Msg out = event;
+                out.set_seq(++seq);
+                out.set_enqueue_time_us(unix_micros());
+                const auto write_start = std::chrono::steady_clock::now();
+                const bool written = writer->Write(out);
+                metrics().write.record(std::chrono::steady_clock::now() - write_start);
+                if (!written)
                 {
-                    t.dlat = -t.dlat;
-                    t.dlon = -t.dlon;
-                    t.lat -= step_lat;
-                    t.lon -= step_lon;
-                    t.heading += 180.0;
-                    if (t.heading >= 360.0)
-                        t.heading -= 360.0;
+                    Logger::instance().log(LogLevel::Info, tag, {{"msg", "Writer kapandı, client ayrıldı"}});
+                    return;
                 }
+                metrics().messages_sent.inc();
             }
+            sent = batch->seq;
         }
     }
+}
+
+grpc::Status RadarServiceImpl::StreamAlerts(
+    grpc::ServerContext *context,
+    const radar::AlertRequest *request,
+    grpc::ServerWriter<radar::AnomalyAlert> *writer)
+{
+    GaugeGuard stream_guard(metrics().alert_streams);
+
+    uint32_t rules = 0;
+    for (int rule : request->rules())
+        if (rule >= 1 && rule <= static_cast<int>(AnomalyDetector::kRuleCount))
+            rules |= 1u << (rule - 1);
+    if (rules == 0)
+        rules = AnomalyDetector::kAllRules;
+
+    streamEvents(context, writer, alert_log_, [rules](const radar::AnomalyAlert &a)
+                 { return (rules & (1u << (a.rule() - 1))) != 0; },
+                 "ALERT");
+    return grpc::Status::OK;
+}
 
-    std::vector<MovingTarget> snapshot;
+grpc::Status RadarServiceImpl::StreamGeofenceEvents(
+    grpc::ServerContext *context,
+    const radar::GeofenceRequest *request,
+    grpc::ServerWriter<radar::GeofenceEvent> *writer)
+{
+    GaugeGuard stream_guard(metrics().geofence_streams);
+
+    // Filtre kısa bir liste; olay başına doğrusal arama yeterli.
+    const std::vector<std::string> fences(request->fences().begin(), request->fences().end());
+    streamEvents(context, writer, geofence_log_, [&fences](const radar::GeofenceEvent &e)
+                 { return fences.empty() || std::find(fences.begin(), fences.end(), e.fence_id()) != fences.end(); },
+                 "GEOFENCE");
+    return grpc::Status::OK;
+}
+
+grpc::Status RadarServiceImpl::StreamConflicts(
+    grpc::ServerContext *context,
+    const radar::ConflictRequest *request,
+    grpc::ServerWriter<radar::ConflictEvent> *writer)
+{
+    GaugeGuard stream_guard(metrics().conflict_streams);
+
+    const double max_tcpa_s = request->max_tcpa_s();
+    streamEvents(context, writer, conflict_log_, [max_tcpa_s](const radar::ConflictEvent &e)
+                 { return max_tcpa_s <= 0.0 || e.kind() == radar::ConflictEvent::END || e.tcpa_s() <= max_tcpa_s; },
+                 "CONFLICT");
+    return grpc::Status::OK;
+}
+
+bool RadarServiceImpl::sendPredictionFrame(grpc::ServerWriterInterface<radar::TargetPrediction> *writer,
+                                           const radar::PredictionRequest &request,
+                                           const std::vector<uint32_t> &ranks,
+                                           const TrajectoryPredictor::Frame &frame, FrameArena &arena, uint64_t &seq)
+{
+    uint32_t steps = frame.steps;
+    if (request.horizon_s() > 0.0)
+        steps = std::min<uint32_t>(steps, static_cast<uint32_t>(std::floor(request.horizon_s() / frame.step_s + 1e-9)));
+    const bool straight = request.model() != radar::PREDICT_TURN;
+    const bool turn = request.model() != radar::PREDICT_STRAIGHT;
+
+    auto send = [&](uint32_t i)
     {
-        std::lock_guard<std::mutex> lock(targets_mutex_);
-        snapshot.reserve(targets_.size());
-        for (auto &kv : targets_)
-            snapshot.push_back(kv.second);
+        radar::TargetPrediction &out = *arena.create<radar::TargetPrediction>();
+        char id[kRankIdBufSize];
+        out.set_id(id, format_rank_id(id, "ID", static_cast<int>(i) + 1));
+        out.set_lat(frame.lat[i]);
+        out.set_lon(frame.lon[i]);
+        out.set_vel_east_mps(frame.vel_east[i]);
+        out.set_vel_north_mps(frame.vel_north[i]);
+        out.set_turn_rate_dps(frame.turn_rate_dps[i]);
+        out.mutable_offset_s()->Reserve(static_cast<int>(steps));
+        for (uint32_t k = 0; k < steps; ++k)
+            out.add_offset_s(frame.offset(k));
+        if (straight)
+        {
+            radar::PredictedPath &path = *out.mutable_straight();
+            path.mutable_lat()->Reserve(static_cast<int>(steps));
+            path.mutable_lon()->Reserve(static_cast<int>(steps));
+            for (uint32_t k = 0; k < steps; ++k)
+            {
+                path.add_lat(frame.lineLat(k, i));
+                path.add_lon(frame.lineLon(k, i));
+            }
+        }
+        if (turn)
+        {
+            radar::PredictedPath &path = *out.mutable_turn();
+            path.mutable_lat()->Reserve(static_cast<int>(steps));
+            path.mutable_lon()->Reserve(static_cast<int>(steps));
+            for (uint32_t k = 0; k < steps; ++k)
+            {
+                path.add_lat(frame.turnLat(k, i));
+                path.add_lon(frame.turnLon(k, i));
+            }
+        }
+        out.set_seq(++seq);
+        out.set_tick(frame.tick);
+        out.set_sim_time_us(frame.sim_time_us);
+
+        out.set_enqueue_time_us(unix_micros());
+        const auto write_start = std::chrono::steady_clock::now();
+        const bool written = writer->Write(out);
+        metrics().write.record(std::chrono::steady_clock::now() - write_start);
+        if (written)
+            metrics().messages_sent.inc();
+        return written;
+    };
+
+    bool ok = true;
+    if (ranks.empty())
+    {
+        for (uint32_t i = 0; ok && i < frame.count; ++i)
+            ok = send(i);
+    }
+    else
+    {
+        for (uint32_t i : ranks)
+        {
+            if (i >= frame.count)
+                break;
+            if (!(ok = send(i)))
+                break;
+        }
     }
+    arena.reset();
+    return ok;
+}
 
+grpc::Status RadarServiceImpl::StreamPredictions(
+    grpc::ServerContext *context,
+    const radar::PredictionRequest *request,
+    grpc::ServerWriter<radar::TargetPrediction> *writer)
+{
+    GaugeGuard stream_guard(metrics().prediction_streams);
 
-    int rank = 0;
-    for (const MovingTarget &t : snapshot)
+    // Kimlikler 0 tabanlı sıraya çevrilir; frame'de sıra sırasıyla aranır.
+    std::vector<uint32_t> ranks;
+    ranks.reserve(request->ids_size());
+    for (const std::string &id : request->ids())
     {
-        ++rank;
-        std::ostringstream oss;
-        oss << "ID" << std::setw(3) << std::setfill('0') << rank;
-
-        radar::RadarTarget out;
-        out.set_id(oss.str());
-        out.set_lat(t.lat);
-        out.set_lon(t.lon);
-        out.set_velocity(t.velocity);
-        out.set_baro_altitude(t.baro_altitude);
-        out.set_geo_altitude(t.geo_altitude);
-        out.set_heading(t.heading);
-
-        std::cout << "[SEND] ID: " << out.id()
-                  << " | Lat: " << out.lat()
-                  << " | Lon: " << out.lon()
-                  << " | Vel: " << out.velocity()
-                  << " | Heading: " << out.heading()
-                  << " | BaroAlt: " << out.baro_altitude()
-                  << " | GeoAlt: " << out.geo_altitude()
-                  << " | Maneuver: " << (t.maneuvering ? "YES" : "NO")
-                  << std::endl;
-
-        if (!writer->Write(out))
-        {
-            std::cerr << "Writer kapandı, client ayrıldı.\n";
+        int rank = 0;
+        if (!parse_rank_id(id, "ID", rank))
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "geçersiz hedef kimliği: " + id);
+        ranks.push_back(static_cast<uint32_t>(rank - 1));
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+    ++prediction_subscribers_;
+    FrameArena arena;
+    uint64_t seq = 0;
+    uint64_t sent_tick = 0;
+    while (!context->IsCancelled())
+    {
+        // İptal kontrolü için bekleme en fazla 250 ms sürer. Abone olunca
+        // mevcut frame hemen gönderilir.
+        std::shared_ptr<const TrajectoryPredictor::Frame> frame;
+        {
+            std::unique_lock<std::mutex> lock(prediction_mutex_);
+            prediction_cv_.wait_for(lock, std::chrono::milliseconds(250),
+                                    [&] { return predictions_ && predictions_->tick > sent_tick; });
+            if (predictions_ && predictions_->tick > sent_tick)
+                frame = predictions_;
+        }
+        if (!frame)
+            continue;
+        if (sent_tick != 0 && frame->tick > sent_tick + 1)
+            metrics().prediction_frames_skipped.inc(frame->tick - sent_tick - 1);
+
+        if (!sendPredictionFrame(writer, *request, ranks, *frame, arena, seq))
+        {
+            Logger::instance().log(LogLevel::Info, "PREDICT", {{"msg", "Writer kapandı, client ayrıldı"}});
             break;
         }
+        sent_tick = frame->tick;
+    }
+
+    // Son abone ayrılınca frame'ler bırakılır; sonraki abone ilk tick'i bekler.
+    if (--prediction_subscribers_ == 0)
+    {
+        std::lock_guard<std::mutex> lock(prediction_mutex_);
+        predictions_.reset();
+        prediction_spare_.reset();
     }
+    return grpc::Status::OK;
 }
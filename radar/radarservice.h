@@ -2,30 +2,116 @@
 #define RADARSERVICE_H
 
 #include "radar.grpc.pb.h"
+#include "anomalydetector.h"
+#include "clustergrid.h"
+#include "conflictdetector.h"
+#include "eventlog.h"
+#include "framearena.h"
+#include "geofence.h"
+#include "operatingarea.h"
+#include "spatialgrid.h"
+#include "targettable.h"
+#include "trackfilter.h"
+#include "tracksource.h"
+#include "trajectorypredictor.h"
+#include "webmercator.h"
 #include <grpcpp/grpcpp.h>
 
 #include <string>
 #include <vector>
+#include <atomic>
+#include <condition_variable>
 #include <ctime>
-#include <unordered_map>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <chrono>
 #include <cstdint>
 
-#include <bsoncxx/document/view.hpp>
-#include <bsoncxx/types.hpp>
+class Config;
+
+// Çalışma anında (SIGHUP) değiştirilebilen simülasyon ayarları; config'te radar.*.
+struct RadarSettings
+{
+    int reload_period_s = 5;        // Mongo/kaynak yeniden okuma aralığı
+    int default_interval_ms = 1000; // sunucu tick aralığı; client refresh_interval_ms vermezse gönderim aralığı
+    int velocity_jitter_pct = 3;    // tick başına hız oynaması (±%)
+    int altitude_jitter_pct = 3;    // tick başına irtifa oynaması (±%)
+    double step_lat = 0.00002;      // hız * saniye başına enlem adımı (derece)
+    double step_lon = 0.00002;      // hız * saniye başına boylam adımı (derece)
+    int cluster_max_zoom = 7;       // CLUSTER_AUTO görünümlerde bu zoom'a kadar kümelenir
+    double track_meas_sigma_m = 50.0; // iz filtresi: konum ölçümü gürültüsü (metre)
+    double track_accel_sigma = 3.0;   // iz filtresi: süreç gürültüsü (m/s^2)
+    AnomalyDetector::Params anomaly;  // radar.anomaly_* kuralları ve eşikleri
+    std::string geofence_path = "project.root/data/shapes.geojson"; // boşsa geofence olayı üretilmez
+    ConflictDetector::Params conflict; // radar.conflict_* ayrım eşikleri ve bakış süresi
+    TrajectoryPredictor::Params prediction; // radar.prediction_* nokta aralığı ve ufuk
+
+    static RadarSettings fromConfig(const Config &cfg);
+    TrackFilterBank::Params trackParams() const;
+};
 
 class RadarServiceImpl final : public radar::RadarService::Service
 {
+    friend struct RadarBenchAccess;
+
 public:
     explicit RadarServiceImpl(std::string mongo_uri = "mongodb://localhost:27017",
                               std::string db_name = "aewc",
                               std::string coll_name = "radar");
+    explicit RadarServiceImpl(std::unique_ptr<TrackSource> source);
+    ~RadarServiceImpl() override;
+
+    // Sunucu tick thread'ini başlatır / durdurur. Tick radar.default_interval_ms
+    // aralıkla hedefleri bir kez ilerletir, iz filtresi, anomali, geofence,
+    // çatışma ve izdüşüm adımlarını çalıştırır ve snapshot'ı yayınlar.
+    // Stream'ler yalnızca yayınlanan snapshot'ı ve olay loglarını okur;
+    // client sayısı tick sayısını değiştirmez.
+    void start();
+    void stop();
 
     grpc::Status StreamRadarTargets(
         grpc::ServerContext *context,
         const radar::StreamRequest *request,
         grpc::ServerWriter<radar::RadarTarget> *writer) override;
 
+    grpc::Status SubscribeViewport(
+        grpc::ServerContext *context,
+        grpc::ServerReaderWriter<radar::TargetEvent, radar::Viewport> *stream) override;
+
+    grpc::Status StreamAlerts(
+        grpc::ServerContext *context,
+        const radar::AlertRequest *request,
+        grpc::ServerWriter<radar::AnomalyAlert> *writer) override;
+
+    grpc::Status StreamGeofenceEvents(
+        grpc::ServerContext *context,
+        const radar::GeofenceRequest *request,
+        grpc::ServerWriter<radar::GeofenceEvent> *writer) override;
+
+    grpc::Status StreamConflicts(
+        grpc::ServerContext *context,
+        const radar::ConflictRequest *request,
+        grpc::ServerWriter<radar::ConflictEvent> *writer) override;
+
+    grpc::Status StreamPredictions(
+        grpc::ServerContext *context,
+        const radar::PredictionRequest *request,
+        grpc::ServerWriter<radar::TargetPrediction> *writer) override;
+
+    // Sonraki tick'ten itibaren geçerli olur.
+    void configure(const RadarSettings &settings);
+    RadarSettings settings() const;
+
+    // GeoJSON poligonlarını yükler; sonraki hareket adımından itibaren
+    // hedeflerin giriş/çıkışı izlenir. Boş yol geofence'leri kaldırır. Dosya
+    // okunamazsa önceki poligonlar kullanılmaya devam eder.
+    bool loadGeofences(const std::string &path);
+
+    // Kayıt kabul ve hedef sekme alanı (config area.path); sonraki reload ve
+    // hareket adımından itibaren geçerli olur. Varsayılan sabit Türkiye kutusu.
+    void setOperatingArea(std::shared_ptr<const OperatingArea> area);
+
     bool checkAndReloadData();
     void loadRadarData();
     void smartLoadRadarData();
@@ -33,7 +119,6 @@ public:
 private:
     struct MovingTarget
     {
-        std::string id;
         double lat = 0.0;
         double lon = 0.0;
         int32_t velocity = 0;
@@ -46,24 +131,206 @@ private:
 
         double heading = 0.0;
         bool maneuvering = false;
+        TrackStatus status = TrackStatus::Unknown;
+        uint32_t track = TrackFilterBank::kNoSlot; // tracks_ içindeki filtre slotu
+        uint32_t anomaly = AnomalyDetector::kNoSlot; // anomalies_ içindeki pencere slotu
+        uint32_t geofence = GeofenceTracker::kNoSlot; // geofences_ içindeki üyelik slotu
+        uint32_t conflict = ConflictDetector::kNoSlot; // conflicts_ içindeki slot
+    };
+
+    // Bir sunucu tick'inin hedefleri ve stream sırasıyla filtre tahminleri;
+    // tüm StreamRadarTargets / SubscribeViewport çağrıları aynı frame'i okur.
+    struct TickFrame
+    {
+        uint64_t tick = 0;
+        int64_t sim_time_us = 0;
+        std::chrono::steady_clock::time_point published; // sonraki tick ~published + interval_ms
+        int interval_ms = 0;
+        std::vector<MovingTarget> targets;
+        std::vector<TrackFilterBank::Estimate> estimates;
+        // Görünüm stream'lerinin salt okunur paylaştığı ızgaralar; yayından
+        // önce tick thread'inde bir kez kurulur. Filtre konumlarının ızgarası
+        // sadece smoothed görünüm abonesi varken kurulur.
+        SpatialGrid grid;
+        SpatialGrid smoothed_grid;
+        bool has_smoothed_grid = false;
     };
 
-    void sendRadarFile(grpc::ServerWriter<radar::RadarTarget> *writer,
-                       const radar::StreamRequest *request);
+    // Stream başına gönderim durumu: RadarTarget.seq sayacı, son gönderilen
+    // tick frame'i, tick'ler arasında yeniden kullanılan arena, (smoothed
+    // isteyenler için) konumu filtre tahminiyle değiştirilmiş kopya ve
+    // (web_mercator isteyenler için) projeksiyon tamponu.
+    struct StreamState
+    {
+        uint64_t seq = 0;
+        FrameArena arena;
+        std::shared_ptr<const TickFrame> frame;
+        bool smoothed = false;
+        std::vector<MovingTarget> smoothed_targets;
+        MercatorFrame mercator;
+
+        uint64_t tick() const { return frame ? frame->tick : 0; }
+        const std::vector<MovingTarget> &targets() const
+        {
+            static const std::vector<MovingTarget> empty;
+            return !frame ? empty : smoothed ? smoothed_targets : frame->targets;
+        }
+    };
+
+    // Görünüm aboneliği durumu: frame'de smoothed ızgara yokken (abone bu
+    // tick'te smoothed'a geçti) kurulan yedek ızgara, önceki/şimdiki frame'de
+    // görünen hedeflerin sıralı snapshot indeksleri ve kümelenmiş modda
+    // artımlı güncellenen kümeler.
+    struct ViewportState
+    {
+        SpatialGrid grid;
+        std::vector<uint32_t> visible;
+        std::vector<uint32_t> previous;
+        ClusterGrid clusters;
+    };
 
-    static std::string get_string_utf8(const bsoncxx::document::view &v, const char *key, const std::string &def = {});
-    static bool get_double_safe(const bsoncxx::document::view &v, const char *key, double &out);
-    static int32_t get_int32_safe(const bsoncxx::document::view &v, const char *key, int32_t def = 0);
-    static std::string get_oid_string(const bsoncxx::document::view &v);
-    static bool is_in_tr_bbox(double lat, double lon);
+    using AlertLog = EventLog<radar::AnomalyAlert>;
+    using GeofenceLog = EventLog<radar::GeofenceEvent>;
+    using ConflictLog = EventLog<radar::ConflictEvent>;
+
+    using ViewportStream = grpc::ServerReaderWriterInterface<radar::TargetEvent, radar::Viewport>;
+
+    // ServerWriterInterface: radar_bench gRPC'siz sahte writer ile çağırır.
+    void sendRadarFile(grpc::ServerWriterInterface<radar::RadarTarget> *writer,
+                       const radar::StreamRequest *request,
+                       StreamState &state);
+
+    // Sunucu tick'i: reload kontrolü + advanceTargets. Tick thread'i ve
+    // radar_bench çağırır.
+    void tick(double delta_s);
+    void runTicks();
+    std::shared_ptr<const TickFrame> latestFrame() const;
+    // Son yayınlanan frame'i stream'e alır; tick'in sim_time_us'unu döner.
+    // smoothed ise konumlar filtre tahminiyle değiştirilmiş kopyadan okunur.
+    int64_t takeFrame(bool smoothed, StreamState &state);
+
+    // Görünümdeki hedefler için ENTER/UPDATE/LEAVE olaylarını, kümelenmiş
+    // modda CLUSTER_UPDATE/CLUSTER_REMOVE olaylarını yazar. advance false ise
+    // (client pan yaptı) yeni tick alınmaz, son snapshot yeniden sorgulanır.
+    // Yazma başarısızsa false döner.
+    bool sendViewportFrame(ViewportStream *stream, const radar::Viewport &viewport, bool advance,
+                           StreamState &state, ViewportState &view);
+
+    // Tick'in ve loadRadarData'nın adımları; radar_bench bunları ayrı ayrı ölçer.
+    static void advanceTarget(MovingTarget &t, double delta_s, const RadarSettings &s, const OperatingArea &area);
+    void advanceTargets(double delta_s, int64_t sim_time_us);
+    // targets_mutex_ tutulurken: anomali kurallarını / geofence üyeliklerini / çatışmaları
+    // değerlendirir, yeni olay varsa yayınlanacak batch'i döner.
+    std::shared_ptr<AlertLog::Batch> evaluateAnomalies(double delta_s, int64_t sim_time_us,
+                                                       const AnomalyDetector::Params &params);
+    std::shared_ptr<GeofenceLog::Batch> evaluateGeofences(int64_t sim_time_us);
+    std::shared_ptr<ConflictLog::Batch> evaluateConflicts(int64_t sim_time_us, const ConflictDetector::Params &params);
+    // targets_mutex_ tutulurken: tüm hedeflerin izdüşümünü (önceki tick'ten
+    // boşa çıkan frame'in dizileriyle) hesaplar; publishPredictions kilitsiz yayınlar.
+    std::shared_ptr<TrajectoryPredictor::Frame> predictTrajectories(int64_t sim_time_us,
+                                                                    const TrajectoryPredictor::Params &params);
+    void publishPredictions(std::shared_ptr<TrajectoryPredictor::Frame> frame);
+    // Frame'in istenen hedeflerini (ranks boşsa hepsini, 0 tabanlı sıra) yazar;
+    // yazma başarısızsa false döner.
+    static bool sendPredictionFrame(grpc::ServerWriterInterface<radar::TargetPrediction> *writer,
+                                    const radar::PredictionRequest &request, const std::vector<uint32_t> &ranks,
+                                    const TrajectoryPredictor::Frame &frame, FrameArena &arena, uint64_t &seq);
+
+    // EventLog batch'lerini stream'e yazar; keep(msg) false olanlar atlanır.
+    template <typename Msg, typename KeepFn>
+    void streamEvents(grpc::ServerContext *context, grpc::ServerWriter<Msg> *writer, EventLog<Msg> &log,
+                      KeepFn &&keep, const char *tag);
+    // targets_mutex_ tutulurken: hedefleri ve tahminleri (önceki tick'lerden
+    // boşa çıkan frame'in dizileriyle) frame'e kopyalar; publishFrame kilitsiz yayınlar.
+    std::shared_ptr<TickFrame> snapshotTargets(int64_t sim_time_us, int interval_ms);
+    void publishFrame(std::shared_ptr<TickFrame> frame);
+    static void projectSnapshot(StreamState &state);
+    static void toRadarTarget(const MovingTarget &t, int rank, radar::RadarTarget &out);
+    static void toTrackState(const TrackFilterBank::Estimate &e, radar::TrackState &out);
+    void applyReloadRows();
+
+    std::shared_ptr<const OperatingArea> operatingArea() const;
     static int sign_rand();
 
-    std::string mongo_uri_;
-    std::string db_name_;
-    std::string coll_name_;
+    // settings_'ten tek alan. settings() kopyası geofence_path'i de kopyalar
+    // (heap ayırma); tick ve gönderim yolları bunu kullanır.
+    template <typename T>
+    T setting(T RadarSettings::*field) const
+    {
+        std::lock_guard<std::mutex> lock(settings_mutex_);
+        return settings_.*field;
+    }
+
+    std::unique_ptr<TrackSource> source_;
 
-    std::unordered_map<std::string, MovingTarget> targets_;
+    RadarSettings settings_;
+    // advanceTargets'ın tick başına kopyası; yalnız tick yolunda kullanılır.
+    // Atama string kapasitesini koruduğundan ısınmadan sonra heap ayırmaz.
+    RadarSettings tick_settings_;
+    std::shared_ptr<const GeofenceIndex> geofence_index_;
+    std::shared_ptr<const OperatingArea> area_ = std::make_shared<OperatingArea>();
+    mutable std::mutex settings_mutex_;
+
+    // Reload sırasında Mongo'dan okunan satırlar; her turda yeniden kullanılır.
+    struct ReloadRow
+    {
+        ObjectId id;
+        double lat = 0.0;
+        double lon = 0.0;
+        int32_t velocity = 0;
+        int32_t baro_altitude = 0;
+        int32_t geo_altitude = 0;
+        TrackStatus status = TrackStatus::Unknown;
+    };
+
+    TargetTable<MovingTarget> targets_;
+    TrackFilterBank tracks_; // targets_ ile aynı kilit altında
+    uint64_t motion_tick_ = 0; // advanceTargets sayacı; alarm ve geofence olaylarının tick'i
+    AnomalyDetector anomalies_;
+    std::vector<AnomalyDetector::Alert> anomaly_scratch_;
     std::mutex targets_mutex_;
+
+    GeofenceTracker geofences_;
+    std::shared_ptr<const GeofenceIndex> geofence_evaluated_; // geofences_ üyeliklerinin index'i
+    std::vector<GeofenceTracker::Event> geofence_scratch_;
+
+    ConflictDetector conflicts_;
+    std::vector<ConflictDetector::Conflict> conflict_scratch_;
+
+    TrajectoryPredictor predictor_; // targets_ ile aynı kilit altında
+
+    AlertLog alert_log_;
+    GeofenceLog geofence_log_;
+    ConflictLog conflict_log_;
+
+    // Son hareket adımının tahmin frame'i; tüm StreamPredictions çağrıları
+    // paylaşır. Sadece abone varken hesaplanır. Hiçbir stream'in tutmadığı
+    // önceki frame yedekte bekler, sonraki tick'te dizileri yeniden kullanılır.
+    std::atomic<int> prediction_subscribers_{0};
+
+    // Smoothed görünüm aboneleri; sayı sıfırdan büyükken tick frame'i filtre
+    // konumlarının ızgarasını da kurar.
+    std::atomic<int> smoothed_viewports_{0};
+    std::shared_ptr<TrajectoryPredictor::Frame> predictions_;
+    std::shared_ptr<TrajectoryPredictor::Frame> prediction_spare_;
+    std::mutex prediction_mutex_;
+    std::condition_variable prediction_cv_;
+
+    // Son sunucu tick'inin frame'i; yedek, hiçbir stream'in tutmadığı
+    // önceki frame'dir ve sonraki tick'te dizileri yeniden kullanılır.
+    std::shared_ptr<TickFrame> frame_;
+    std::shared_ptr<TickFrame> frame_spare_;
+    mutable std::mutex frame_mutex_;
+    std::condition_variable frame_cv_;
+
+    std::thread tick_thread_;
+    bool stopping_ = false;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+
+    std::vector<TrackRecord> source_rows_;
+    std::vector<ReloadRow> reload_rows_;
+    std::mutex reload_mutex_;
     std::time_t last_reload_check_ = 0;
 };
 
@@ -0,0 +1,208 @@
+#ifndef TARGETTABLE_H
+#define TARGETTABLE_H
+
+#include "objectid.h"
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Açık adreslemeli (linear probing) düz hash tablosu.
+// Değerler yoğun bir vector'de tutulur, böylece tick döngüsü bellekte
+// ardışık yürür; indeks tablosu sadece {entry indeksi, hash} çiftleridir.
+// Silme: entries_ tarafında swap-remove, slot tarafında backward-shift
+// (mezar taşı yok).
+//
+// Reload farkı için nesil sayacı kullanılır: beginGeneration() sonrasında
+// acquire() ile dokunulan her kayıt güncel nesle işaretlenir, sweep() ise
+// işaretlenmeyenleri siler. Ayrı bir "görülen id" kümesine gerek kalmaz.
+template <typename T>
+class TargetTable
+{
+public:
+    struct Entry
+    {
+        ObjectId key;
+        uint32_t generation = 0;
+        T value{};
+    };
+
+    using iterator = typename std::vector<Entry>::iterator;
+    using const_iterator = typename std::vector<Entry>::const_iterator;
+
+    bool empty() const { return entries_.empty(); }
+    std::size_t size() const { return entries_.size(); }
+
+    iterator begin() { return entries_.begin(); }
+    iterator end() { return entries_.end(); }
+    const_iterator begin() const { return entries_.begin(); }
+    const_iterator end() const { return entries_.end(); }
+
+    void reserve(std::size_t n)
+    {
+        entries_.reserve(n);
+        if (n * 2 > slots_.size())
+            rehash(n * 2);
+    }
+
+    void clear()
+    {
+        entries_.clear();
+        for (Slot &s : slots_)
+            s.index = kEmpty;
+    }
+
+    T *find(const ObjectId &key)
+    {
+        if (slots_.empty())
+            return nullptr;
+        std::size_t pos = find_slot(key, key.hash());
+        return pos == kNotFound ? nullptr : &entries_[slots_[pos].index].value;
+    }
+
+    // Yeni bir reload turu başlatır.
+    uint32_t beginGeneration() { return ++generation_; }
+
+    // Kaydı bulur ya da varsayılan değerle ekler ve güncel nesle işaretler.
+    // second == true ise kayıt yeni eklenmiştir.
+    std::pair<T *, bool> acquire(const ObjectId &key)
+    {
+        const uint64_t h = key.hash();
+        if (!slots_.empty())
+        {
+            std::size_t pos = find_slot(key, h);
+            if (pos != kNotFound)
+            {
+                Entry &e = entries_[slots_[pos].index];
+                e.generation = generation_;
+                return {&e.value, false};
+            }
+        }
+
+        if ((entries_.size() + 1) * 2 > slots_.size())
+            rehash((entries_.size() + 1) * 2);
+
+        const uint32_t idx = static_cast<uint32_t>(entries_.size());
+        entries_.push_back(Entry{key, generation_, T{}});
+        insert_slot(idx, static_cast<uint32_t>(h));
+        return {&entries_.back().value, true};
+    }
+
+    bool erase(const ObjectId &key)
+    {
+        if (slots_.empty())
+            return false;
+        std::size_t pos = find_slot(key, key.hash());
+        if (pos == kNotFound)
+            return false;
+        erase_at(pos);
+        return true;
+    }
+
+    // Güncel nesle işaretlenmemiş kayıtları siler; silinen her kayıt için
+    // on_erase(key, value) çağrılır. Silinen kayıt sayısını döner.
+    template <typename F>
+    std::size_t sweep(F &&on_erase)
+    {
+        std::size_t removed = 0;
+        // Sondan başa yürü: swap-remove ile öne taşınan kayıt zaten kontrol edildi.
+        for (std::size_t i = entries_.size(); i-- > 0;)
+        {
+            if (entries_[i].generation == generation_)
+                continue;
+            on_erase(entries_[i].key, entries_[i].value);
+            erase_at(find_index_slot(entries_[i].key, static_cast<uint32_t>(i)));
+            ++removed;
+        }
+        return removed;
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t index;
+        uint32_t hash;
+    };
+
+    static constexpr uint32_t kEmpty = 0xFFFFFFFFu;
+    static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
+
+    std::size_t mask() const { return slots_.size() - 1; }
+
+    std::size_t find_slot(const ObjectId &key, uint64_t h) const
+    {
+        const uint32_t h32 = static_cast<uint32_t>(h);
+        for (std::size_t pos = h32 & mask();; pos = (pos + 1) & mask())
+        {
+            const Slot &s = slots_[pos];
+            if (s.index == kEmpty)
+                return kNotFound;
+            if (s.hash == h32 && entries_[s.index].key == key)
+                return pos;
+        }
+    }
+
+    // entries_[index]'i gösteren slotu bulur.
+    std::size_t find_index_slot(const ObjectId &key, uint32_t index) const
+    {
+        for (std::size_t pos = static_cast<uint32_t>(key.hash()) & mask();; pos = (pos + 1) & mask())
+        {
+            if (slots_[pos].index == index)
+                return pos;
+        }
+    }
+
+    void insert_slot(uint32_t index, uint32_t h32)
+    {
+        std::size_t pos = h32 & mask();
+        while (slots_[pos].index != kEmpty)
+            pos = (pos + 1) & mask();
+        slots_[pos] = Slot{index, h32};
+    }
+
+    void erase_at(std::size_t pos)
+    {
+        const uint32_t idx = slots_[pos].index;
+
+        // Backward-shift: zincirdeki sonraki kayıtları boşluğa kaydır.
+        std::size_t hole = pos;
+        for (std::size_t j = (hole + 1) & mask(); slots_[j].index != kEmpty; j = (j + 1) & mask())
+        {
+            const std::size_t home = slots_[j].hash & mask();
+            if (((j - home) & mask()) >= ((j - hole) & mask()))
+            {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole].index = kEmpty;
+
+        // Swap-remove: son kaydı boşalan yere taşı ve slotunu güncelle.
+        const uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+        if (idx != last)
+        {
+            slots_[find_index_slot(entries_[last].key, last)].index = idx;
+            entries_[idx] = std::move(entries_[last]);
+        }
+        entries_.pop_back();
+    }
+
+    void rehash(std::size_t min_slots)
+    {
+        std::size_t cap = 16;
+        while (cap < min_slots)
+            cap <<= 1;
+        slots_.assign(cap, Slot{kEmpty, 0});
+        for (uint32_t i = 0; i < entries_.size(); ++i)
+            insert_slot(i, static_cast<uint32_t>(entries_[i].key.hash()));
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<Slot> slots_;
+    uint32_t generation_ = 0;
+};
+
+#endif
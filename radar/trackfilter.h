@@ -0,0 +1,210 @@
+#ifndef TRACKFILTER_H
+#define TRACKFILTER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hedef başına sabit hız / sabit dönüş (CV/CT) Kalman filtresi, SoA düzeninde.
+//
+// Durum hedefin ilk ölçümünü orijin alan yerel düzlemde tutulur (metre,
+// x doğu / y kuzey): konum, hız ve dönüş hızı omega. İki eksen aynı ölçüm
+// ve süreç gürültüsünü paylaştığından kovaryans iki eksende aynıdır ve eksen
+// başına 2x2 blok (p_pp, p_pv, p_vv) olarak bir kez tutulur. CT adımı hız
+// vektörünü omega * dt kadar döndürür; dönmenin kovaryansa getirdiği eksenler
+// arası çapraz terimler ihmal edilir. omega, ardışık hız tahminleri
+// arasındaki açıdan üstel ortalamayla tahmin edilir.
+//
+// step() tüm slotlar üzerinde dalsız tek döngüdür ve GCC -O3 ile vektörlenir;
+// boş slotlar da (sıfır değerlerle) hesaplanır, döngüde koşul yoktur.
+class TrackFilterBank
+{
+public:
+    static constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+
+    struct Params
+    {
+        double meas_sigma_m = 50.0;  // konum ölçümü standart sapması
+        double accel_sigma = 3.0;    // süreç gürültüsü (m/s^2, beyaz ivme)
+        double turn_alpha = 0.1;     // omega üstel ortalama katsayısı (büyük değerde geri besleme salınır)
+        double init_speed_sigma = 300.0; // yeni izin hız belirsizliği (m/s)
+    };
+
+    // Tek iz için dışarı verilen tahmin; kovaryans eksen başınadır.
+    struct Estimate
+    {
+        double lat = 0.0;
+        double lon = 0.0;
+        double vel_east = 0.0;
+        double vel_north = 0.0;
+        double turn_rate_dps = 0.0;
+        double pos_var = 0.0;
+        double pos_vel_cov = 0.0;
+        double vel_var = 0.0;
+    };
+
+    void reserve(std::size_t n)
+    {
+        for (std::vector<double> *v : arrays())
+            v->reserve(n);
+    }
+
+    // Yeni iz: ilk ölçüm orijin, hız sıfır ve belirsiz.
+    uint32_t add(double lat, double lon, const Params &p)
+    {
+        uint32_t slot;
+        if (!free_.empty())
+        {
+            slot = free_.back();
+            free_.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(x_.size());
+            for (std::vector<double> *v : arrays())
+                v->push_back(0.0);
+        }
+        lat0_[slot] = lat;
+        lon0_[slot] = lon;
+        m_per_deg_lon_[slot] = kMetersPerDegree * std::max(std::cos(lat * kDegToRad), 0.01);
+        p_pp_[slot] = p.meas_sigma_m * p.meas_sigma_m;
+        p_vv_[slot] = p.init_speed_sigma * p.init_speed_sigma;
+        ++active_;
+        return slot;
+    }
+
+    void remove(uint32_t slot)
+    {
+        if (slot == kNoSlot || slot >= x_.size())
+            return;
+        for (std::vector<double> *v : arrays())
+            (*v)[slot] = 0.0;
+        free_.push_back(slot);
+        --active_;
+    }
+
+    // Bu adımın konum ölçümü (derece).
+    void measure(uint32_t slot, double lat, double lon)
+    {
+        if (slot == kNoSlot)
+            return;
+        zx_[slot] = (lon - lon0_[slot]) * m_per_deg_lon_[slot];
+        zy_[slot] = (lat - lat0_[slot]) * kMetersPerDegree;
+    }
+
+    // Tüm izler için tahmin (CT) + ölçüm güncellemesi, dt saniye.
+    void step(double dt, const Params &p)
+    {
+        stepKernel(x_.size(), dt, p, x_.data(), y_.data(), vx_.data(), vy_.data(), omega_.data(),
+                   p_pp_.data(), p_pv_.data(), p_vv_.data(), zx_.data(), zy_.data());
+    }
+
+    Estimate estimate(uint32_t slot) const
+    {
+        Estimate e;
+        if (slot == kNoSlot || slot >= x_.size())
+            return e;
+        e.lat = lat0_[slot] + y_[slot] / kMetersPerDegree;
+        e.lon = lon0_[slot] + x_[slot] / m_per_deg_lon_[slot];
+        e.vel_east = vx_[slot];
+        e.vel_north = vy_[slot];
+        e.turn_rate_dps = omega_[slot] / kDegToRad;
+        e.pos_var = p_pp_[slot];
+        e.pos_vel_cov = p_pv_[slot];
+        e.vel_var = p_vv_[slot];
+        return e;
+    }
+
+    std::size_t size() const { return active_; }
+    std::size_t capacity() const { return x_.size(); }
+
+private:
+    static constexpr double kDegToRad = 3.14159265358979323846 / 180.0;
+    static constexpr double kMetersPerDegree = 6371008.8 * kDegToRad;
+
+    // Diziler __restrict parametre olarak verilir; üye vector'leri üzerinden
+    // yazılan döngüde GCC diziyi çalışma anında alias kontrolüne sokmak
+    // zorunda kalıp (sınır 10) vektörlemeden vazgeçiyordu.
+    static void stepKernel(std::size_t n, double dt, const Params &p,
+                           double *__restrict x, double *__restrict y,
+                           double *__restrict vx, double *__restrict vy, double *__restrict omega,
+                           double *__restrict p_pp, double *__restrict p_pv, double *__restrict p_vv,
+                           const double *__restrict zx, const double *__restrict zy)
+    {
+        const double q = p.accel_sigma * p.accel_sigma;
+        const double q_pp = q * dt * dt * dt * dt * 0.25;
+        const double q_pv = q * dt * dt * dt * 0.5;
+        const double q_vv = q * dt * dt;
+        const double r = p.meas_sigma_m * p.meas_sigma_m;
+        const double inv_dt = 1.0 / dt;
+        const double alpha = p.turn_alpha;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // CT: hız omega*dt döner (küçük açı serisi); konum ortalama hızla ilerler.
+            const double th = omega[i] * dt;
+            const double th2 = th * th;
+            const double c = 1.0 - th2 * (0.5 - th2 * (1.0 / 24.0));
+            const double s = th * (1.0 - th2 * (1.0 / 6.0) * (1.0 - th2 * (1.0 / 20.0)));
+            const double vx0 = vx[i];
+            const double vy0 = vy[i];
+            const double vxp = c * vx0 - s * vy0;
+            const double vyp = s * vx0 + c * vy0;
+            const double xp = x[i] + 0.5 * dt * (vx0 + vxp);
+            const double yp = y[i] + 0.5 * dt * (vy0 + vyp);
+
+            const double pp = p_pp[i] + dt * (2.0 * p_pv[i] + dt * p_vv[i]) + q_pp;
+            const double pv = p_pv[i] + dt * p_vv[i] + q_pv;
+            const double vv = p_vv[i] + q_vv;
+
+            // Ölçüm güncellemesi (sadece konum gözlenir).
+            const double inv_s = 1.0 / (pp + r);
+            const double k_p = pp * inv_s;
+            const double k_v = pv * inv_s;
+            const double ix = zx[i] - xp;
+            const double iy = zy[i] - yp;
+            const double vx1 = vxp + k_v * ix;
+            const double vy1 = vyp + k_v * iy;
+            x[i] = xp + k_p * ix;
+            y[i] = yp + k_p * iy;
+            vx[i] = vx1;
+            vy[i] = vy1;
+            p_pp[i] = (1.0 - k_p) * pp;
+            p_pv[i] = (1.0 - k_p) * pv;
+            p_vv[i] = vv - k_v * pv;
+
+            // Dönüş hızı: önceki ve yeni hız vektörü arasındaki açının sinüsü / dt
+            // (hızlar yakınken 2|a||b| ~ |a|^2 + |b|^2, kök gerekmez). |sin| <= 1
+            // olduğundan omega * dt en fazla 1 radyandır. Hız tahmini henüz
+            // belirsizken (p_vv, hızın karesine göre büyük) ortalamaya az katılır.
+            const double cross = vx0 * vy1 - vy0 * vx1;
+            const double v0_2 = vx0 * vx0 + vy0 * vy0;
+            const double v1_2 = vx1 * vx1 + vy1 * vy1;
+            const double sin_turn = 2.0 * cross / (v0_2 + v1_2 + 1e-9);
+            const double confidence = v1_2 / (v1_2 + 4.0 * p_vv[i] + 1e-9);
+            omega[i] += alpha * confidence * (sin_turn * inv_dt - omega[i]);
+        }
+    }
+
+    std::array<std::vector<double> *, 13> arrays()
+    {
+        return {&lat0_, &lon0_, &m_per_deg_lon_, &x_, &y_, &vx_, &vy_, &omega_,
+                &p_pp_, &p_pv_, &p_vv_, &zx_, &zy_};
+    }
+
+    // Yerel düzlemin orijini ve boylam ölçeği (slot eklenirken sabitlenir).
+    std::vector<double> lat0_, lon0_, m_per_deg_lon_;
+    // Durum ve eksen başına kovaryans.
+    std::vector<double> x_, y_, vx_, vy_, omega_;
+    std::vector<double> p_pp_, p_pv_, p_vv_;
+    // Bu adımın ölçümü (yerel metre).
+    std::vector<double> zx_, zy_;
+
+    std::vector<uint32_t> free_;
+    std::size_t active_ = 0;
+};
+
+#endif
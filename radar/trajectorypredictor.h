@@ -0,0 +1,185 @@
+#ifndef TRAJECTORYPREDICTOR_H
+#define TRAJECTORYPREDICTOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Tüm hedeflerin ölü hesap (dead-reckoning) izdüşümü, SoA düzeninde.
+//
+// Her hedef için iki model hesaplanır: sabit hız (düz çizgi) ve sabit dönüş
+// (hız vektörü omega ile döner, yay boyunca ilerler). Girdi iz filtresinin
+// hız ve dönüş hızı tahminidir; noktalar step_s aralıkla horizon_s'e kadar
+// (varsayılan 10 s adımla 12 nokta; 30/60/120 s bu noktaların arasındadır).
+//
+// Sonuç bir Frame'e yazılır ve tick boyunca tüm client'larca paylaşılır.
+// Düz çizgi zamanla doğrusal olduğundan hedef başına iki hızla (derece/s)
+// tutulur. Dönüş noktaları nokta-öncelikli saklanır (dizi[k * count + i]);
+// adım döngüsü hedefler üzerinde dalsızdır ve vektörlenir. sin/cos hedef
+// başına bir kez, adım döngüsünden önce hesaplanır.
+class TrajectoryPredictor
+{
+public:
+    struct Params
+    {
+        double step_s = 10.0;     // polyline noktaları arası süre
+        double horizon_s = 120.0; // son nokta bu süreyi aşmaz
+    };
+
+    // Bir tick'in tahminleri; k. nokta (k + 1) * step_s saniye sonrasıdır.
+    // Dönüş noktaları başlangıca göre derece farkıdır (float 120 s içinde
+    // santimetre mertebesinde hassasiyet verir, belleği yarıya indirir).
+    struct Frame
+    {
+        uint64_t tick = 0;
+        int64_t sim_time_us = 0;
+        uint32_t count = 0; // hedef sayısı (stream sırası)
+        uint32_t steps = 0; // hedef başına nokta
+        double step_s = 0.0;
+        std::vector<double> lat, lon; // başlangıç konumu
+        std::vector<float> vel_east, vel_north, turn_rate_dps;
+        std::vector<double> line_vlat, line_vlon; // sabit hız, derece/s
+        std::vector<float> turn_dlat, turn_dlon;  // sabit dönüş
+
+        double offset(uint32_t k) const { return (k + 1) * step_s; }
+        std::size_t at(uint32_t k, uint32_t i) const { return static_cast<std::size_t>(k) * count + i; }
+        double lineLat(uint32_t k, uint32_t i) const { return lat[i] + line_vlat[i] * offset(k); }
+        double lineLon(uint32_t k, uint32_t i) const { return lon[i] + line_vlon[i] * offset(k); }
+        double turnLat(uint32_t k, uint32_t i) const { return lat[i] + turn_dlat[at(k, i)]; }
+        double turnLon(uint32_t k, uint32_t i) const { return lon[i] + turn_dlon[at(k, i)]; }
+    };
+
+    static uint32_t steps(const Params &p)
+    {
+        return static_cast<uint32_t>(std::max(1.0, std::floor(p.horizon_s / p.step_s + 1e-9)));
+    }
+
+    // Girdi dizilerini temizler; her tick add() ile stream sırasında doldurulur.
+    void clear()
+    {
+        lat_.clear();
+        lon_.clear();
+        ve_.clear();
+        vn_.clear();
+        omega_.clear();
+    }
+
+    void reserve(std::size_t n)
+    {
+        for (std::vector<double> *v : {&lat_, &lon_, &ve_, &vn_, &omega_})
+            v->reserve(n);
+    }
+
+    // Hız m/s (doğu, kuzey), dönüş hızı derece/s (pozitif: saat yönünün tersi).
+    void add(double lat, double lon, double vel_east, double vel_north, double turn_rate_dps)
+    {
+        lat_.push_back(lat);
+        lon_.push_back(lon);
+        ve_.push_back(vel_east);
+        vn_.push_back(vel_north);
+        omega_.push_back(turn_rate_dps * kDegToRad);
+    }
+
+    std::size_t size() const { return lat_.size(); }
+
+    // Frame'i (yeniden kullanılabilir; kapasitesi korunur) eklenen hedeflerle doldurur.
+    void predict(const Params &p, Frame &out)
+    {
+        const std::size_t n = lat_.size();
+        const uint32_t steps = TrajectoryPredictor::steps(p);
+        const double dt = p.step_s;
+        out.count = static_cast<uint32_t>(n);
+        out.steps = steps;
+        out.step_s = dt;
+        out.lat = lat_;
+        out.lon = lon_;
+        out.vel_east.resize(n);
+        out.vel_north.resize(n);
+        out.turn_rate_dps.resize(n);
+        out.line_vlat.resize(n);
+        out.line_vlon.resize(n);
+        out.turn_dlat.resize(n * steps);
+        out.turn_dlon.resize(n * steps);
+
+        for (std::vector<double> *v : {&deg_per_m_lon_, &rot_c_, &rot_s_, &arc_s_, &arc_c_, &x_, &y_, &vx_, &vy_})
+            v->resize(n);
+
+        // Hedef başına sabitler: boylam ölçeği ve bir adımlık dönüş / yay katsayıları.
+        // v(t) = R(omega t) v0 olduğundan bir adımdaki yer değiştirme
+        // [S -C; C S] v, S = sin(th)/omega, C = (1 - cos(th))/omega.
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            deg_per_m_lon_[i] = 1.0 / (kMetersPerDegree * std::max(std::cos(lat_[i] * kDegToRad), 0.01));
+            out.line_vlat[i] = vn_[i] * kDegPerMeter;
+            out.line_vlon[i] = ve_[i] * deg_per_m_lon_[i];
+            const double th = omega_[i] * dt;
+            const double c = std::cos(th);
+            const double s = std::sin(th);
+            rot_c_[i] = c;
+            rot_s_[i] = s;
+            if (std::fabs(th) < 1e-4)
+            {
+                arc_s_[i] = dt * (1.0 - th * th * (1.0 / 6.0));
+                arc_c_[i] = dt * th * 0.5;
+            }
+            else
+            {
+                arc_s_[i] = s / omega_[i];
+                arc_c_[i] = (1.0 - c) / omega_[i];
+            }
+            x_[i] = 0.0;
+            y_[i] = 0.0;
+            vx_[i] = ve_[i];
+            vy_[i] = vn_[i];
+            out.vel_east[i] = static_cast<float>(ve_[i]);
+            out.vel_north[i] = static_cast<float>(vn_[i]);
+            out.turn_rate_dps[i] = static_cast<float>(omega_[i] / kDegToRad);
+        }
+
+        for (uint32_t k = 0; k < steps; ++k)
+        {
+            const std::size_t base = static_cast<std::size_t>(k) * n;
+            stepKernel(n, deg_per_m_lon_.data(), rot_c_.data(), rot_s_.data(), arc_s_.data(), arc_c_.data(),
+                       x_.data(), y_.data(), vx_.data(), vy_.data(),
+                       out.turn_dlat.data() + base, out.turn_dlon.data() + base);
+        }
+    }
+
+private:
+    static constexpr double kDegToRad = 3.14159265358979323846 / 180.0;
+    static constexpr double kMetersPerDegree = 6371008.8 * kDegToRad;
+    static constexpr double kDegPerMeter = 1.0 / kMetersPerDegree;
+
+    // Tek adım, tüm hedefler. Diziler TrackFilterBank::stepKernel'deki gibi
+    // __restrict verilir; aksi halde GCC alias kontrolünden vazgeçip vektörlemez.
+    static void stepKernel(std::size_t n, const double *__restrict deg_per_m_lon,
+                           const double *__restrict rot_c, const double *__restrict rot_s,
+                           const double *__restrict arc_s, const double *__restrict arc_c,
+                           double *__restrict x, double *__restrict y,
+                           double *__restrict vx, double *__restrict vy,
+                           float *__restrict turn_dlat, float *__restrict turn_dlon)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double vx0 = vx[i];
+            const double vy0 = vy[i];
+            const double xi = x[i] + arc_s[i] * vx0 - arc_c[i] * vy0;
+            const double yi = y[i] + arc_c[i] * vx0 + arc_s[i] * vy0;
+            x[i] = xi;
+            y[i] = yi;
+            vx[i] = rot_c[i] * vx0 - rot_s[i] * vy0;
+            vy[i] = rot_s[i] * vx0 + rot_c[i] * vy0;
+            turn_dlat[i] = static_cast<float>(yi * kDegPerMeter);
+            turn_dlon[i] = static_cast<float>(xi * deg_per_m_lon[i]);
+        }
+    }
+
+    // Girdi (add) ve hedef başına adım sabitleri / yay durumu; tick'ler arasında yeniden kullanılır.
+    std::vector<double> lat_, lon_, ve_, vn_, omega_;
+    std::vector<double> deg_per_m_lon_, rot_c_, rot_s_, arc_s_, arc_c_;
+    std::vector<double> x_, y_, vx_, vy_;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Tick başına paralel adımlar için kalıcı iş parçacıkları. run(n, fn)
+// fn(0)'ı çağıran thread'de, fn(1..n-1)'i bekleyen işçilerde çalıştırır ve
+// hepsi bitene kadar döner. Her tick'te thread oluşturup join etmenin
+// maliyeti (thread başına onlarca µs) olmaz. fn istisna fırlatmamalıdır.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(unsigned workers)
+    {
+        threads_.reserve(workers);
+        for (unsigned i = 0; i < workers; ++i)
+            threads_.emplace_back(&WorkerPool::loop, this, i + 1);
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (std::thread &t : threads_)
+            t.join();
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    unsigned workers() const { return static_cast<unsigned>(threads_.size()); }
+
+    // n en fazla workers() + 1 olur; n <= 1 ise fn(0) doğrudan çağrılır.
+    template <typename Fn>
+    void run(unsigned n, Fn &&fn)
+    {
+        n = std::min(n, workers() + 1);
+        if (n <= 1)
+        {
+            fn(0u);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            call_ = [](void *ctx, unsigned index)
+            { (*static_cast<std::remove_reference_t<Fn> *>(ctx))(index); };
+            ctx_ = &fn;
+            active_ = n;
+            pending_ = n - 1;
+            ++generation_;
+        }
+        start_cv_.notify_all();
+        fn(0u);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    void loop(unsigned index)
+    {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_)
+                return;
+            seen = generation_;
+            // Bu turda kullanılmayan işçi sonraki turu bekler.
+            if (index >= active_)
+                continue;
+            void (*call)(void *, unsigned) = call_;
+            void *ctx = ctx_;
+            lock.unlock();
+            call(ctx, index);
+            lock.lock();
+            if (--pending_ == 0)
+                done_cv_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    void (*call_)(void *, unsigned) = nullptr;
+    void *ctx_ = nullptr;
+    unsigned active_ = 0;
+    unsigned pending_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+
+#endif
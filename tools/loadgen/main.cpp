@@ -0,0 +1,410 @@
+// Radar / IFF / DataLink servisleri için yük üreteci.
+// Her servise N eşzamanlı stream açar; mesaj/s, bayt/s, ilk mesaja kadar
+// geçen süre, mesajlar arası gecikme ve sunucunun bastığı enqueue_time_us'a
+// göre uçtan uca gecikme yüzdeliklerini raporlar; seq boşluklarını sayar.
+// Uçtan uca ölçüm için loadgen ile sunucuların saatleri senkron olmalıdır.
+//
+//   loadgen --service all --streams 50 --duration 60 --report rapor.json
+//   loadgen --service radar --viewport 39.65,32.45,40.15,33.15   (SubscribeViewport)
+
+#include "metrics.h"
+#include "timeutil.h"
+
+#include "radar.grpc.pb.h"
+#include "iff.grpc.pb.h"
+#include "datalink.grpc.pb.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+struct Options
+{
+    bool radar = true;
+    bool iff = true;
+    bool datalink = true;
+    int streams = 10;
+    int duration_s = 30;
+    int interval_ms = 1000;
+    std::string radar_addr = "localhost:50053";
+    std::string iff_addr = "localhost:50051";
+    std::string datalink_addr = "localhost:50052";
+    std::string report_path;
+    bool share_channel = false;
+    bool use_viewport = false; // radar: StreamRadarTargets yerine SubscribeViewport
+    radar::Viewport viewport;
+    bool web_mercator = false; // radar: merc_x/merc_y iste
+    bool smoothed = false;     // radar: Kalman tahmini + TrackState iste
+};
+
+struct ServiceStats
+{
+    explicit ServiceStats(std::string n) : name(std::move(n)) {}
+
+    std::string name;
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> streams_opened{0};
+    std::atomic<uint64_t> stream_errors{0};
+    std::atomic<uint64_t> seq_gaps{0}; // stream içinde atlanan seq sayısı
+    Histogram first_message; // stream açılışından ilk mesaja
+    Histogram gap;           // aynı stream'de ardışık mesajlar arası
+    Histogram end_to_end;    // sunucu enqueue_time_us → client Read
+    Histogram age;           // sunucu sim_time_us → client Read
+};
+
+void usage()
+{
+    std::cout << "Kullanım: loadgen [seçenekler]\n"
+                 "  --service radar|iff|datalink|all   (varsayılan: all, virgülle birden fazla)\n"
+                 "  --streams N                        servis başına eşzamanlı stream (10)\n"
+                 "  --duration S                       test süresi, saniye (30)\n"
+                 "  --interval-ms MS                   radar refresh_interval_ms (1000)\n"
+                 "  --radar-addr H:P                   (localhost:50053)\n"
+                 "  --iff-addr H:P                     (localhost:50051)\n"
+                 "  --datalink-addr H:P                (localhost:50052)\n"
+                 "  --share-channel                    tüm stream'ler tek HTTP/2 bağlantısı kullansın\n"
+                 "  --viewport LAT1,LON1,LAT2,LON2     radar için sadece bu görünüme abone ol\n"
+                 "  --web-mercator                     radar hedeflerinde EPSG:3857 x/y iste\n"
+                 "  --smoothed                         radar hedeflerinde filtrelenmiş konum + TrackState iste\n"
+                 "  --report PATH                      JSON raporu yaz\n";
+}
+
+bool parseArgs(int argc, char **argv, Options &o)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&](const char *name) -> const char *
+        {
+            if (i + 1 >= argc)
+            {
+                std::cerr << name << " bir değer bekliyor" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+            return argv[++i];
+        };
+
+        if (a == "--service")
+        {
+            const std::string v = next("--service");
+            o.radar = v == "all" || v.find("radar") != std::string::npos;
+            o.iff = v == "all" || v.find("iff") != std::string::npos;
+            o.datalink = v == "all" || v.find("datalink") != std::string::npos;
+        }
+        else if (a == "--streams")
+            o.streams = std::atoi(next("--streams"));
+        else if (a == "--duration")
+            o.duration_s = std::atoi(next("--duration"));
+        else if (a == "--interval-ms")
+            o.interval_ms = std::atoi(next("--interval-ms"));
+        else if (a == "--radar-addr")
+            o.radar_addr = next("--radar-addr");
+        else if (a == "--iff-addr")
+            o.iff_addr = next("--iff-addr");
+        else if (a == "--datalink-addr")
+            o.datalink_addr = next("--datalink-addr");
+        else if (a == "--share-channel")
+            o.share_channel = true;
+        else if (a == "--viewport")
+        {
+            double v[4];
+            if (std::sscanf(next("--viewport"), "%lf,%lf,%lf,%lf", &v[0], &v[1], &v[2], &v[3]) != 4)
+            {
+                std::cerr << "--viewport LAT1,LON1,LAT2,LON2 bekliyor" << std::endl;
+                return false;
+            }
+            o.use_viewport = true;
+            o.viewport.set_min_lat(std::min(v[0], v[2]));
+            o.viewport.set_max_lat(std::max(v[0], v[2]));
+            o.viewport.set_min_lon(std::min(v[1], v[3]));
+            o.viewport.set_max_lon(std::max(v[1], v[3]));
+        }
+        else if (a == "--web-mercator")
+            o.web_mercator = true;
+        else if (a == "--smoothed")
+            o.smoothed = true;
+        else if (a == "--report")
+            o.report_path = next("--report");
+        else if (a == "--help" || a == "-h")
+        {
+            usage();
+            return false;
+        }
+        else
+        {
+            std::cerr << "Bilinmeyen seçenek: " << a << std::endl;
+            usage();
+            return false;
+        }
+    }
+    return o.streams > 0 && o.duration_s > 0;
+}
+
+std::shared_ptr<grpc::Channel> makeChannel(const std::string &addr, bool shared)
+{
+    grpc::ChannelArguments args;
+    // Her konsolun kendi TCP bağlantısı olur; aksi halde gRPC aynı hedefe
+    // giden kanalları tek alt kanala indirir.
+    if (!shared)
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    return grpc::CreateCustomChannel(addr, grpc::InsecureChannelCredentials(), args);
+}
+
+// seq ve zaman damgaları görünüm olaylarında içteki RadarTarget'tadır.
+template <typename Msg>
+const Msg &stamped(const Msg &m) { return m; }
+const radar::RadarTarget &stamped(const radar::TargetEvent &e) { return e.target(); }
+
+// Tek bir stream'i süre dolana kadar okur; sunucu stream'i bitirirse
+// (IFF/DataLink kayıtlar bitince kapanır) yeniden açar.
+template <typename Msg, typename OpenFn>
+void runStream(OpenFn open, ServiceStats &stats, Clock::time_point deadline)
+{
+    Msg msg;
+    while (Clock::now() < deadline)
+    {
+        grpc::ClientContext ctx;
+        // gRPC deadline'ı system_clock ister.
+        ctx.set_deadline(std::chrono::system_clock::now() +
+                         std::chrono::duration_cast<std::chrono::system_clock::duration>(deadline - Clock::now()));
+
+        const auto opened = Clock::now();
+        auto reader = open(&ctx);
+        stats.streams_opened.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t local_msgs = 0;
+        uint64_t local_bytes = 0;
+        Clock::time_point last = opened;
+        uint64_t last_seq = 0;
+        while (reader->Read(&msg))
+        {
+            const auto now = Clock::now();
+            const int64_t recv_us = unix_micros();
+            if (local_msgs == 0)
+                stats.first_message.record(now - opened);
+            else
+                stats.gap.record(now - last);
+            last = now;
+
+            // seq alanı olmayan eski sunucular 0 gönderir; onlar atlanır.
+            const auto &st = stamped(msg);
+            if (st.seq() != 0)
+            {
+                if (last_seq != 0 && st.seq() > last_seq + 1)
+                    stats.seq_gaps.fetch_add(st.seq() - last_seq - 1, std::memory_order_relaxed);
+                last_seq = st.seq();
+            }
+            if (st.enqueue_time_us() != 0)
+                stats.end_to_end.record(micros_since(st.enqueue_time_us(), recv_us));
+            if (st.sim_time_us() != 0)
+                stats.age.record(micros_since(st.sim_time_us(), recv_us));
+            ++local_msgs;
+            local_bytes += msg.ByteSizeLong();
+        }
+
+        stats.messages.fetch_add(local_msgs, std::memory_order_relaxed);
+        stats.bytes.fetch_add(local_bytes, std::memory_order_relaxed);
+
+        const grpc::Status st = reader->Finish();
+        if (!st.ok() && st.error_code() != grpc::StatusCode::DEADLINE_EXCEEDED)
+        {
+            stats.stream_errors.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+    }
+}
+
+double ms(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+void printStats(const ServiceStats &s, double secs, int streams)
+{
+    const auto first = s.first_message.snapshot();
+    const auto gap = s.gap.snapshot();
+    const auto e2e = s.end_to_end.snapshot();
+    const auto age = s.age.snapshot();
+    const double msgs = static_cast<double>(s.messages.load());
+    const double bytes = static_cast<double>(s.bytes.load());
+
+    std::printf("\n[%s] %d stream, %.1f s\n", s.name.c_str(), streams, secs);
+    std::printf("  mesaj          : %.0f  (%.1f msg/s, stream başına %.1f msg/s)\n",
+                msgs, msgs / secs, msgs / secs / streams);
+    std::printf("  bayt           : %.0f  (%.3f MB/s)\n", bytes, bytes / secs / 1e6);
+    std::printf("  stream açılış  : %llu  hata: %llu  seq boşluğu: %llu\n",
+                static_cast<unsigned long long>(s.streams_opened.load()),
+                static_cast<unsigned long long>(s.stream_errors.load()),
+                static_cast<unsigned long long>(s.seq_gaps.load()));
+    std::printf("  ilk mesaj (ms) : p50 %.2f  p90 %.2f  p99 %.2f  max %.2f\n",
+                ms(first.percentile(0.5)), ms(first.percentile(0.9)), ms(first.percentile(0.99)),
+                ms(first.percentile(1.0)));
+    std::printf("  aralık (ms)    : p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+                ms(gap.percentile(0.5)), ms(gap.percentile(0.9)), ms(gap.percentile(0.99)),
+                ms(gap.percentile(0.999)), ms(gap.percentile(1.0)));
+    std::printf("  uçtan uca (ms) : p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+                ms(e2e.percentile(0.5)), ms(e2e.percentile(0.9)), ms(e2e.percentile(0.99)),
+                ms(e2e.percentile(0.999)), ms(e2e.percentile(1.0)));
+    std::printf("  veri yaşı (ms) : p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+                ms(age.percentile(0.5)), ms(age.percentile(0.9)), ms(age.percentile(0.99)),
+                ms(age.percentile(0.999)), ms(age.percentile(1.0)));
+}
+
+void appendJson(std::string &out, const ServiceStats &s, double secs, int streams)
+{
+    const auto first = s.first_message.snapshot();
+    const auto gap = s.gap.snapshot();
+    const auto e2e = s.end_to_end.snapshot();
+    const auto age = s.age.snapshot();
+    char buf[2048];
+    std::snprintf(buf, sizeof(buf),
+                  "{\"service\":\"%s\",\"streams\":%d,\"seconds\":%.3f,"
+                  "\"messages\":%llu,\"bytes\":%llu,\"msgs_per_sec\":%.3f,\"bytes_per_sec\":%.3f,"
+                  "\"streams_opened\":%llu,\"stream_errors\":%llu,\"seq_gaps\":%llu,"
+                  "\"first_message_ms\":{\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"max\":%.3f},"
+                  "\"gap_ms\":{\"p50\":%.4f,\"p90\":%.4f,\"p99\":%.4f,\"p999\":%.4f,\"max\":%.4f},"
+                  "\"end_to_end_ms\":{\"p50\":%.4f,\"p90\":%.4f,\"p99\":%.4f,\"p999\":%.4f,\"max\":%.4f},"
+                  "\"age_ms\":{\"p50\":%.4f,\"p90\":%.4f,\"p99\":%.4f,\"p999\":%.4f,\"max\":%.4f}}",
+                  s.name.c_str(), streams, secs,
+                  static_cast<unsigned long long>(s.messages.load()),
+                  static_cast<unsigned long long>(s.bytes.load()),
+                  s.messages.load() / secs, s.bytes.load() / secs,
+                  static_cast<unsigned long long>(s.streams_opened.load()),
+                  static_cast<unsigned long long>(s.stream_errors.load()),
+                  static_cast<unsigned long long>(s.seq_gaps.load()),
+                  ms(first.percentile(0.5)), ms(first.percentile(0.9)), ms(first.percentile(0.99)),
+                  ms(first.percentile(1.0)),
+                  ms(gap.percentile(0.5)), ms(gap.percentile(0.9)), ms(gap.percentile(0.99)),
+                  ms(gap.percentile(0.999)), ms(gap.percentile(1.0)),
+                  ms(e2e.percentile(0.5)), ms(e2e.percentile(0.9)), ms(e2e.percentile(0.99)),
+                  ms(e2e.percentile(0.999)), ms(e2e.percentile(1.0)),
+                  ms(age.percentile(0.5)), ms(age.percentile(0.9)), ms(age.percentile(0.99)),
+                  ms(age.percentile(0.999)), ms(age.percentile(1.0)));
+    out += buf;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return EXIT_FAILURE;
+
+    std::vector<std::unique_ptr<ServiceStats>> all_stats;
+    std::vector<std::thread> threads;
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(opt.duration_s);
+
+    if (opt.radar)
+    {
+        all_stats.push_back(std::make_unique<ServiceStats>(opt.use_viewport ? "radar-viewport" : "radar"));
+        ServiceStats &stats = *all_stats.back();
+        auto shared = makeChannel(opt.radar_addr, true);
+        for (int i = 0; i < opt.streams; ++i)
+        {
+            auto stub = radar::RadarService::NewStub(opt.share_channel ? shared : makeChannel(opt.radar_addr, false));
+            if (opt.use_viewport)
+            {
+                threads.emplace_back([stub = std::move(stub), &stats, deadline, &opt]() mutable
+                                     {
+                    radar::Viewport vp = opt.viewport;
+                    vp.set_refresh_interval_ms(opt.interval_ms);
+                    vp.set_web_mercator(opt.web_mercator);
+                    vp.set_smoothed(opt.smoothed);
+                    runStream<radar::TargetEvent>(
+                        [&](grpc::ClientContext *ctx)
+                        {
+                            auto rw = stub->SubscribeViewport(ctx);
+                            rw->Write(vp);
+                            return rw;
+                        },
+                        stats, deadline); });
+                continue;
+            }
+            threads.emplace_back([stub = std::move(stub), &stats, deadline, &opt]() mutable
+                                 {
+                radar::StreamRequest req;
+                req.set_refresh_interval_ms(opt.interval_ms);
+                req.set_web_mercator(opt.web_mercator);
+                req.set_smoothed(opt.smoothed);
+                runStream<radar::RadarTarget>(
+                    [&](grpc::ClientContext *ctx) { return stub->StreamRadarTargets(ctx, req); },
+                    stats, deadline); });
+        }
+    }
+
+    if (opt.iff)
+    {
+        all_stats.push_back(std::make_unique<ServiceStats>("iff"));
+        ServiceStats &stats = *all_stats.back();
+        auto shared = makeChannel(opt.iff_addr, true);
+        for (int i = 0; i < opt.streams; ++i)
+        {
+            auto stub = iff::IFFService::NewStub(opt.share_channel ? shared : makeChannel(opt.iff_addr, false));
+            threads.emplace_back([stub = std::move(stub), &stats, deadline]() mutable
+                                 {
+                iff::IFFRequest req;
+                runStream<iff::IFFStreamResponse>(
+                    [&](grpc::ClientContext *ctx) { return stub->StreamIFFData(ctx, req); },
+                    stats, deadline); });
+        }
+    }
+
+    if (opt.datalink)
+    {
+        all_stats.push_back(std::make_unique<ServiceStats>("datalink"));
+        ServiceStats &stats = *all_stats.back();
+        auto shared = makeChannel(opt.datalink_addr, true);
+        for (int i = 0; i < opt.streams; ++i)
+        {
+            auto stub = datalink::DataLink::NewStub(opt.share_channel ? shared : makeChannel(opt.datalink_addr, false));
+            threads.emplace_back([stub = std::move(stub), &stats, deadline]() mutable
+                                 {
+                datalink::DLRequest req;
+                runStream<datalink::DLStreamResponse>(
+                    [&](grpc::ClientContext *ctx) { return stub->StreamDataLink(ctx, req); },
+                    stats, deadline); });
+        }
+    }
+
+    std::cout << "[LOADGEN] " << threads.size() << " stream, " << opt.duration_s << " s çalışıyor..." << std::endl;
+    for (auto &t : threads)
+        t.join();
+
+    const double secs = std::chrono::duration<double>(Clock::now() - start).count();
+    std::string json = "{\"services\":[";
+    for (std::size_t i = 0; i < all_stats.size(); ++i)
+    {
+        printStats(*all_stats[i], secs, opt.streams);
+        if (i)
+            json += ",";
+        appendJson(json, *all_stats[i], secs, opt.streams);
+    }
+    json += "]}\n";
+
+    if (!opt.report_path.empty())
+    {
+        std::ofstream f(opt.report_path);
+        if (!f)
+        {
+            std::cerr << "[LOADGEN] Rapor yazılamadı: " << opt.report_path << std::endl;
+            return EXIT_FAILURE;
+        }
+        f << json;
+        std::cout << "\n[LOADGEN] Rapor: " << opt.report_path << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
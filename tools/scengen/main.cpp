@@ -0,0 +1,521 @@
+// Radar / IFF / DataLink koleksiyonları için yüksek hacimli senaryo üreteci.
+// Tek bir uçak popülasyonu üretilir ve simService'teki gibi üç koleksiyona
+// da aynı uçaklar yazılır; böylece callsign/konum/irtifa kaynaklar arasında
+// tutarlıdır. Sivil trafik havalimanları arası rotalar boyunca kümelenir,
+// askeri uçaklar devriye bölgelerinde, FOE izler sınır bölgelerindedir.
+//
+// Çıktı ya Mongo'ya insert_many ile toplu yazılır ya da mongodump
+// biçiminde .bson dosyalarına; ikincisi servislerde
+// AEWC_TRACK_SOURCE=file:<dizin>/{coll}.bson ile doğrudan okunur.
+//
+//   scengen --count 1000000 --out-dir ./scenario
+//   scengen --count 200000 --mongo-uri mongodb://localhost:27017 --drop
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/oid.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/insert.hpp>
+#include <mongocxx/uri.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+namespace
+{
+struct Options
+{
+    std::size_t count = 100000;
+    uint64_t seed = 42;
+    bool radar = true;
+    bool iff = true;
+    bool datalink = true;
+    std::string out_dir;
+    std::string mongo_uri = "mongodb://localhost:27017";
+    std::string db_name = "aewc";
+    bool drop = false;
+    std::size_t batch = 10000;
+    double military_ratio = 0.10;
+    double foe_ratio = 0.05;
+    double unknown_ratio = 0.15;
+};
+
+struct Aircraft
+{
+    std::string callsign;
+    const char *status = "UNKNOWN";
+    double lat = 0.0;
+    double lon = 0.0;
+    double velocity = 0.0;
+    double baro_altitude = 0.0;
+    double geo_altitude = 0.0;
+};
+
+struct Point
+{
+    double lat;
+    double lon;
+};
+
+struct Airport
+{
+    const char *icao;
+    Point pos;
+    double weight; // rota seçimindeki trafik payı
+};
+
+// Başlıca havalimanları; ağırlıklar kabaca yolcu trafiğiyle orantılı.
+const Airport kAirports[] = {
+    {"LTFM", {41.275, 28.752}, 10.0}, // İstanbul
+    {"LTFJ", {40.898, 29.309}, 6.0},  // Sabiha Gökçen
+    {"LTAI", {36.898, 30.800}, 5.0},  // Antalya
+    {"LTAC", {40.128, 32.995}, 3.5},  // Ankara
+    {"LTBJ", {38.289, 27.157}, 3.0},  // İzmir
+    {"LTBS", {36.713, 28.792}, 1.2},  // Dalaman
+    {"LTFE", {37.250, 27.664}, 1.2},  // Bodrum
+    {"LTAF", {36.982, 35.280}, 1.0},  // Adana
+    {"LTCG", {40.995, 39.789}, 1.0},  // Trabzon
+    {"LTCC", {37.893, 40.201}, 0.8},  // Diyarbakır
+    {"LTCE", {39.956, 41.170}, 0.6},  // Erzurum
+    {"LTAJ", {36.947, 37.478}, 0.6},  // Gaziantep
+    {"LTCI", {38.468, 43.332}, 0.6},  // Van
+    {"LTAN", {37.979, 32.561}, 0.5},  // Konya
+    {"LTFH", {41.254, 36.567}, 0.4},  // Samsun
+};
+
+// Dost devriye (CAP) bölgeleri ve FOE izlerin görüldüğü sınır bölgeleri.
+const Point kPatrolAreas[] = {{40.6, 26.8}, {38.6, 26.6}, {36.6, 31.5}, {37.1, 36.6}, {37.6, 42.4}, {40.7, 43.2}};
+const Point kBorderAreas[] = {{39.6, 26.1}, {36.3, 35.9}, {37.0, 44.5}, {41.3, 43.6}, {41.9, 28.2}};
+
+const char *const kAirlines[] = {"THY", "PGT", "SXS", "AJA", "KKK", "TKJ", "CAI", "FHY"};
+const double kAirlineWeights[] = {45, 20, 12, 8, 5, 4, 3, 3};
+
+const char *const kMilitaryNames[] = {"ASLAN", "KARTAL", "SAHIN", "PARS", "YILDIZ", "SIMSEK", "ATMACA", "KURT"};
+
+void usage()
+{
+    std::cout << "Kullanım: scengen [seçenekler]\n"
+                 "  --count N              uçak sayısı (100000)\n"
+                 "  --seed S               rastgele tohum (42)\n"
+                 "  --collections LIST     radar,iff,datalink (varsayılan: hepsi)\n"
+                 "  --out-dir DIR          Mongo yerine DIR/<koleksiyon>.bson yaz\n"
+                 "  --mongo-uri URI        (mongodb://localhost:27017)\n"
+                 "  --db NAME              (aewc)\n"
+                 "  --drop                 yazmadan önce koleksiyonları boşalt\n"
+                 "  --batch N              insert_many başına belge (10000)\n"
+                 "  --military-ratio R     askeri dost oranı (0.10)\n"
+                 "  --foe-ratio R          FOE oranı (0.05)\n"
+                 "  --unknown-ratio R      kimliği belirsiz GA trafiği oranı (0.15)\n";
+}
+
+bool parseArgs(int argc, char **argv, Options &o)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&](const char *name) -> const char *
+        {
+            if (i + 1 >= argc)
+            {
+                std::cerr << name << " bir değer bekliyor" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+            return argv[++i];
+        };
+
+        if (a == "--count")
+            o.count = static_cast<std::size_t>(std::strtoull(next("--count"), nullptr, 10));
+        else if (a == "--seed")
+            o.seed = std::strtoull(next("--seed"), nullptr, 10);
+        else if (a == "--collections")
+        {
+            const std::string v = next("--collections");
+            o.radar = v.find("radar") != std::string::npos;
+            o.iff = v.find("iff") != std::string::npos;
+            o.datalink = v.find("datalink") != std::string::npos;
+        }
+        else if (a == "--out-dir")
+            o.out_dir = next("--out-dir");
+        else if (a == "--mongo-uri")
+            o.mongo_uri = next("--mongo-uri");
+        else if (a == "--db")
+            o.db_name = next("--db");
+        else if (a == "--drop")
+            o.drop = true;
+        else if (a == "--batch")
+            o.batch = static_cast<std::size_t>(std::strtoull(next("--batch"), nullptr, 10));
+        else if (a == "--military-ratio")
+            o.military_ratio = std::atof(next("--military-ratio"));
+        else if (a == "--foe-ratio")
+            o.foe_ratio = std::atof(next("--foe-ratio"));
+        else if (a == "--unknown-ratio")
+            o.unknown_ratio = std::atof(next("--unknown-ratio"));
+        else if (a == "--help" || a == "-h")
+        {
+            usage();
+            return false;
+        }
+        else
+        {
+            std::cerr << "Bilinmeyen seçenek: " << a << std::endl;
+            usage();
+            return false;
+        }
+    }
+    if (o.military_ratio + o.foe_ratio + o.unknown_ratio > 1.0)
+    {
+        std::cerr << "Oranların toplamı 1'i geçemez" << std::endl;
+        return false;
+    }
+    return o.count > 0 && o.batch > 0 && (o.radar || o.iff || o.datalink);
+}
+
+double clampd(double v, double lo, double hi) { return std::min(std::max(v, lo), hi); }
+
+// Servislerin varsayılan işletim alanı kutusuna takılmaması için kutunun biraz içinde tutulur.
+Point clampToTurkey(Point p)
+{
+    return {clampd(p.lat, 36.02, 41.98), clampd(p.lon, 26.02, 44.98)};
+}
+
+class ScenarioGenerator
+{
+public:
+    explicit ScenarioGenerator(const Options &o)
+        : rng_(o.seed),
+          airport_pick_(airportPick()),
+          airline_pick_(std::begin(kAirlineWeights), std::end(kAirlineWeights)),
+          military_ratio_(o.military_ratio),
+          foe_ratio_(o.foe_ratio),
+          unknown_ratio_(o.unknown_ratio) {}
+
+    void next(Aircraft &ac)
+    {
+        const double u = uniform_(rng_);
+        if (u < foe_ratio_)
+            makeFoe(ac);
+        else if (u < foe_ratio_ + military_ratio_)
+            makeMilitary(ac);
+        else if (u < foe_ratio_ + military_ratio_ + unknown_ratio_)
+            makeGeneralAviation(ac);
+        else
+            makeAirliner(ac);
+
+        // Geometrik irtifa = barometrik + geoid/sıcaklık farkı.
+        ac.geo_altitude = std::max(0.0, ac.baro_altitude + normal(60.0, 25.0));
+    }
+
+private:
+    static std::discrete_distribution<std::size_t> airportPick()
+    {
+        std::vector<double> w;
+        for (const Airport &a : kAirports)
+            w.push_back(a.weight);
+        return std::discrete_distribution<std::size_t>(w.begin(), w.end());
+    }
+
+    double normal(double mean, double sd) { return std::normal_distribution<double>(mean, sd)(rng_); }
+    double uniform(double lo, double hi) { return lo + (hi - lo) * uniform_(rng_); }
+    std::size_t pickIndex(std::size_t n) { return std::uniform_int_distribution<std::size_t>(0, n - 1)(rng_); }
+
+    // Rota boyunca kümelenmiş sivil trafik; kalkış/inişe yakın uçaklar alçak ve yavaştır.
+    void makeAirliner(Aircraft &ac)
+    {
+        const std::size_t from = airport_pick_(rng_);
+        std::size_t to = airport_pick_(rng_);
+        while (to == from)
+            to = airport_pick_(rng_);
+
+        const Point a = kAirports[from].pos;
+        const Point b = kAirports[to].pos;
+        const double t = uniform(0.0, 1.0);
+
+        // Rotaya dik yönde ~3 km saçılma (airway genişliği).
+        const double dlat = b.lat - a.lat;
+        const double dlon = b.lon - a.lon;
+        const double len = std::sqrt(dlat * dlat + dlon * dlon);
+        const double off = normal(0.0, 0.03);
+        const Point p = clampToTurkey({a.lat + dlat * t - dlon / len * off, a.lon + dlon * t + dlat / len * off});
+
+        const double phase = std::min(1.0, std::min(t, 1.0 - t) / 0.15); // 0: pist, 1: seyir
+        const double cruise = clampd(normal(10800.0, 700.0), 8500.0, 12500.0);
+        ac.lat = p.lat;
+        ac.lon = p.lon;
+        ac.baro_altitude = std::max(300.0, cruise * phase);
+        ac.velocity = clampd(280.0 + 560.0 * phase + normal(0.0, 25.0), 220.0, 950.0);
+
+        char cs[16];
+        std::snprintf(cs, sizeof(cs), "%s%d", kAirlines[airline_pick_(rng_)],
+                      std::uniform_int_distribution<int>(1, 2999)(rng_));
+        ac.callsign = cs;
+        ac.status = "FRIEND";
+    }
+
+    void makeMilitary(Aircraft &ac)
+    {
+        const Point c = kPatrolAreas[pickIndex(std::size(kPatrolAreas))];
+        const Point p = clampToTurkey({c.lat + normal(0.0, 0.35), c.lon + normal(0.0, 0.45)});
+        ac.lat = p.lat;
+        ac.lon = p.lon;
+        ac.baro_altitude = uniform(3000.0, 12500.0);
+        ac.velocity = clampd(normal(850.0, 180.0), 400.0, 1600.0);
+
+        char cs[16];
+        std::snprintf(cs, sizeof(cs), "%s%d%d", kMilitaryNames[pickIndex(std::size(kMilitaryNames))],
+                      std::uniform_int_distribution<int>(1, 9)(rng_),
+                      std::uniform_int_distribution<int>(1, 4)(rng_));
+        ac.callsign = cs;
+        ac.status = "FRIEND";
+    }
+
+    // Sınır bölgelerinde, alçak-hızlı veya yüksek-hızlı profilde FOE izler.
+    void makeFoe(Aircraft &ac)
+    {
+        const Point c = kBorderAreas[pickIndex(std::size(kBorderAreas))];
+        const Point p = clampToTurkey({c.lat + normal(0.0, 0.25), c.lon + normal(0.0, 0.25)});
+        ac.lat = p.lat;
+        ac.lon = p.lon;
+        if (uniform_(rng_) < 0.4)
+        {
+            ac.baro_altitude = uniform(150.0, 1500.0);
+            ac.velocity = clampd(normal(800.0, 120.0), 450.0, 1100.0);
+        }
+        else
+        {
+            ac.baro_altitude = uniform(6000.0, 14000.0);
+            ac.velocity = clampd(normal(1100.0, 200.0), 600.0, 1800.0);
+        }
+        ac.callsign = "UNKNOWN";
+        ac.status = "FOE";
+    }
+
+    // Transponder'ı kimlik vermeyen hafif trafik: her yerde, alçak ve yavaş.
+    void makeGeneralAviation(Aircraft &ac)
+    {
+        ac.lat = uniform(36.1, 41.9);
+        ac.lon = uniform(26.1, 44.9);
+        ac.baro_altitude = uniform(450.0, 4500.0);
+        ac.velocity = clampd(normal(220.0, 50.0), 100.0, 400.0);
+        ac.callsign = "UNKNOWN";
+        ac.status = "UNKNOWN";
+    }
+
+    std::mt19937_64 rng_;
+    std::uniform_real_distribution<double> uniform_{0.0, 1.0};
+    std::discrete_distribution<std::size_t> airport_pick_;
+    std::discrete_distribution<std::size_t> airline_pick_;
+    double military_ratio_;
+    double foe_ratio_;
+    double unknown_ratio_;
+};
+
+// simService'in yazdığı belge şekilleri (alan adları koleksiyona göre farklı).
+// Radar belgesine simService'ten farklı olarak status de yazılır; radar
+// şeması varsa okur (kümelerin dominant_status'u için).
+bsoncxx::document::value radarDoc(const Aircraft &ac)
+{
+    return make_document(kvp("_id", bsoncxx::oid{}),
+                         kvp("lat", ac.lat),
+                         kvp("lon", ac.lon),
+                         kvp("velocity", ac.velocity),
+                         kvp("baroAltitude", ac.baro_altitude),
+                         kvp("geoAltitude", ac.geo_altitude),
+                         kvp("status", ac.status));
+}
+
+bsoncxx::document::value iffDoc(const Aircraft &ac)
+{
+    return make_document(kvp("_id", bsoncxx::oid{}),
+                         kvp("lat", ac.lat),
+                         kvp("lon", ac.lon),
+                         kvp("callsign", ac.callsign),
+                         kvp("status", ac.status));
+}
+
+bsoncxx::document::value datalinkDoc(const Aircraft &ac, int64_t timestamp_ms)
+{
+    return make_document(kvp("_id", bsoncxx::oid{}),
+                         kvp("callsign", ac.callsign),
+                         kvp("status", ac.status),
+                         kvp("lat", ac.lat),
+                         kvp("lon", ac.lon),
+                         kvp("velocity", ac.velocity),
+                         kvp("baroaltitude", ac.baro_altitude),
+                         kvp("geoaltitude", ac.geo_altitude),
+                         kvp("timestamp", timestamp_ms));
+}
+
+// Belgeleri batch'ler hâlinde hedefe yazar.
+class Sink
+{
+public:
+    virtual ~Sink() = default;
+    virtual void write(const std::vector<bsoncxx::document::value> &docs) = 0;
+};
+
+// mongodump ile aynı biçim: BSON belgeleri art arda.
+class FileSink final : public Sink
+{
+public:
+    explicit FileSink(const std::string &path) : out_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!out_)
+            throw std::runtime_error("dosya açılamadı: " + path);
+    }
+
+    void write(const std::vector<bsoncxx::document::value> &docs) override
+    {
+        for (const auto &d : docs)
+        {
+            const auto v = d.view();
+            out_.write(reinterpret_cast<const char *>(v.data()), static_cast<std::streamsize>(v.length()));
+        }
+        if (!out_)
+            throw std::runtime_error("dosyaya yazılamadı");
+    }
+
+private:
+    std::ofstream out_;
+};
+
+class MongoSink final : public Sink
+{
+public:
+    MongoSink(mongocxx::client &client, const std::string &db, const std::string &coll, bool drop)
+        : coll_(client[db][coll])
+    {
+        if (drop)
+            coll_.drop();
+        // Sırasız insert sunucu tarafında paralel yazmaya izin verir.
+        opts_.ordered(false);
+    }
+
+    void write(const std::vector<bsoncxx::document::value> &docs) override
+    {
+        coll_.insert_many(docs, opts_);
+    }
+
+private:
+    mongocxx::collection coll_;
+    mongocxx::options::insert opts_;
+};
+
+struct Output
+{
+    const char *name;
+    std::unique_ptr<Sink> sink;
+    std::vector<bsoncxx::document::value> batch;
+    std::size_t written = 0;
+};
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return EXIT_FAILURE;
+
+    try
+    {
+        mongocxx::instance instance{};
+        std::unique_ptr<mongocxx::client> client;
+        if (opt.out_dir.empty())
+            client = std::make_unique<mongocxx::client>(mongocxx::uri{opt.mongo_uri});
+
+        auto makeSink = [&](const char *coll) -> std::unique_ptr<Sink>
+        {
+            if (!opt.out_dir.empty())
+                return std::make_unique<FileSink>(opt.out_dir + "/" + coll + ".bson");
+            return std::make_unique<MongoSink>(*client, opt.db_name, coll, opt.drop);
+        };
+
+        std::vector<Output> outputs;
+        if (opt.radar)
+            outputs.push_back({"radar", makeSink("radar"), {}, 0});
+        if (opt.iff)
+            outputs.push_back({"iff", makeSink("iff"), {}, 0});
+        if (opt.datalink)
+            outputs.push_back({"datalink", makeSink("datalink"), {}, 0});
+        for (Output &o : outputs)
+            o.batch.reserve(opt.batch);
+
+        std::cout << "[SCENGEN] " << opt.count << " uçak -> "
+                  << (opt.out_dir.empty() ? opt.mongo_uri + " / " + opt.db_name : opt.out_dir) << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+        const int64_t timestamp_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         std::chrono::system_clock::now().time_since_epoch())
+                                         .count();
+
+        ScenarioGenerator gen(opt);
+        Aircraft ac;
+        std::size_t friends = 0, foes = 0, unknowns = 0;
+
+        auto flush = [](Output &o)
+        {
+            if (o.batch.empty())
+                return;
+            o.sink->write(o.batch);
+            o.written += o.batch.size();
+            o.batch.clear();
+        };
+
+        for (std::size_t i = 0; i < opt.count; ++i)
+        {
+            gen.next(ac);
+            if (std::strcmp(ac.status, "FRIEND") == 0)
+                ++friends;
+            else if (std::strcmp(ac.status, "FOE") == 0)
+                ++foes;
+            else
+                ++unknowns;
+
+            for (Output &o : outputs)
+            {
+                if (o.name[0] == 'r')
+                    o.batch.push_back(radarDoc(ac));
+                else if (o.name[0] == 'i')
+                    o.batch.push_back(iffDoc(ac));
+                else
+                    o.batch.push_back(datalinkDoc(ac, timestamp_ms));
+
+                if (o.batch.size() >= opt.batch)
+                    flush(o);
+            }
+
+            if ((i + 1) % 1000000 == 0)
+                std::cout << "[SCENGEN] " << (i + 1) << " / " << opt.count << std::endl;
+        }
+        for (Output &o : outputs)
+            flush(o);
+
+        const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("[SCENGEN] FRIEND %zu, FOE %zu, UNKNOWN %zu\n", friends, foes, unknowns);
+        for (const Output &o : outputs)
+            std::printf("[SCENGEN] %-8s : %zu belge\n", o.name, o.written);
+        std::printf("[SCENGEN] %.2f s (%.0f uçak/s)\n", secs, static_cast<double>(opt.count) / secs);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "[SCENGEN] Hata: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}